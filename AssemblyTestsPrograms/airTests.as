@@ -0,0 +1,16 @@
+; Assembled once, then rebuilt from airTests.air with ASSEMBLER_AIR=1
+.entry START
+.extern PRINT
+.define size = 3
+mcr show
+        prn ARR[1]
+        jsr PRINT
+endmcr
+START:  lea MSG, r1
+        show
+        mov ARR[size], r2
+        bne START
+        rts
+MSG:    .string "air"
+ARR:    .data 5, -5, size, 100
+.entry ARR
@@ -0,0 +1,5207 @@
+; More lines than MIN_LINES_PER_THREAD, classified and encoded in chunks
+.extern EXT
+.entry L0
+.entry L1299
+.entry ARR
+.define k0 = 0
+L0:     mov ARR[k0], r0
+        ; block 0
+
+.define k1 = 1
+L1:     cmp #k1, L48
+        ; block 1
+
+.define k2 = 2
+L2:     bne L113
+        ; block 2
+
+.define k3 = 3
+L3:     jsr EXT
+        ; block 3
+
+.define k4 = 4
+L4:     mov ARR[k4], r4
+        ; block 4
+
+.define k5 = 5
+L5:     cmp #k5, L196
+        ; block 5
+
+.define k6 = 6
+L6:     bne L325
+        ; block 6
+
+.define k7 = 7
+L7:     jsr EXT
+        ; block 7
+
+.define k8 = 0
+L8:     mov ARR[k8], r0
+        ; block 8
+
+.define k9 = 1
+L9:     cmp #k9, L344
+        ; block 9
+
+.define k10 = 2
+L10:    bne L537
+        ; block 10
+
+.define k11 = 3
+L11:    jsr EXT
+        ; block 11
+
+.define k12 = 4
+L12:    mov ARR[k12], r4
+        ; block 12
+
+.define k13 = 5
+L13:    cmp #k13, L492
+        ; block 13
+
+.define k14 = 6
+L14:    bne L749
+        ; block 14
+
+.define k15 = 7
+L15:    jsr EXT
+        ; block 15
+
+.define k16 = 0
+L16:    mov ARR[k16], r0
+        ; block 16
+
+.define k17 = 1
+L17:    cmp #k17, L640
+        ; block 17
+
+.define k18 = 2
+L18:    bne L961
+        ; block 18
+
+.define k19 = 3
+L19:    jsr EXT
+        ; block 19
+
+.define k20 = 4
+L20:    mov ARR[k20], r4
+        ; block 20
+
+.define k21 = 5
+L21:    cmp #k21, L788
+        ; block 21
+
+.define k22 = 6
+L22:    bne L1173
+        ; block 22
+
+.define k23 = 7
+L23:    jsr EXT
+        ; block 23
+
+.define k24 = 0
+L24:    mov ARR[k24], r0
+        ; block 24
+
+.define k25 = 1
+L25:    cmp #k25, L936
+        ; block 25
+
+.define k26 = 2
+L26:    bne L85
+        ; block 26
+
+.define k27 = 3
+L27:    jsr EXT
+        ; block 27
+
+.define k28 = 4
+L28:    mov ARR[k28], r4
+        ; block 28
+
+.define k29 = 5
+L29:    cmp #k29, L1084
+        ; block 29
+
+.define k30 = 6
+L30:    bne L297
+        ; block 30
+
+.define k31 = 7
+L31:    jsr EXT
+        ; block 31
+
+.define k32 = 0
+L32:    mov ARR[k32], r0
+        ; block 32
+
+.define k33 = 1
+L33:    cmp #k33, L1232
+        ; block 33
+
+.define k34 = 2
+L34:    bne L509
+        ; block 34
+
+.define k35 = 3
+L35:    jsr EXT
+        ; block 35
+
+.define k36 = 4
+L36:    mov ARR[k36], r4
+        ; block 36
+
+.define k37 = 5
+L37:    cmp #k37, L80
+        ; block 37
+
+.define k38 = 6
+L38:    bne L721
+        ; block 38
+
+.define k39 = 7
+L39:    jsr EXT
+        ; block 39
+
+.define k40 = 0
+L40:    mov ARR[k40], r0
+        ; block 40
+
+.define k41 = 1
+L41:    cmp #k41, L228
+        ; block 41
+
+.define k42 = 2
+L42:    bne L933
+        ; block 42
+
+.define k43 = 3
+L43:    jsr EXT
+        ; block 43
+
+.define k44 = 4
+L44:    mov ARR[k44], r4
+        ; block 44
+
+.define k45 = 5
+L45:    cmp #k45, L376
+        ; block 45
+
+.define k46 = 6
+L46:    bne L1145
+        ; block 46
+
+.define k47 = 7
+L47:    jsr EXT
+        ; block 47
+
+.define k48 = 0
+L48:    mov ARR[k48], r0
+        ; block 48
+
+.define k49 = 1
+L49:    cmp #k49, L524
+        ; block 49
+
+.define k50 = 2
+L50:    bne L57
+        ; block 50
+
+.define k51 = 3
+L51:    jsr EXT
+        ; block 51
+
+.define k52 = 4
+L52:    mov ARR[k52], r4
+        ; block 52
+
+.define k53 = 5
+L53:    cmp #k53, L672
+        ; block 53
+
+.define k54 = 6
+L54:    bne L269
+        ; block 54
+
+.define k55 = 7
+L55:    jsr EXT
+        ; block 55
+
+.define k56 = 0
+L56:    mov ARR[k56], r0
+        ; block 56
+
+.define k57 = 1
+L57:    cmp #k57, L820
+        ; block 57
+
+.define k58 = 2
+L58:    bne L481
+        ; block 58
+
+.define k59 = 3
+L59:    jsr EXT
+        ; block 59
+
+.define k60 = 4
+L60:    mov ARR[k60], r4
+        ; block 60
+
+.define k61 = 5
+L61:    cmp #k61, L968
+        ; block 61
+
+.define k62 = 6
+L62:    bne L693
+        ; block 62
+
+.define k63 = 7
+L63:    jsr EXT
+        ; block 63
+
+.define k64 = 0
+L64:    mov ARR[k64], r0
+        ; block 64
+
+.define k65 = 1
+L65:    cmp #k65, L1116
+        ; block 65
+
+.define k66 = 2
+L66:    bne L905
+        ; block 66
+
+.define k67 = 3
+L67:    jsr EXT
+        ; block 67
+
+.define k68 = 4
+L68:    mov ARR[k68], r4
+        ; block 68
+
+.define k69 = 5
+L69:    cmp #k69, L1264
+        ; block 69
+
+.define k70 = 6
+L70:    bne L1117
+        ; block 70
+
+.define k71 = 7
+L71:    jsr EXT
+        ; block 71
+
+.define k72 = 0
+L72:    mov ARR[k72], r0
+        ; block 72
+
+.define k73 = 1
+L73:    cmp #k73, L112
+        ; block 73
+
+.define k74 = 2
+L74:    bne L29
+        ; block 74
+
+.define k75 = 3
+L75:    jsr EXT
+        ; block 75
+
+.define k76 = 4
+L76:    mov ARR[k76], r4
+        ; block 76
+
+.define k77 = 5
+L77:    cmp #k77, L260
+        ; block 77
+
+.define k78 = 6
+L78:    bne L241
+        ; block 78
+
+.define k79 = 7
+L79:    jsr EXT
+        ; block 79
+
+.define k80 = 0
+L80:    mov ARR[k80], r0
+        ; block 80
+
+.define k81 = 1
+L81:    cmp #k81, L408
+        ; block 81
+
+.define k82 = 2
+L82:    bne L453
+        ; block 82
+
+.define k83 = 3
+L83:    jsr EXT
+        ; block 83
+
+.define k84 = 4
+L84:    mov ARR[k84], r4
+        ; block 84
+
+.define k85 = 5
+L85:    cmp #k85, L556
+        ; block 85
+
+.define k86 = 6
+L86:    bne L665
+        ; block 86
+
+.define k87 = 7
+L87:    jsr EXT
+        ; block 87
+
+.define k88 = 0
+L88:    mov ARR[k88], r0
+        ; block 88
+
+.define k89 = 1
+L89:    cmp #k89, L704
+        ; block 89
+
+.define k90 = 2
+L90:    bne L877
+        ; block 90
+
+.define k91 = 3
+L91:    jsr EXT
+        ; block 91
+
+.define k92 = 4
+L92:    mov ARR[k92], r4
+        ; block 92
+
+.define k93 = 5
+L93:    cmp #k93, L852
+        ; block 93
+
+.define k94 = 6
+L94:    bne L1089
+        ; block 94
+
+.define k95 = 7
+L95:    jsr EXT
+        ; block 95
+
+.define k96 = 0
+L96:    mov ARR[k96], r0
+        ; block 96
+
+.define k97 = 1
+L97:    cmp #k97, L1000
+        ; block 97
+
+.define k98 = 2
+L98:    bne L1
+        ; block 98
+
+.define k99 = 3
+L99:    jsr EXT
+        ; block 99
+
+.define k100 = 4
+L100:   mov ARR[k100], r4
+        ; block 100
+
+.define k101 = 5
+L101:   cmp #k101, L1148
+        ; block 101
+
+.define k102 = 6
+L102:   bne L213
+        ; block 102
+
+.define k103 = 7
+L103:   jsr EXT
+        ; block 103
+
+.define k104 = 0
+L104:   mov ARR[k104], r0
+        ; block 104
+
+.define k105 = 1
+L105:   cmp #k105, L1296
+        ; block 105
+
+.define k106 = 2
+L106:   bne L425
+        ; block 106
+
+.define k107 = 3
+L107:   jsr EXT
+        ; block 107
+
+.define k108 = 4
+L108:   mov ARR[k108], r4
+        ; block 108
+
+.define k109 = 5
+L109:   cmp #k109, L144
+        ; block 109
+
+.define k110 = 6
+L110:   bne L637
+        ; block 110
+
+.define k111 = 7
+L111:   jsr EXT
+        ; block 111
+
+.define k112 = 0
+L112:   mov ARR[k112], r0
+        ; block 112
+
+.define k113 = 1
+L113:   cmp #k113, L292
+        ; block 113
+
+.define k114 = 2
+L114:   bne L849
+        ; block 114
+
+.define k115 = 3
+L115:   jsr EXT
+        ; block 115
+
+.define k116 = 4
+L116:   mov ARR[k116], r4
+        ; block 116
+
+.define k117 = 5
+L117:   cmp #k117, L440
+        ; block 117
+
+.define k118 = 6
+L118:   bne L1061
+        ; block 118
+
+.define k119 = 7
+L119:   jsr EXT
+        ; block 119
+
+.define k120 = 0
+L120:   mov ARR[k120], r0
+        ; block 120
+
+.define k121 = 1
+L121:   cmp #k121, L588
+        ; block 121
+
+.define k122 = 2
+L122:   bne L1273
+        ; block 122
+
+.define k123 = 3
+L123:   jsr EXT
+        ; block 123
+
+.define k124 = 4
+L124:   mov ARR[k124], r4
+        ; block 124
+
+.define k125 = 5
+L125:   cmp #k125, L736
+        ; block 125
+
+.define k126 = 6
+L126:   bne L185
+        ; block 126
+
+.define k127 = 7
+L127:   jsr EXT
+        ; block 127
+
+.define k128 = 0
+L128:   mov ARR[k128], r0
+        ; block 128
+
+.define k129 = 1
+L129:   cmp #k129, L884
+        ; block 129
+
+.define k130 = 2
+L130:   bne L397
+        ; block 130
+
+.define k131 = 3
+L131:   jsr EXT
+        ; block 131
+
+.define k132 = 4
+L132:   mov ARR[k132], r4
+        ; block 132
+
+.define k133 = 5
+L133:   cmp #k133, L1032
+        ; block 133
+
+.define k134 = 6
+L134:   bne L609
+        ; block 134
+
+.define k135 = 7
+L135:   jsr EXT
+        ; block 135
+
+.define k136 = 0
+L136:   mov ARR[k136], r0
+        ; block 136
+
+.define k137 = 1
+L137:   cmp #k137, L1180
+        ; block 137
+
+.define k138 = 2
+L138:   bne L821
+        ; block 138
+
+.define k139 = 3
+L139:   jsr EXT
+        ; block 139
+
+.define k140 = 4
+L140:   mov ARR[k140], r4
+        ; block 140
+
+.define k141 = 5
+L141:   cmp #k141, L28
+        ; block 141
+
+.define k142 = 6
+L142:   bne L1033
+        ; block 142
+
+.define k143 = 7
+L143:   jsr EXT
+        ; block 143
+
+.define k144 = 0
+L144:   mov ARR[k144], r0
+        ; block 144
+
+.define k145 = 1
+L145:   cmp #k145, L176
+        ; block 145
+
+.define k146 = 2
+L146:   bne L1245
+        ; block 146
+
+.define k147 = 3
+L147:   jsr EXT
+        ; block 147
+
+.define k148 = 4
+L148:   mov ARR[k148], r4
+        ; block 148
+
+.define k149 = 5
+L149:   cmp #k149, L324
+        ; block 149
+
+.define k150 = 6
+L150:   bne L157
+        ; block 150
+
+.define k151 = 7
+L151:   jsr EXT
+        ; block 151
+
+.define k152 = 0
+L152:   mov ARR[k152], r0
+        ; block 152
+
+.define k153 = 1
+L153:   cmp #k153, L472
+        ; block 153
+
+.define k154 = 2
+L154:   bne L369
+        ; block 154
+
+.define k155 = 3
+L155:   jsr EXT
+        ; block 155
+
+.define k156 = 4
+L156:   mov ARR[k156], r4
+        ; block 156
+
+.define k157 = 5
+L157:   cmp #k157, L620
+        ; block 157
+
+.define k158 = 6
+L158:   bne L581
+        ; block 158
+
+.define k159 = 7
+L159:   jsr EXT
+        ; block 159
+
+.define k160 = 0
+L160:   mov ARR[k160], r0
+        ; block 160
+
+.define k161 = 1
+L161:   cmp #k161, L768
+        ; block 161
+
+.define k162 = 2
+L162:   bne L793
+        ; block 162
+
+.define k163 = 3
+L163:   jsr EXT
+        ; block 163
+
+.define k164 = 4
+L164:   mov ARR[k164], r4
+        ; block 164
+
+.define k165 = 5
+L165:   cmp #k165, L916
+        ; block 165
+
+.define k166 = 6
+L166:   bne L1005
+        ; block 166
+
+.define k167 = 7
+L167:   jsr EXT
+        ; block 167
+
+.define k168 = 0
+L168:   mov ARR[k168], r0
+        ; block 168
+
+.define k169 = 1
+L169:   cmp #k169, L1064
+        ; block 169
+
+.define k170 = 2
+L170:   bne L1217
+        ; block 170
+
+.define k171 = 3
+L171:   jsr EXT
+        ; block 171
+
+.define k172 = 4
+L172:   mov ARR[k172], r4
+        ; block 172
+
+.define k173 = 5
+L173:   cmp #k173, L1212
+        ; block 173
+
+.define k174 = 6
+L174:   bne L129
+        ; block 174
+
+.define k175 = 7
+L175:   jsr EXT
+        ; block 175
+
+.define k176 = 0
+L176:   mov ARR[k176], r0
+        ; block 176
+
+.define k177 = 1
+L177:   cmp #k177, L60
+        ; block 177
+
+.define k178 = 2
+L178:   bne L341
+        ; block 178
+
+.define k179 = 3
+L179:   jsr EXT
+        ; block 179
+
+.define k180 = 4
+L180:   mov ARR[k180], r4
+        ; block 180
+
+.define k181 = 5
+L181:   cmp #k181, L208
+        ; block 181
+
+.define k182 = 6
+L182:   bne L553
+        ; block 182
+
+.define k183 = 7
+L183:   jsr EXT
+        ; block 183
+
+.define k184 = 0
+L184:   mov ARR[k184], r0
+        ; block 184
+
+.define k185 = 1
+L185:   cmp #k185, L356
+        ; block 185
+
+.define k186 = 2
+L186:   bne L765
+        ; block 186
+
+.define k187 = 3
+L187:   jsr EXT
+        ; block 187
+
+.define k188 = 4
+L188:   mov ARR[k188], r4
+        ; block 188
+
+.define k189 = 5
+L189:   cmp #k189, L504
+        ; block 189
+
+.define k190 = 6
+L190:   bne L977
+        ; block 190
+
+.define k191 = 7
+L191:   jsr EXT
+        ; block 191
+
+.define k192 = 0
+L192:   mov ARR[k192], r0
+        ; block 192
+
+.define k193 = 1
+L193:   cmp #k193, L652
+        ; block 193
+
+.define k194 = 2
+L194:   bne L1189
+        ; block 194
+
+.define k195 = 3
+L195:   jsr EXT
+        ; block 195
+
+.define k196 = 4
+L196:   mov ARR[k196], r4
+        ; block 196
+
+.define k197 = 5
+L197:   cmp #k197, L800
+        ; block 197
+
+.define k198 = 6
+L198:   bne L101
+        ; block 198
+
+.define k199 = 7
+L199:   jsr EXT
+        ; block 199
+
+.define k200 = 0
+L200:   mov ARR[k200], r0
+        ; block 200
+
+.define k201 = 1
+L201:   cmp #k201, L948
+        ; block 201
+
+.define k202 = 2
+L202:   bne L313
+        ; block 202
+
+.define k203 = 3
+L203:   jsr EXT
+        ; block 203
+
+.define k204 = 4
+L204:   mov ARR[k204], r4
+        ; block 204
+
+.define k205 = 5
+L205:   cmp #k205, L1096
+        ; block 205
+
+.define k206 = 6
+L206:   bne L525
+        ; block 206
+
+.define k207 = 7
+L207:   jsr EXT
+        ; block 207
+
+.define k208 = 0
+L208:   mov ARR[k208], r0
+        ; block 208
+
+.define k209 = 1
+L209:   cmp #k209, L1244
+        ; block 209
+
+.define k210 = 2
+L210:   bne L737
+        ; block 210
+
+.define k211 = 3
+L211:   jsr EXT
+        ; block 211
+
+.define k212 = 4
+L212:   mov ARR[k212], r4
+        ; block 212
+
+.define k213 = 5
+L213:   cmp #k213, L92
+        ; block 213
+
+.define k214 = 6
+L214:   bne L949
+        ; block 214
+
+.define k215 = 7
+L215:   jsr EXT
+        ; block 215
+
+.define k216 = 0
+L216:   mov ARR[k216], r0
+        ; block 216
+
+.define k217 = 1
+L217:   cmp #k217, L240
+        ; block 217
+
+.define k218 = 2
+L218:   bne L1161
+        ; block 218
+
+.define k219 = 3
+L219:   jsr EXT
+        ; block 219
+
+.define k220 = 4
+L220:   mov ARR[k220], r4
+        ; block 220
+
+.define k221 = 5
+L221:   cmp #k221, L388
+        ; block 221
+
+.define k222 = 6
+L222:   bne L73
+        ; block 222
+
+.define k223 = 7
+L223:   jsr EXT
+        ; block 223
+
+.define k224 = 0
+L224:   mov ARR[k224], r0
+        ; block 224
+
+.define k225 = 1
+L225:   cmp #k225, L536
+        ; block 225
+
+.define k226 = 2
+L226:   bne L285
+        ; block 226
+
+.define k227 = 3
+L227:   jsr EXT
+        ; block 227
+
+.define k228 = 4
+L228:   mov ARR[k228], r4
+        ; block 228
+
+.define k229 = 5
+L229:   cmp #k229, L684
+        ; block 229
+
+.define k230 = 6
+L230:   bne L497
+        ; block 230
+
+.define k231 = 7
+L231:   jsr EXT
+        ; block 231
+
+.define k232 = 0
+L232:   mov ARR[k232], r0
+        ; block 232
+
+.define k233 = 1
+L233:   cmp #k233, L832
+        ; block 233
+
+.define k234 = 2
+L234:   bne L709
+        ; block 234
+
+.define k235 = 3
+L235:   jsr EXT
+        ; block 235
+
+.define k236 = 4
+L236:   mov ARR[k236], r4
+        ; block 236
+
+.define k237 = 5
+L237:   cmp #k237, L980
+        ; block 237
+
+.define k238 = 6
+L238:   bne L921
+        ; block 238
+
+.define k239 = 7
+L239:   jsr EXT
+        ; block 239
+
+.define k240 = 0
+L240:   mov ARR[k240], r0
+        ; block 240
+
+.define k241 = 1
+L241:   cmp #k241, L1128
+        ; block 241
+
+.define k242 = 2
+L242:   bne L1133
+        ; block 242
+
+.define k243 = 3
+L243:   jsr EXT
+        ; block 243
+
+.define k244 = 4
+L244:   mov ARR[k244], r4
+        ; block 244
+
+.define k245 = 5
+L245:   cmp #k245, L1276
+        ; block 245
+
+.define k246 = 6
+L246:   bne L45
+        ; block 246
+
+.define k247 = 7
+L247:   jsr EXT
+        ; block 247
+
+.define k248 = 0
+L248:   mov ARR[k248], r0
+        ; block 248
+
+.define k249 = 1
+L249:   cmp #k249, L124
+        ; block 249
+
+.define k250 = 2
+L250:   bne L257
+        ; block 250
+
+.define k251 = 3
+L251:   jsr EXT
+        ; block 251
+
+.define k252 = 4
+L252:   mov ARR[k252], r4
+        ; block 252
+
+.define k253 = 5
+L253:   cmp #k253, L272
+        ; block 253
+
+.define k254 = 6
+L254:   bne L469
+        ; block 254
+
+.define k255 = 7
+L255:   jsr EXT
+        ; block 255
+
+.define k256 = 0
+L256:   mov ARR[k256], r0
+        ; block 256
+
+.define k257 = 1
+L257:   cmp #k257, L420
+        ; block 257
+
+.define k258 = 2
+L258:   bne L681
+        ; block 258
+
+.define k259 = 3
+L259:   jsr EXT
+        ; block 259
+
+.define k260 = 4
+L260:   mov ARR[k260], r4
+        ; block 260
+
+.define k261 = 5
+L261:   cmp #k261, L568
+        ; block 261
+
+.define k262 = 6
+L262:   bne L893
+        ; block 262
+
+.define k263 = 7
+L263:   jsr EXT
+        ; block 263
+
+.define k264 = 0
+L264:   mov ARR[k264], r0
+        ; block 264
+
+.define k265 = 1
+L265:   cmp #k265, L716
+        ; block 265
+
+.define k266 = 2
+L266:   bne L1105
+        ; block 266
+
+.define k267 = 3
+L267:   jsr EXT
+        ; block 267
+
+.define k268 = 4
+L268:   mov ARR[k268], r4
+        ; block 268
+
+.define k269 = 5
+L269:   cmp #k269, L864
+        ; block 269
+
+.define k270 = 6
+L270:   bne L17
+        ; block 270
+
+.define k271 = 7
+L271:   jsr EXT
+        ; block 271
+
+.define k272 = 0
+L272:   mov ARR[k272], r0
+        ; block 272
+
+.define k273 = 1
+L273:   cmp #k273, L1012
+        ; block 273
+
+.define k274 = 2
+L274:   bne L229
+        ; block 274
+
+.define k275 = 3
+L275:   jsr EXT
+        ; block 275
+
+.define k276 = 4
+L276:   mov ARR[k276], r4
+        ; block 276
+
+.define k277 = 5
+L277:   cmp #k277, L1160
+        ; block 277
+
+.define k278 = 6
+L278:   bne L441
+        ; block 278
+
+.define k279 = 7
+L279:   jsr EXT
+        ; block 279
+
+.define k280 = 0
+L280:   mov ARR[k280], r0
+        ; block 280
+
+.define k281 = 1
+L281:   cmp #k281, L8
+        ; block 281
+
+.define k282 = 2
+L282:   bne L653
+        ; block 282
+
+.define k283 = 3
+L283:   jsr EXT
+        ; block 283
+
+.define k284 = 4
+L284:   mov ARR[k284], r4
+        ; block 284
+
+.define k285 = 5
+L285:   cmp #k285, L156
+        ; block 285
+
+.define k286 = 6
+L286:   bne L865
+        ; block 286
+
+.define k287 = 7
+L287:   jsr EXT
+        ; block 287
+
+.define k288 = 0
+L288:   mov ARR[k288], r0
+        ; block 288
+
+.define k289 = 1
+L289:   cmp #k289, L304
+        ; block 289
+
+.define k290 = 2
+L290:   bne L1077
+        ; block 290
+
+.define k291 = 3
+L291:   jsr EXT
+        ; block 291
+
+.define k292 = 4
+L292:   mov ARR[k292], r4
+        ; block 292
+
+.define k293 = 5
+L293:   cmp #k293, L452
+        ; block 293
+
+.define k294 = 6
+L294:   bne L1289
+        ; block 294
+
+.define k295 = 7
+L295:   jsr EXT
+        ; block 295
+
+.define k296 = 0
+L296:   mov ARR[k296], r0
+        ; block 296
+
+.define k297 = 1
+L297:   cmp #k297, L600
+        ; block 297
+
+.define k298 = 2
+L298:   bne L201
+        ; block 298
+
+.define k299 = 3
+L299:   jsr EXT
+        ; block 299
+
+.define k300 = 4
+L300:   mov ARR[k300], r4
+        ; block 300
+
+.define k301 = 5
+L301:   cmp #k301, L748
+        ; block 301
+
+.define k302 = 6
+L302:   bne L413
+        ; block 302
+
+.define k303 = 7
+L303:   jsr EXT
+        ; block 303
+
+.define k304 = 0
+L304:   mov ARR[k304], r0
+        ; block 304
+
+.define k305 = 1
+L305:   cmp #k305, L896
+        ; block 305
+
+.define k306 = 2
+L306:   bne L625
+        ; block 306
+
+.define k307 = 3
+L307:   jsr EXT
+        ; block 307
+
+.define k308 = 4
+L308:   mov ARR[k308], r4
+        ; block 308
+
+.define k309 = 5
+L309:   cmp #k309, L1044
+        ; block 309
+
+.define k310 = 6
+L310:   bne L837
+        ; block 310
+
+.define k311 = 7
+L311:   jsr EXT
+        ; block 311
+
+.define k312 = 0
+L312:   mov ARR[k312], r0
+        ; block 312
+
+.define k313 = 1
+L313:   cmp #k313, L1192
+        ; block 313
+
+.define k314 = 2
+L314:   bne L1049
+        ; block 314
+
+.define k315 = 3
+L315:   jsr EXT
+        ; block 315
+
+.define k316 = 4
+L316:   mov ARR[k316], r4
+        ; block 316
+
+.define k317 = 5
+L317:   cmp #k317, L40
+        ; block 317
+
+.define k318 = 6
+L318:   bne L1261
+        ; block 318
+
+.define k319 = 7
+L319:   jsr EXT
+        ; block 319
+
+.define k320 = 0
+L320:   mov ARR[k320], r0
+        ; block 320
+
+.define k321 = 1
+L321:   cmp #k321, L188
+        ; block 321
+
+.define k322 = 2
+L322:   bne L173
+        ; block 322
+
+.define k323 = 3
+L323:   jsr EXT
+        ; block 323
+
+.define k324 = 4
+L324:   mov ARR[k324], r4
+        ; block 324
+
+.define k325 = 5
+L325:   cmp #k325, L336
+        ; block 325
+
+.define k326 = 6
+L326:   bne L385
+        ; block 326
+
+.define k327 = 7
+L327:   jsr EXT
+        ; block 327
+
+.define k328 = 0
+L328:   mov ARR[k328], r0
+        ; block 328
+
+.define k329 = 1
+L329:   cmp #k329, L484
+        ; block 329
+
+.define k330 = 2
+L330:   bne L597
+        ; block 330
+
+.define k331 = 3
+L331:   jsr EXT
+        ; block 331
+
+.define k332 = 4
+L332:   mov ARR[k332], r4
+        ; block 332
+
+.define k333 = 5
+L333:   cmp #k333, L632
+        ; block 333
+
+.define k334 = 6
+L334:   bne L809
+        ; block 334
+
+.define k335 = 7
+L335:   jsr EXT
+        ; block 335
+
+.define k336 = 0
+L336:   mov ARR[k336], r0
+        ; block 336
+
+.define k337 = 1
+L337:   cmp #k337, L780
+        ; block 337
+
+.define k338 = 2
+L338:   bne L1021
+        ; block 338
+
+.define k339 = 3
+L339:   jsr EXT
+        ; block 339
+
+.define k340 = 4
+L340:   mov ARR[k340], r4
+        ; block 340
+
+.define k341 = 5
+L341:   cmp #k341, L928
+        ; block 341
+
+.define k342 = 6
+L342:   bne L1233
+        ; block 342
+
+.define k343 = 7
+L343:   jsr EXT
+        ; block 343
+
+.define k344 = 0
+L344:   mov ARR[k344], r0
+        ; block 344
+
+.define k345 = 1
+L345:   cmp #k345, L1076
+        ; block 345
+
+.define k346 = 2
+L346:   bne L145
+        ; block 346
+
+.define k347 = 3
+L347:   jsr EXT
+        ; block 347
+
+.define k348 = 4
+L348:   mov ARR[k348], r4
+        ; block 348
+
+.define k349 = 5
+L349:   cmp #k349, L1224
+        ; block 349
+
+.define k350 = 6
+L350:   bne L357
+        ; block 350
+
+.define k351 = 7
+L351:   jsr EXT
+        ; block 351
+
+.define k352 = 0
+L352:   mov ARR[k352], r0
+        ; block 352
+
+.define k353 = 1
+L353:   cmp #k353, L72
+        ; block 353
+
+.define k354 = 2
+L354:   bne L569
+        ; block 354
+
+.define k355 = 3
+L355:   jsr EXT
+        ; block 355
+
+.define k356 = 4
+L356:   mov ARR[k356], r4
+        ; block 356
+
+.define k357 = 5
+L357:   cmp #k357, L220
+        ; block 357
+
+.define k358 = 6
+L358:   bne L781
+        ; block 358
+
+.define k359 = 7
+L359:   jsr EXT
+        ; block 359
+
+.define k360 = 0
+L360:   mov ARR[k360], r0
+        ; block 360
+
+.define k361 = 1
+L361:   cmp #k361, L368
+        ; block 361
+
+.define k362 = 2
+L362:   bne L993
+        ; block 362
+
+.define k363 = 3
+L363:   jsr EXT
+        ; block 363
+
+.define k364 = 4
+L364:   mov ARR[k364], r4
+        ; block 364
+
+.define k365 = 5
+L365:   cmp #k365, L516
+        ; block 365
+
+.define k366 = 6
+L366:   bne L1205
+        ; block 366
+
+.define k367 = 7
+L367:   jsr EXT
+        ; block 367
+
+.define k368 = 0
+L368:   mov ARR[k368], r0
+        ; block 368
+
+.define k369 = 1
+L369:   cmp #k369, L664
+        ; block 369
+
+.define k370 = 2
+L370:   bne L117
+        ; block 370
+
+.define k371 = 3
+L371:   jsr EXT
+        ; block 371
+
+.define k372 = 4
+L372:   mov ARR[k372], r4
+        ; block 372
+
+.define k373 = 5
+L373:   cmp #k373, L812
+        ; block 373
+
+.define k374 = 6
+L374:   bne L329
+        ; block 374
+
+.define k375 = 7
+L375:   jsr EXT
+        ; block 375
+
+.define k376 = 0
+L376:   mov ARR[k376], r0
+        ; block 376
+
+.define k377 = 1
+L377:   cmp #k377, L960
+        ; block 377
+
+.define k378 = 2
+L378:   bne L541
+        ; block 378
+
+.define k379 = 3
+L379:   jsr EXT
+        ; block 379
+
+.define k380 = 4
+L380:   mov ARR[k380], r4
+        ; block 380
+
+.define k381 = 5
+L381:   cmp #k381, L1108
+        ; block 381
+
+.define k382 = 6
+L382:   bne L753
+        ; block 382
+
+.define k383 = 7
+L383:   jsr EXT
+        ; block 383
+
+.define k384 = 0
+L384:   mov ARR[k384], r0
+        ; block 384
+
+.define k385 = 1
+L385:   cmp #k385, L1256
+        ; block 385
+
+.define k386 = 2
+L386:   bne L965
+        ; block 386
+
+.define k387 = 3
+L387:   jsr EXT
+        ; block 387
+
+.define k388 = 4
+L388:   mov ARR[k388], r4
+        ; block 388
+
+.define k389 = 5
+L389:   cmp #k389, L104
+        ; block 389
+
+.define k390 = 6
+L390:   bne L1177
+        ; block 390
+
+.define k391 = 7
+L391:   jsr EXT
+        ; block 391
+
+.define k392 = 0
+L392:   mov ARR[k392], r0
+        ; block 392
+
+.define k393 = 1
+L393:   cmp #k393, L252
+        ; block 393
+
+.define k394 = 2
+L394:   bne L89
+        ; block 394
+
+.define k395 = 3
+L395:   jsr EXT
+        ; block 395
+
+.define k396 = 4
+L396:   mov ARR[k396], r4
+        ; block 396
+
+.define k397 = 5
+L397:   cmp #k397, L400
+        ; block 397
+
+.define k398 = 6
+L398:   bne L301
+        ; block 398
+
+.define k399 = 7
+L399:   jsr EXT
+        ; block 399
+
+.define k400 = 0
+L400:   mov ARR[k400], r0
+        ; block 400
+
+.define k401 = 1
+L401:   cmp #k401, L548
+        ; block 401
+
+.define k402 = 2
+L402:   bne L513
+        ; block 402
+
+.define k403 = 3
+L403:   jsr EXT
+        ; block 403
+
+.define k404 = 4
+L404:   mov ARR[k404], r4
+        ; block 404
+
+.define k405 = 5
+L405:   cmp #k405, L696
+        ; block 405
+
+.define k406 = 6
+L406:   bne L725
+        ; block 406
+
+.define k407 = 7
+L407:   jsr EXT
+        ; block 407
+
+.define k408 = 0
+L408:   mov ARR[k408], r0
+        ; block 408
+
+.define k409 = 1
+L409:   cmp #k409, L844
+        ; block 409
+
+.define k410 = 2
+L410:   bne L937
+        ; block 410
+
+.define k411 = 3
+L411:   jsr EXT
+        ; block 411
+
+.define k412 = 4
+L412:   mov ARR[k412], r4
+        ; block 412
+
+.define k413 = 5
+L413:   cmp #k413, L992
+        ; block 413
+
+.define k414 = 6
+L414:   bne L1149
+        ; block 414
+
+.define k415 = 7
+L415:   jsr EXT
+        ; block 415
+
+.define k416 = 0
+L416:   mov ARR[k416], r0
+        ; block 416
+
+.define k417 = 1
+L417:   cmp #k417, L1140
+        ; block 417
+
+.define k418 = 2
+L418:   bne L61
+        ; block 418
+
+.define k419 = 3
+L419:   jsr EXT
+        ; block 419
+
+.define k420 = 4
+L420:   mov ARR[k420], r4
+        ; block 420
+
+.define k421 = 5
+L421:   cmp #k421, L1288
+        ; block 421
+
+.define k422 = 6
+L422:   bne L273
+        ; block 422
+
+.define k423 = 7
+L423:   jsr EXT
+        ; block 423
+
+.define k424 = 0
+L424:   mov ARR[k424], r0
+        ; block 424
+
+.define k425 = 1
+L425:   cmp #k425, L136
+        ; block 425
+
+.define k426 = 2
+L426:   bne L485
+        ; block 426
+
+.define k427 = 3
+L427:   jsr EXT
+        ; block 427
+
+.define k428 = 4
+L428:   mov ARR[k428], r4
+        ; block 428
+
+.define k429 = 5
+L429:   cmp #k429, L284
+        ; block 429
+
+.define k430 = 6
+L430:   bne L697
+        ; block 430
+
+.define k431 = 7
+L431:   jsr EXT
+        ; block 431
+
+.define k432 = 0
+L432:   mov ARR[k432], r0
+        ; block 432
+
+.define k433 = 1
+L433:   cmp #k433, L432
+        ; block 433
+
+.define k434 = 2
+L434:   bne L909
+        ; block 434
+
+.define k435 = 3
+L435:   jsr EXT
+        ; block 435
+
+.define k436 = 4
+L436:   mov ARR[k436], r4
+        ; block 436
+
+.define k437 = 5
+L437:   cmp #k437, L580
+        ; block 437
+
+.define k438 = 6
+L438:   bne L1121
+        ; block 438
+
+.define k439 = 7
+L439:   jsr EXT
+        ; block 439
+
+.define k440 = 0
+L440:   mov ARR[k440], r0
+        ; block 440
+
+.define k441 = 1
+L441:   cmp #k441, L728
+        ; block 441
+
+.define k442 = 2
+L442:   bne L33
+        ; block 442
+
+.define k443 = 3
+L443:   jsr EXT
+        ; block 443
+
+.define k444 = 4
+L444:   mov ARR[k444], r4
+        ; block 444
+
+.define k445 = 5
+L445:   cmp #k445, L876
+        ; block 445
+
+.define k446 = 6
+L446:   bne L245
+        ; block 446
+
+.define k447 = 7
+L447:   jsr EXT
+        ; block 447
+
+.define k448 = 0
+L448:   mov ARR[k448], r0
+        ; block 448
+
+.define k449 = 1
+L449:   cmp #k449, L1024
+        ; block 449
+
+.define k450 = 2
+L450:   bne L457
+        ; block 450
+
+.define k451 = 3
+L451:   jsr EXT
+        ; block 451
+
+.define k452 = 4
+L452:   mov ARR[k452], r4
+        ; block 452
+
+.define k453 = 5
+L453:   cmp #k453, L1172
+        ; block 453
+
+.define k454 = 6
+L454:   bne L669
+        ; block 454
+
+.define k455 = 7
+L455:   jsr EXT
+        ; block 455
+
+.define k456 = 0
+L456:   mov ARR[k456], r0
+        ; block 456
+
+.define k457 = 1
+L457:   cmp #k457, L20
+        ; block 457
+
+.define k458 = 2
+L458:   bne L881
+        ; block 458
+
+.define k459 = 3
+L459:   jsr EXT
+        ; block 459
+
+.define k460 = 4
+L460:   mov ARR[k460], r4
+        ; block 460
+
+.define k461 = 5
+L461:   cmp #k461, L168
+        ; block 461
+
+.define k462 = 6
+L462:   bne L1093
+        ; block 462
+
+.define k463 = 7
+L463:   jsr EXT
+        ; block 463
+
+.define k464 = 0
+L464:   mov ARR[k464], r0
+        ; block 464
+
+.define k465 = 1
+L465:   cmp #k465, L316
+        ; block 465
+
+.define k466 = 2
+L466:   bne L5
+        ; block 466
+
+.define k467 = 3
+L467:   jsr EXT
+        ; block 467
+
+.define k468 = 4
+L468:   mov ARR[k468], r4
+        ; block 468
+
+.define k469 = 5
+L469:   cmp #k469, L464
+        ; block 469
+
+.define k470 = 6
+L470:   bne L217
+        ; block 470
+
+.define k471 = 7
+L471:   jsr EXT
+        ; block 471
+
+.define k472 = 0
+L472:   mov ARR[k472], r0
+        ; block 472
+
+.define k473 = 1
+L473:   cmp #k473, L612
+        ; block 473
+
+.define k474 = 2
+L474:   bne L429
+        ; block 474
+
+.define k475 = 3
+L475:   jsr EXT
+        ; block 475
+
+.define k476 = 4
+L476:   mov ARR[k476], r4
+        ; block 476
+
+.define k477 = 5
+L477:   cmp #k477, L760
+        ; block 477
+
+.define k478 = 6
+L478:   bne L641
+        ; block 478
+
+.define k479 = 7
+L479:   jsr EXT
+        ; block 479
+
+.define k480 = 0
+L480:   mov ARR[k480], r0
+        ; block 480
+
+.define k481 = 1
+L481:   cmp #k481, L908
+        ; block 481
+
+.define k482 = 2
+L482:   bne L853
+        ; block 482
+
+.define k483 = 3
+L483:   jsr EXT
+        ; block 483
+
+.define k484 = 4
+L484:   mov ARR[k484], r4
+        ; block 484
+
+.define k485 = 5
+L485:   cmp #k485, L1056
+        ; block 485
+
+.define k486 = 6
+L486:   bne L1065
+        ; block 486
+
+.define k487 = 7
+L487:   jsr EXT
+        ; block 487
+
+.define k488 = 0
+L488:   mov ARR[k488], r0
+        ; block 488
+
+.define k489 = 1
+L489:   cmp #k489, L1204
+        ; block 489
+
+.define k490 = 2
+L490:   bne L1277
+        ; block 490
+
+.define k491 = 3
+L491:   jsr EXT
+        ; block 491
+
+.define k492 = 4
+L492:   mov ARR[k492], r4
+        ; block 492
+
+.define k493 = 5
+L493:   cmp #k493, L52
+        ; block 493
+
+.define k494 = 6
+L494:   bne L189
+        ; block 494
+
+.define k495 = 7
+L495:   jsr EXT
+        ; block 495
+
+.define k496 = 0
+L496:   mov ARR[k496], r0
+        ; block 496
+
+.define k497 = 1
+L497:   cmp #k497, L200
+        ; block 497
+
+.define k498 = 2
+L498:   bne L401
+        ; block 498
+
+.define k499 = 3
+L499:   jsr EXT
+        ; block 499
+
+.define k500 = 4
+L500:   mov ARR[k500], r4
+        ; block 500
+
+.define k501 = 5
+L501:   cmp #k501, L348
+        ; block 501
+
+.define k502 = 6
+L502:   bne L613
+        ; block 502
+
+.define k503 = 7
+L503:   jsr EXT
+        ; block 503
+
+.define k504 = 0
+L504:   mov ARR[k504], r0
+        ; block 504
+
+.define k505 = 1
+L505:   cmp #k505, L496
+        ; block 505
+
+.define k506 = 2
+L506:   bne L825
+        ; block 506
+
+.define k507 = 3
+L507:   jsr EXT
+        ; block 507
+
+.define k508 = 4
+L508:   mov ARR[k508], r4
+        ; block 508
+
+.define k509 = 5
+L509:   cmp #k509, L644
+        ; block 509
+
+.define k510 = 6
+L510:   bne L1037
+        ; block 510
+
+.define k511 = 7
+L511:   jsr EXT
+        ; block 511
+
+.define k512 = 0
+L512:   mov ARR[k512], r0
+        ; block 512
+
+.define k513 = 1
+L513:   cmp #k513, L792
+        ; block 513
+
+.define k514 = 2
+L514:   bne L1249
+        ; block 514
+
+.define k515 = 3
+L515:   jsr EXT
+        ; block 515
+
+.define k516 = 4
+L516:   mov ARR[k516], r4
+        ; block 516
+
+.define k517 = 5
+L517:   cmp #k517, L940
+        ; block 517
+
+.define k518 = 6
+L518:   bne L161
+        ; block 518
+
+.define k519 = 7
+L519:   jsr EXT
+        ; block 519
+
+.define k520 = 0
+L520:   mov ARR[k520], r0
+        ; block 520
+
+.define k521 = 1
+L521:   cmp #k521, L1088
+        ; block 521
+
+.define k522 = 2
+L522:   bne L373
+        ; block 522
+
+.define k523 = 3
+L523:   jsr EXT
+        ; block 523
+
+.define k524 = 4
+L524:   mov ARR[k524], r4
+        ; block 524
+
+.define k525 = 5
+L525:   cmp #k525, L1236
+        ; block 525
+
+.define k526 = 6
+L526:   bne L585
+        ; block 526
+
+.define k527 = 7
+L527:   jsr EXT
+        ; block 527
+
+.define k528 = 0
+L528:   mov ARR[k528], r0
+        ; block 528
+
+.define k529 = 1
+L529:   cmp #k529, L84
+        ; block 529
+
+.define k530 = 2
+L530:   bne L797
+        ; block 530
+
+.define k531 = 3
+L531:   jsr EXT
+        ; block 531
+
+.define k532 = 4
+L532:   mov ARR[k532], r4
+        ; block 532
+
+.define k533 = 5
+L533:   cmp #k533, L232
+        ; block 533
+
+.define k534 = 6
+L534:   bne L1009
+        ; block 534
+
+.define k535 = 7
+L535:   jsr EXT
+        ; block 535
+
+.define k536 = 0
+L536:   mov ARR[k536], r0
+        ; block 536
+
+.define k537 = 1
+L537:   cmp #k537, L380
+        ; block 537
+
+.define k538 = 2
+L538:   bne L1221
+        ; block 538
+
+.define k539 = 3
+L539:   jsr EXT
+        ; block 539
+
+.define k540 = 4
+L540:   mov ARR[k540], r4
+        ; block 540
+
+.define k541 = 5
+L541:   cmp #k541, L528
+        ; block 541
+
+.define k542 = 6
+L542:   bne L133
+        ; block 542
+
+.define k543 = 7
+L543:   jsr EXT
+        ; block 543
+
+.define k544 = 0
+L544:   mov ARR[k544], r0
+        ; block 544
+
+.define k545 = 1
+L545:   cmp #k545, L676
+        ; block 545
+
+.define k546 = 2
+L546:   bne L345
+        ; block 546
+
+.define k547 = 3
+L547:   jsr EXT
+        ; block 547
+
+.define k548 = 4
+L548:   mov ARR[k548], r4
+        ; block 548
+
+.define k549 = 5
+L549:   cmp #k549, L824
+        ; block 549
+
+.define k550 = 6
+L550:   bne L557
+        ; block 550
+
+.define k551 = 7
+L551:   jsr EXT
+        ; block 551
+
+.define k552 = 0
+L552:   mov ARR[k552], r0
+        ; block 552
+
+.define k553 = 1
+L553:   cmp #k553, L972
+        ; block 553
+
+.define k554 = 2
+L554:   bne L769
+        ; block 554
+
+.define k555 = 3
+L555:   jsr EXT
+        ; block 555
+
+.define k556 = 4
+L556:   mov ARR[k556], r4
+        ; block 556
+
+.define k557 = 5
+L557:   cmp #k557, L1120
+        ; block 557
+
+.define k558 = 6
+L558:   bne L981
+        ; block 558
+
+.define k559 = 7
+L559:   jsr EXT
+        ; block 559
+
+.define k560 = 0
+L560:   mov ARR[k560], r0
+        ; block 560
+
+.define k561 = 1
+L561:   cmp #k561, L1268
+        ; block 561
+
+.define k562 = 2
+L562:   bne L1193
+        ; block 562
+
+.define k563 = 3
+L563:   jsr EXT
+        ; block 563
+
+.define k564 = 4
+L564:   mov ARR[k564], r4
+        ; block 564
+
+.define k565 = 5
+L565:   cmp #k565, L116
+        ; block 565
+
+.define k566 = 6
+L566:   bne L105
+        ; block 566
+
+.define k567 = 7
+L567:   jsr EXT
+        ; block 567
+
+.define k568 = 0
+L568:   mov ARR[k568], r0
+        ; block 568
+
+.define k569 = 1
+L569:   cmp #k569, L264
+        ; block 569
+
+.define k570 = 2
+L570:   bne L317
+        ; block 570
+
+.define k571 = 3
+L571:   jsr EXT
+        ; block 571
+
+.define k572 = 4
+L572:   mov ARR[k572], r4
+        ; block 572
+
+.define k573 = 5
+L573:   cmp #k573, L412
+        ; block 573
+
+.define k574 = 6
+L574:   bne L529
+        ; block 574
+
+.define k575 = 7
+L575:   jsr EXT
+        ; block 575
+
+.define k576 = 0
+L576:   mov ARR[k576], r0
+        ; block 576
+
+.define k577 = 1
+L577:   cmp #k577, L560
+        ; block 577
+
+.define k578 = 2
+L578:   bne L741
+        ; block 578
+
+.define k579 = 3
+L579:   jsr EXT
+        ; block 579
+
+.define k580 = 4
+L580:   mov ARR[k580], r4
+        ; block 580
+
+.define k581 = 5
+L581:   cmp #k581, L708
+        ; block 581
+
+.define k582 = 6
+L582:   bne L953
+        ; block 582
+
+.define k583 = 7
+L583:   jsr EXT
+        ; block 583
+
+.define k584 = 0
+L584:   mov ARR[k584], r0
+        ; block 584
+
+.define k585 = 1
+L585:   cmp #k585, L856
+        ; block 585
+
+.define k586 = 2
+L586:   bne L1165
+        ; block 586
+
+.define k587 = 3
+L587:   jsr EXT
+        ; block 587
+
+.define k588 = 4
+L588:   mov ARR[k588], r4
+        ; block 588
+
+.define k589 = 5
+L589:   cmp #k589, L1004
+        ; block 589
+
+.define k590 = 6
+L590:   bne L77
+        ; block 590
+
+.define k591 = 7
+L591:   jsr EXT
+        ; block 591
+
+.define k592 = 0
+L592:   mov ARR[k592], r0
+        ; block 592
+
+.define k593 = 1
+L593:   cmp #k593, L1152
+        ; block 593
+
+.define k594 = 2
+L594:   bne L289
+        ; block 594
+
+.define k595 = 3
+L595:   jsr EXT
+        ; block 595
+
+.define k596 = 4
+L596:   mov ARR[k596], r4
+        ; block 596
+
+.define k597 = 5
+L597:   cmp #k597, L0
+        ; block 597
+
+.define k598 = 6
+L598:   bne L501
+        ; block 598
+
+.define k599 = 7
+L599:   jsr EXT
+        ; block 599
+
+.define k600 = 0
+L600:   mov ARR[k600], r0
+        ; block 600
+
+.define k601 = 1
+L601:   cmp #k601, L148
+        ; block 601
+
+.define k602 = 2
+L602:   bne L713
+        ; block 602
+
+.define k603 = 3
+L603:   jsr EXT
+        ; block 603
+
+.define k604 = 4
+L604:   mov ARR[k604], r4
+        ; block 604
+
+.define k605 = 5
+L605:   cmp #k605, L296
+        ; block 605
+
+.define k606 = 6
+L606:   bne L925
+        ; block 606
+
+.define k607 = 7
+L607:   jsr EXT
+        ; block 607
+
+.define k608 = 0
+L608:   mov ARR[k608], r0
+        ; block 608
+
+.define k609 = 1
+L609:   cmp #k609, L444
+        ; block 609
+
+.define k610 = 2
+L610:   bne L1137
+        ; block 610
+
+.define k611 = 3
+L611:   jsr EXT
+        ; block 611
+
+.define k612 = 4
+L612:   mov ARR[k612], r4
+        ; block 612
+
+.define k613 = 5
+L613:   cmp #k613, L592
+        ; block 613
+
+.define k614 = 6
+L614:   bne L49
+        ; block 614
+
+.define k615 = 7
+L615:   jsr EXT
+        ; block 615
+
+.define k616 = 0
+L616:   mov ARR[k616], r0
+        ; block 616
+
+.define k617 = 1
+L617:   cmp #k617, L740
+        ; block 617
+
+.define k618 = 2
+L618:   bne L261
+        ; block 618
+
+.define k619 = 3
+L619:   jsr EXT
+        ; block 619
+
+.define k620 = 4
+L620:   mov ARR[k620], r4
+        ; block 620
+
+.define k621 = 5
+L621:   cmp #k621, L888
+        ; block 621
+
+.define k622 = 6
+L622:   bne L473
+        ; block 622
+
+.define k623 = 7
+L623:   jsr EXT
+        ; block 623
+
+.define k624 = 0
+L624:   mov ARR[k624], r0
+        ; block 624
+
+.define k625 = 1
+L625:   cmp #k625, L1036
+        ; block 625
+
+.define k626 = 2
+L626:   bne L685
+        ; block 626
+
+.define k627 = 3
+L627:   jsr EXT
+        ; block 627
+
+.define k628 = 4
+L628:   mov ARR[k628], r4
+        ; block 628
+
+.define k629 = 5
+L629:   cmp #k629, L1184
+        ; block 629
+
+.define k630 = 6
+L630:   bne L897
+        ; block 630
+
+.define k631 = 7
+L631:   jsr EXT
+        ; block 631
+
+.define k632 = 0
+L632:   mov ARR[k632], r0
+        ; block 632
+
+.define k633 = 1
+L633:   cmp #k633, L32
+        ; block 633
+
+.define k634 = 2
+L634:   bne L1109
+        ; block 634
+
+.define k635 = 3
+L635:   jsr EXT
+        ; block 635
+
+.define k636 = 4
+L636:   mov ARR[k636], r4
+        ; block 636
+
+.define k637 = 5
+L637:   cmp #k637, L180
+        ; block 637
+
+.define k638 = 6
+L638:   bne L21
+        ; block 638
+
+.define k639 = 7
+L639:   jsr EXT
+        ; block 639
+
+.define k640 = 0
+L640:   mov ARR[k640], r0
+        ; block 640
+
+.define k641 = 1
+L641:   cmp #k641, L328
+        ; block 641
+
+.define k642 = 2
+L642:   bne L233
+        ; block 642
+
+.define k643 = 3
+L643:   jsr EXT
+        ; block 643
+
+.define k644 = 4
+L644:   mov ARR[k644], r4
+        ; block 644
+
+.define k645 = 5
+L645:   cmp #k645, L476
+        ; block 645
+
+.define k646 = 6
+L646:   bne L445
+        ; block 646
+
+.define k647 = 7
+L647:   jsr EXT
+        ; block 647
+
+.define k648 = 0
+L648:   mov ARR[k648], r0
+        ; block 648
+
+.define k649 = 1
+L649:   cmp #k649, L624
+        ; block 649
+
+.define k650 = 2
+L650:   bne L657
+        ; block 650
+
+.define k651 = 3
+L651:   jsr EXT
+        ; block 651
+
+.define k652 = 4
+L652:   mov ARR[k652], r4
+        ; block 652
+
+.define k653 = 5
+L653:   cmp #k653, L772
+        ; block 653
+
+.define k654 = 6
+L654:   bne L869
+        ; block 654
+
+.define k655 = 7
+L655:   jsr EXT
+        ; block 655
+
+.define k656 = 0
+L656:   mov ARR[k656], r0
+        ; block 656
+
+.define k657 = 1
+L657:   cmp #k657, L920
+        ; block 657
+
+.define k658 = 2
+L658:   bne L1081
+        ; block 658
+
+.define k659 = 3
+L659:   jsr EXT
+        ; block 659
+
+.define k660 = 4
+L660:   mov ARR[k660], r4
+        ; block 660
+
+.define k661 = 5
+L661:   cmp #k661, L1068
+        ; block 661
+
+.define k662 = 6
+L662:   bne L1293
+        ; block 662
+
+.define k663 = 7
+L663:   jsr EXT
+        ; block 663
+
+.define k664 = 0
+L664:   mov ARR[k664], r0
+        ; block 664
+
+.define k665 = 1
+L665:   cmp #k665, L1216
+        ; block 665
+
+.define k666 = 2
+L666:   bne L205
+        ; block 666
+
+.define k667 = 3
+L667:   jsr EXT
+        ; block 667
+
+.define k668 = 4
+L668:   mov ARR[k668], r4
+        ; block 668
+
+.define k669 = 5
+L669:   cmp #k669, L64
+        ; block 669
+
+.define k670 = 6
+L670:   bne L417
+        ; block 670
+
+.define k671 = 7
+L671:   jsr EXT
+        ; block 671
+
+.define k672 = 0
+L672:   mov ARR[k672], r0
+        ; block 672
+
+.define k673 = 1
+L673:   cmp #k673, L212
+        ; block 673
+
+.define k674 = 2
+L674:   bne L629
+        ; block 674
+
+.define k675 = 3
+L675:   jsr EXT
+        ; block 675
+
+.define k676 = 4
+L676:   mov ARR[k676], r4
+        ; block 676
+
+.define k677 = 5
+L677:   cmp #k677, L360
+        ; block 677
+
+.define k678 = 6
+L678:   bne L841
+        ; block 678
+
+.define k679 = 7
+L679:   jsr EXT
+        ; block 679
+
+.define k680 = 0
+L680:   mov ARR[k680], r0
+        ; block 680
+
+.define k681 = 1
+L681:   cmp #k681, L508
+        ; block 681
+
+.define k682 = 2
+L682:   bne L1053
+        ; block 682
+
+.define k683 = 3
+L683:   jsr EXT
+        ; block 683
+
+.define k684 = 4
+L684:   mov ARR[k684], r4
+        ; block 684
+
+.define k685 = 5
+L685:   cmp #k685, L656
+        ; block 685
+
+.define k686 = 6
+L686:   bne L1265
+        ; block 686
+
+.define k687 = 7
+L687:   jsr EXT
+        ; block 687
+
+.define k688 = 0
+L688:   mov ARR[k688], r0
+        ; block 688
+
+.define k689 = 1
+L689:   cmp #k689, L804
+        ; block 689
+
+.define k690 = 2
+L690:   bne L177
+        ; block 690
+
+.define k691 = 3
+L691:   jsr EXT
+        ; block 691
+
+.define k692 = 4
+L692:   mov ARR[k692], r4
+        ; block 692
+
+.define k693 = 5
+L693:   cmp #k693, L952
+        ; block 693
+
+.define k694 = 6
+L694:   bne L389
+        ; block 694
+
+.define k695 = 7
+L695:   jsr EXT
+        ; block 695
+
+.define k696 = 0
+L696:   mov ARR[k696], r0
+        ; block 696
+
+.define k697 = 1
+L697:   cmp #k697, L1100
+        ; block 697
+
+.define k698 = 2
+L698:   bne L601
+        ; block 698
+
+.define k699 = 3
+L699:   jsr EXT
+        ; block 699
+
+.define k700 = 4
+L700:   mov ARR[k700], r4
+        ; block 700
+
+.define k701 = 5
+L701:   cmp #k701, L1248
+        ; block 701
+
+.define k702 = 6
+L702:   bne L813
+        ; block 702
+
+.define k703 = 7
+L703:   jsr EXT
+        ; block 703
+
+.define k704 = 0
+L704:   mov ARR[k704], r0
+        ; block 704
+
+.define k705 = 1
+L705:   cmp #k705, L96
+        ; block 705
+
+.define k706 = 2
+L706:   bne L1025
+        ; block 706
+
+.define k707 = 3
+L707:   jsr EXT
+        ; block 707
+
+.define k708 = 4
+L708:   mov ARR[k708], r4
+        ; block 708
+
+.define k709 = 5
+L709:   cmp #k709, L244
+        ; block 709
+
+.define k710 = 6
+L710:   bne L1237
+        ; block 710
+
+.define k711 = 7
+L711:   jsr EXT
+        ; block 711
+
+.define k712 = 0
+L712:   mov ARR[k712], r0
+        ; block 712
+
+.define k713 = 1
+L713:   cmp #k713, L392
+        ; block 713
+
+.define k714 = 2
+L714:   bne L149
+        ; block 714
+
+.define k715 = 3
+L715:   jsr EXT
+        ; block 715
+
+.define k716 = 4
+L716:   mov ARR[k716], r4
+        ; block 716
+
+.define k717 = 5
+L717:   cmp #k717, L540
+        ; block 717
+
+.define k718 = 6
+L718:   bne L361
+        ; block 718
+
+.define k719 = 7
+L719:   jsr EXT
+        ; block 719
+
+.define k720 = 0
+L720:   mov ARR[k720], r0
+        ; block 720
+
+.define k721 = 1
+L721:   cmp #k721, L688
+        ; block 721
+
+.define k722 = 2
+L722:   bne L573
+        ; block 722
+
+.define k723 = 3
+L723:   jsr EXT
+        ; block 723
+
+.define k724 = 4
+L724:   mov ARR[k724], r4
+        ; block 724
+
+.define k725 = 5
+L725:   cmp #k725, L836
+        ; block 725
+
+.define k726 = 6
+L726:   bne L785
+        ; block 726
+
+.define k727 = 7
+L727:   jsr EXT
+        ; block 727
+
+.define k728 = 0
+L728:   mov ARR[k728], r0
+        ; block 728
+
+.define k729 = 1
+L729:   cmp #k729, L984
+        ; block 729
+
+.define k730 = 2
+L730:   bne L997
+        ; block 730
+
+.define k731 = 3
+L731:   jsr EXT
+        ; block 731
+
+.define k732 = 4
+L732:   mov ARR[k732], r4
+        ; block 732
+
+.define k733 = 5
+L733:   cmp #k733, L1132
+        ; block 733
+
+.define k734 = 6
+L734:   bne L1209
+        ; block 734
+
+.define k735 = 7
+L735:   jsr EXT
+        ; block 735
+
+.define k736 = 0
+L736:   mov ARR[k736], r0
+        ; block 736
+
+.define k737 = 1
+L737:   cmp #k737, L1280
+        ; block 737
+
+.define k738 = 2
+L738:   bne L121
+        ; block 738
+
+.define k739 = 3
+L739:   jsr EXT
+        ; block 739
+
+.define k740 = 4
+L740:   mov ARR[k740], r4
+        ; block 740
+
+.define k741 = 5
+L741:   cmp #k741, L128
+        ; block 741
+
+.define k742 = 6
+L742:   bne L333
+        ; block 742
+
+.define k743 = 7
+L743:   jsr EXT
+        ; block 743
+
+.define k744 = 0
+L744:   mov ARR[k744], r0
+        ; block 744
+
+.define k745 = 1
+L745:   cmp #k745, L276
+        ; block 745
+
+.define k746 = 2
+L746:   bne L545
+        ; block 746
+
+.define k747 = 3
+L747:   jsr EXT
+        ; block 747
+
+.define k748 = 4
+L748:   mov ARR[k748], r4
+        ; block 748
+
+.define k749 = 5
+L749:   cmp #k749, L424
+        ; block 749
+
+.define k750 = 6
+L750:   bne L757
+        ; block 750
+
+.define k751 = 7
+L751:   jsr EXT
+        ; block 751
+
+.define k752 = 0
+L752:   mov ARR[k752], r0
+        ; block 752
+
+.define k753 = 1
+L753:   cmp #k753, L572
+        ; block 753
+
+.define k754 = 2
+L754:   bne L969
+        ; block 754
+
+.define k755 = 3
+L755:   jsr EXT
+        ; block 755
+
+.define k756 = 4
+L756:   mov ARR[k756], r4
+        ; block 756
+
+.define k757 = 5
+L757:   cmp #k757, L720
+        ; block 757
+
+.define k758 = 6
+L758:   bne L1181
+        ; block 758
+
+.define k759 = 7
+L759:   jsr EXT
+        ; block 759
+
+.define k760 = 0
+L760:   mov ARR[k760], r0
+        ; block 760
+
+.define k761 = 1
+L761:   cmp #k761, L868
+        ; block 761
+
+.define k762 = 2
+L762:   bne L93
+        ; block 762
+
+.define k763 = 3
+L763:   jsr EXT
+        ; block 763
+
+.define k764 = 4
+L764:   mov ARR[k764], r4
+        ; block 764
+
+.define k765 = 5
+L765:   cmp #k765, L1016
+        ; block 765
+
+.define k766 = 6
+L766:   bne L305
+        ; block 766
+
+.define k767 = 7
+L767:   jsr EXT
+        ; block 767
+
+.define k768 = 0
+L768:   mov ARR[k768], r0
+        ; block 768
+
+.define k769 = 1
+L769:   cmp #k769, L1164
+        ; block 769
+
+.define k770 = 2
+L770:   bne L517
+        ; block 770
+
+.define k771 = 3
+L771:   jsr EXT
+        ; block 771
+
+.define k772 = 4
+L772:   mov ARR[k772], r4
+        ; block 772
+
+.define k773 = 5
+L773:   cmp #k773, L12
+        ; block 773
+
+.define k774 = 6
+L774:   bne L729
+        ; block 774
+
+.define k775 = 7
+L775:   jsr EXT
+        ; block 775
+
+.define k776 = 0
+L776:   mov ARR[k776], r0
+        ; block 776
+
+.define k777 = 1
+L777:   cmp #k777, L160
+        ; block 777
+
+.define k778 = 2
+L778:   bne L941
+        ; block 778
+
+.define k779 = 3
+L779:   jsr EXT
+        ; block 779
+
+.define k780 = 4
+L780:   mov ARR[k780], r4
+        ; block 780
+
+.define k781 = 5
+L781:   cmp #k781, L308
+        ; block 781
+
+.define k782 = 6
+L782:   bne L1153
+        ; block 782
+
+.define k783 = 7
+L783:   jsr EXT
+        ; block 783
+
+.define k784 = 0
+L784:   mov ARR[k784], r0
+        ; block 784
+
+.define k785 = 1
+L785:   cmp #k785, L456
+        ; block 785
+
+.define k786 = 2
+L786:   bne L65
+        ; block 786
+
+.define k787 = 3
+L787:   jsr EXT
+        ; block 787
+
+.define k788 = 4
+L788:   mov ARR[k788], r4
+        ; block 788
+
+.define k789 = 5
+L789:   cmp #k789, L604
+        ; block 789
+
+.define k790 = 6
+L790:   bne L277
+        ; block 790
+
+.define k791 = 7
+L791:   jsr EXT
+        ; block 791
+
+.define k792 = 0
+L792:   mov ARR[k792], r0
+        ; block 792
+
+.define k793 = 1
+L793:   cmp #k793, L752
+        ; block 793
+
+.define k794 = 2
+L794:   bne L489
+        ; block 794
+
+.define k795 = 3
+L795:   jsr EXT
+        ; block 795
+
+.define k796 = 4
+L796:   mov ARR[k796], r4
+        ; block 796
+
+.define k797 = 5
+L797:   cmp #k797, L900
+        ; block 797
+
+.define k798 = 6
+L798:   bne L701
+        ; block 798
+
+.define k799 = 7
+L799:   jsr EXT
+        ; block 799
+
+.define k800 = 0
+L800:   mov ARR[k800], r0
+        ; block 800
+
+.define k801 = 1
+L801:   cmp #k801, L1048
+        ; block 801
+
+.define k802 = 2
+L802:   bne L913
+        ; block 802
+
+.define k803 = 3
+L803:   jsr EXT
+        ; block 803
+
+.define k804 = 4
+L804:   mov ARR[k804], r4
+        ; block 804
+
+.define k805 = 5
+L805:   cmp #k805, L1196
+        ; block 805
+
+.define k806 = 6
+L806:   bne L1125
+        ; block 806
+
+.define k807 = 7
+L807:   jsr EXT
+        ; block 807
+
+.define k808 = 0
+L808:   mov ARR[k808], r0
+        ; block 808
+
+.define k809 = 1
+L809:   cmp #k809, L44
+        ; block 809
+
+.define k810 = 2
+L810:   bne L37
+        ; block 810
+
+.define k811 = 3
+L811:   jsr EXT
+        ; block 811
+
+.define k812 = 4
+L812:   mov ARR[k812], r4
+        ; block 812
+
+.define k813 = 5
+L813:   cmp #k813, L192
+        ; block 813
+
+.define k814 = 6
+L814:   bne L249
+        ; block 814
+
+.define k815 = 7
+L815:   jsr EXT
+        ; block 815
+
+.define k816 = 0
+L816:   mov ARR[k816], r0
+        ; block 816
+
+.define k817 = 1
+L817:   cmp #k817, L340
+        ; block 817
+
+.define k818 = 2
+L818:   bne L461
+        ; block 818
+
+.define k819 = 3
+L819:   jsr EXT
+        ; block 819
+
+.define k820 = 4
+L820:   mov ARR[k820], r4
+        ; block 820
+
+.define k821 = 5
+L821:   cmp #k821, L488
+        ; block 821
+
+.define k822 = 6
+L822:   bne L673
+        ; block 822
+
+.define k823 = 7
+L823:   jsr EXT
+        ; block 823
+
+.define k824 = 0
+L824:   mov ARR[k824], r0
+        ; block 824
+
+.define k825 = 1
+L825:   cmp #k825, L636
+        ; block 825
+
+.define k826 = 2
+L826:   bne L885
+        ; block 826
+
+.define k827 = 3
+L827:   jsr EXT
+        ; block 827
+
+.define k828 = 4
+L828:   mov ARR[k828], r4
+        ; block 828
+
+.define k829 = 5
+L829:   cmp #k829, L784
+        ; block 829
+
+.define k830 = 6
+L830:   bne L1097
+        ; block 830
+
+.define k831 = 7
+L831:   jsr EXT
+        ; block 831
+
+.define k832 = 0
+L832:   mov ARR[k832], r0
+        ; block 832
+
+.define k833 = 1
+L833:   cmp #k833, L932
+        ; block 833
+
+.define k834 = 2
+L834:   bne L9
+        ; block 834
+
+.define k835 = 3
+L835:   jsr EXT
+        ; block 835
+
+.define k836 = 4
+L836:   mov ARR[k836], r4
+        ; block 836
+
+.define k837 = 5
+L837:   cmp #k837, L1080
+        ; block 837
+
+.define k838 = 6
+L838:   bne L221
+        ; block 838
+
+.define k839 = 7
+L839:   jsr EXT
+        ; block 839
+
+.define k840 = 0
+L840:   mov ARR[k840], r0
+        ; block 840
+
+.define k841 = 1
+L841:   cmp #k841, L1228
+        ; block 841
+
+.define k842 = 2
+L842:   bne L433
+        ; block 842
+
+.define k843 = 3
+L843:   jsr EXT
+        ; block 843
+
+.define k844 = 4
+L844:   mov ARR[k844], r4
+        ; block 844
+
+.define k845 = 5
+L845:   cmp #k845, L76
+        ; block 845
+
+.define k846 = 6
+L846:   bne L645
+        ; block 846
+
+.define k847 = 7
+L847:   jsr EXT
+        ; block 847
+
+.define k848 = 0
+L848:   mov ARR[k848], r0
+        ; block 848
+
+.define k849 = 1
+L849:   cmp #k849, L224
+        ; block 849
+
+.define k850 = 2
+L850:   bne L857
+        ; block 850
+
+.define k851 = 3
+L851:   jsr EXT
+        ; block 851
+
+.define k852 = 4
+L852:   mov ARR[k852], r4
+        ; block 852
+
+.define k853 = 5
+L853:   cmp #k853, L372
+        ; block 853
+
+.define k854 = 6
+L854:   bne L1069
+        ; block 854
+
+.define k855 = 7
+L855:   jsr EXT
+        ; block 855
+
+.define k856 = 0
+L856:   mov ARR[k856], r0
+        ; block 856
+
+.define k857 = 1
+L857:   cmp #k857, L520
+        ; block 857
+
+.define k858 = 2
+L858:   bne L1281
+        ; block 858
+
+.define k859 = 3
+L859:   jsr EXT
+        ; block 859
+
+.define k860 = 4
+L860:   mov ARR[k860], r4
+        ; block 860
+
+.define k861 = 5
+L861:   cmp #k861, L668
+        ; block 861
+
+.define k862 = 6
+L862:   bne L193
+        ; block 862
+
+.define k863 = 7
+L863:   jsr EXT
+        ; block 863
+
+.define k864 = 0
+L864:   mov ARR[k864], r0
+        ; block 864
+
+.define k865 = 1
+L865:   cmp #k865, L816
+        ; block 865
+
+.define k866 = 2
+L866:   bne L405
+        ; block 866
+
+.define k867 = 3
+L867:   jsr EXT
+        ; block 867
+
+.define k868 = 4
+L868:   mov ARR[k868], r4
+        ; block 868
+
+.define k869 = 5
+L869:   cmp #k869, L964
+        ; block 869
+
+.define k870 = 6
+L870:   bne L617
+        ; block 870
+
+.define k871 = 7
+L871:   jsr EXT
+        ; block 871
+
+.define k872 = 0
+L872:   mov ARR[k872], r0
+        ; block 872
+
+.define k873 = 1
+L873:   cmp #k873, L1112
+        ; block 873
+
+.define k874 = 2
+L874:   bne L829
+        ; block 874
+
+.define k875 = 3
+L875:   jsr EXT
+        ; block 875
+
+.define k876 = 4
+L876:   mov ARR[k876], r4
+        ; block 876
+
+.define k877 = 5
+L877:   cmp #k877, L1260
+        ; block 877
+
+.define k878 = 6
+L878:   bne L1041
+        ; block 878
+
+.define k879 = 7
+L879:   jsr EXT
+        ; block 879
+
+.define k880 = 0
+L880:   mov ARR[k880], r0
+        ; block 880
+
+.define k881 = 1
+L881:   cmp #k881, L108
+        ; block 881
+
+.define k882 = 2
+L882:   bne L1253
+        ; block 882
+
+.define k883 = 3
+L883:   jsr EXT
+        ; block 883
+
+.define k884 = 4
+L884:   mov ARR[k884], r4
+        ; block 884
+
+.define k885 = 5
+L885:   cmp #k885, L256
+        ; block 885
+
+.define k886 = 6
+L886:   bne L165
+        ; block 886
+
+.define k887 = 7
+L887:   jsr EXT
+        ; block 887
+
+.define k888 = 0
+L888:   mov ARR[k888], r0
+        ; block 888
+
+.define k889 = 1
+L889:   cmp #k889, L404
+        ; block 889
+
+.define k890 = 2
+L890:   bne L377
+        ; block 890
+
+.define k891 = 3
+L891:   jsr EXT
+        ; block 891
+
+.define k892 = 4
+L892:   mov ARR[k892], r4
+        ; block 892
+
+.define k893 = 5
+L893:   cmp #k893, L552
+        ; block 893
+
+.define k894 = 6
+L894:   bne L589
+        ; block 894
+
+.define k895 = 7
+L895:   jsr EXT
+        ; block 895
+
+.define k896 = 0
+L896:   mov ARR[k896], r0
+        ; block 896
+
+.define k897 = 1
+L897:   cmp #k897, L700
+        ; block 897
+
+.define k898 = 2
+L898:   bne L801
+        ; block 898
+
+.define k899 = 3
+L899:   jsr EXT
+        ; block 899
+
+.define k900 = 4
+L900:   mov ARR[k900], r4
+        ; block 900
+
+.define k901 = 5
+L901:   cmp #k901, L848
+        ; block 901
+
+.define k902 = 6
+L902:   bne L1013
+        ; block 902
+
+.define k903 = 7
+L903:   jsr EXT
+        ; block 903
+
+.define k904 = 0
+L904:   mov ARR[k904], r0
+        ; block 904
+
+.define k905 = 1
+L905:   cmp #k905, L996
+        ; block 905
+
+.define k906 = 2
+L906:   bne L1225
+        ; block 906
+
+.define k907 = 3
+L907:   jsr EXT
+        ; block 907
+
+.define k908 = 4
+L908:   mov ARR[k908], r4
+        ; block 908
+
+.define k909 = 5
+L909:   cmp #k909, L1144
+        ; block 909
+
+.define k910 = 6
+L910:   bne L137
+        ; block 910
+
+.define k911 = 7
+L911:   jsr EXT
+        ; block 911
+
+.define k912 = 0
+L912:   mov ARR[k912], r0
+        ; block 912
+
+.define k913 = 1
+L913:   cmp #k913, L1292
+        ; block 913
+
+.define k914 = 2
+L914:   bne L349
+        ; block 914
+
+.define k915 = 3
+L915:   jsr EXT
+        ; block 915
+
+.define k916 = 4
+L916:   mov ARR[k916], r4
+        ; block 916
+
+.define k917 = 5
+L917:   cmp #k917, L140
+        ; block 917
+
+.define k918 = 6
+L918:   bne L561
+        ; block 918
+
+.define k919 = 7
+L919:   jsr EXT
+        ; block 919
+
+.define k920 = 0
+L920:   mov ARR[k920], r0
+        ; block 920
+
+.define k921 = 1
+L921:   cmp #k921, L288
+        ; block 921
+
+.define k922 = 2
+L922:   bne L773
+        ; block 922
+
+.define k923 = 3
+L923:   jsr EXT
+        ; block 923
+
+.define k924 = 4
+L924:   mov ARR[k924], r4
+        ; block 924
+
+.define k925 = 5
+L925:   cmp #k925, L436
+        ; block 925
+
+.define k926 = 6
+L926:   bne L985
+        ; block 926
+
+.define k927 = 7
+L927:   jsr EXT
+        ; block 927
+
+.define k928 = 0
+L928:   mov ARR[k928], r0
+        ; block 928
+
+.define k929 = 1
+L929:   cmp #k929, L584
+        ; block 929
+
+.define k930 = 2
+L930:   bne L1197
+        ; block 930
+
+.define k931 = 3
+L931:   jsr EXT
+        ; block 931
+
+.define k932 = 4
+L932:   mov ARR[k932], r4
+        ; block 932
+
+.define k933 = 5
+L933:   cmp #k933, L732
+        ; block 933
+
+.define k934 = 6
+L934:   bne L109
+        ; block 934
+
+.define k935 = 7
+L935:   jsr EXT
+        ; block 935
+
+.define k936 = 0
+L936:   mov ARR[k936], r0
+        ; block 936
+
+.define k937 = 1
+L937:   cmp #k937, L880
+        ; block 937
+
+.define k938 = 2
+L938:   bne L321
+        ; block 938
+
+.define k939 = 3
+L939:   jsr EXT
+        ; block 939
+
+.define k940 = 4
+L940:   mov ARR[k940], r4
+        ; block 940
+
+.define k941 = 5
+L941:   cmp #k941, L1028
+        ; block 941
+
+.define k942 = 6
+L942:   bne L533
+        ; block 942
+
+.define k943 = 7
+L943:   jsr EXT
+        ; block 943
+
+.define k944 = 0
+L944:   mov ARR[k944], r0
+        ; block 944
+
+.define k945 = 1
+L945:   cmp #k945, L1176
+        ; block 945
+
+.define k946 = 2
+L946:   bne L745
+        ; block 946
+
+.define k947 = 3
+L947:   jsr EXT
+        ; block 947
+
+.define k948 = 4
+L948:   mov ARR[k948], r4
+        ; block 948
+
+.define k949 = 5
+L949:   cmp #k949, L24
+        ; block 949
+
+.define k950 = 6
+L950:   bne L957
+        ; block 950
+
+.define k951 = 7
+L951:   jsr EXT
+        ; block 951
+
+.define k952 = 0
+L952:   mov ARR[k952], r0
+        ; block 952
+
+.define k953 = 1
+L953:   cmp #k953, L172
+        ; block 953
+
+.define k954 = 2
+L954:   bne L1169
+        ; block 954
+
+.define k955 = 3
+L955:   jsr EXT
+        ; block 955
+
+.define k956 = 4
+L956:   mov ARR[k956], r4
+        ; block 956
+
+.define k957 = 5
+L957:   cmp #k957, L320
+        ; block 957
+
+.define k958 = 6
+L958:   bne L81
+        ; block 958
+
+.define k959 = 7
+L959:   jsr EXT
+        ; block 959
+
+.define k960 = 0
+L960:   mov ARR[k960], r0
+        ; block 960
+
+.define k961 = 1
+L961:   cmp #k961, L468
+        ; block 961
+
+.define k962 = 2
+L962:   bne L293
+        ; block 962
+
+.define k963 = 3
+L963:   jsr EXT
+        ; block 963
+
+.define k964 = 4
+L964:   mov ARR[k964], r4
+        ; block 964
+
+.define k965 = 5
+L965:   cmp #k965, L616
+        ; block 965
+
+.define k966 = 6
+L966:   bne L505
+        ; block 966
+
+.define k967 = 7
+L967:   jsr EXT
+        ; block 967
+
+.define k968 = 0
+L968:   mov ARR[k968], r0
+        ; block 968
+
+.define k969 = 1
+L969:   cmp #k969, L764
+        ; block 969
+
+.define k970 = 2
+L970:   bne L717
+        ; block 970
+
+.define k971 = 3
+L971:   jsr EXT
+        ; block 971
+
+.define k972 = 4
+L972:   mov ARR[k972], r4
+        ; block 972
+
+.define k973 = 5
+L973:   cmp #k973, L912
+        ; block 973
+
+.define k974 = 6
+L974:   bne L929
+        ; block 974
+
+.define k975 = 7
+L975:   jsr EXT
+        ; block 975
+
+.define k976 = 0
+L976:   mov ARR[k976], r0
+        ; block 976
+
+.define k977 = 1
+L977:   cmp #k977, L1060
+        ; block 977
+
+.define k978 = 2
+L978:   bne L1141
+        ; block 978
+
+.define k979 = 3
+L979:   jsr EXT
+        ; block 979
+
+.define k980 = 4
+L980:   mov ARR[k980], r4
+        ; block 980
+
+.define k981 = 5
+L981:   cmp #k981, L1208
+        ; block 981
+
+.define k982 = 6
+L982:   bne L53
+        ; block 982
+
+.define k983 = 7
+L983:   jsr EXT
+        ; block 983
+
+.define k984 = 0
+L984:   mov ARR[k984], r0
+        ; block 984
+
+.define k985 = 1
+L985:   cmp #k985, L56
+        ; block 985
+
+.define k986 = 2
+L986:   bne L265
+        ; block 986
+
+.define k987 = 3
+L987:   jsr EXT
+        ; block 987
+
+.define k988 = 4
+L988:   mov ARR[k988], r4
+        ; block 988
+
+.define k989 = 5
+L989:   cmp #k989, L204
+        ; block 989
+
+.define k990 = 6
+L990:   bne L477
+        ; block 990
+
+.define k991 = 7
+L991:   jsr EXT
+        ; block 991
+
+.define k992 = 0
+L992:   mov ARR[k992], r0
+        ; block 992
+
+.define k993 = 1
+L993:   cmp #k993, L352
+        ; block 993
+
+.define k994 = 2
+L994:   bne L689
+        ; block 994
+
+.define k995 = 3
+L995:   jsr EXT
+        ; block 995
+
+.define k996 = 4
+L996:   mov ARR[k996], r4
+        ; block 996
+
+.define k997 = 5
+L997:   cmp #k997, L500
+        ; block 997
+
+.define k998 = 6
+L998:   bne L901
+        ; block 998
+
+.define k999 = 7
+L999:   jsr EXT
+        ; block 999
+
+.define k1000 = 0
+L1000:  mov ARR[k1000], r0
+        ; block 1000
+
+.define k1001 = 1
+L1001:  cmp #k1001, L648
+        ; block 1001
+
+.define k1002 = 2
+L1002:  bne L1113
+        ; block 1002
+
+.define k1003 = 3
+L1003:  jsr EXT
+        ; block 1003
+
+.define k1004 = 4
+L1004:  mov ARR[k1004], r4
+        ; block 1004
+
+.define k1005 = 5
+L1005:  cmp #k1005, L796
+        ; block 1005
+
+.define k1006 = 6
+L1006:  bne L25
+        ; block 1006
+
+.define k1007 = 7
+L1007:  jsr EXT
+        ; block 1007
+
+.define k1008 = 0
+L1008:  mov ARR[k1008], r0
+        ; block 1008
+
+.define k1009 = 1
+L1009:  cmp #k1009, L944
+        ; block 1009
+
+.define k1010 = 2
+L1010:  bne L237
+        ; block 1010
+
+.define k1011 = 3
+L1011:  jsr EXT
+        ; block 1011
+
+.define k1012 = 4
+L1012:  mov ARR[k1012], r4
+        ; block 1012
+
+.define k1013 = 5
+L1013:  cmp #k1013, L1092
+        ; block 1013
+
+.define k1014 = 6
+L1014:  bne L449
+        ; block 1014
+
+.define k1015 = 7
+L1015:  jsr EXT
+        ; block 1015
+
+.define k1016 = 0
+L1016:  mov ARR[k1016], r0
+        ; block 1016
+
+.define k1017 = 1
+L1017:  cmp #k1017, L1240
+        ; block 1017
+
+.define k1018 = 2
+L1018:  bne L661
+        ; block 1018
+
+.define k1019 = 3
+L1019:  jsr EXT
+        ; block 1019
+
+.define k1020 = 4
+L1020:  mov ARR[k1020], r4
+        ; block 1020
+
+.define k1021 = 5
+L1021:  cmp #k1021, L88
+        ; block 1021
+
+.define k1022 = 6
+L1022:  bne L873
+        ; block 1022
+
+.define k1023 = 7
+L1023:  jsr EXT
+        ; block 1023
+
+.define k1024 = 0
+L1024:  mov ARR[k1024], r0
+        ; block 1024
+
+.define k1025 = 1
+L1025:  cmp #k1025, L236
+        ; block 1025
+
+.define k1026 = 2
+L1026:  bne L1085
+        ; block 1026
+
+.define k1027 = 3
+L1027:  jsr EXT
+        ; block 1027
+
+.define k1028 = 4
+L1028:  mov ARR[k1028], r4
+        ; block 1028
+
+.define k1029 = 5
+L1029:  cmp #k1029, L384
+        ; block 1029
+
+.define k1030 = 6
+L1030:  bne L1297
+        ; block 1030
+
+.define k1031 = 7
+L1031:  jsr EXT
+        ; block 1031
+
+.define k1032 = 0
+L1032:  mov ARR[k1032], r0
+        ; block 1032
+
+.define k1033 = 1
+L1033:  cmp #k1033, L532
+        ; block 1033
+
+.define k1034 = 2
+L1034:  bne L209
+        ; block 1034
+
+.define k1035 = 3
+L1035:  jsr EXT
+        ; block 1035
+
+.define k1036 = 4
+L1036:  mov ARR[k1036], r4
+        ; block 1036
+
+.define k1037 = 5
+L1037:  cmp #k1037, L680
+        ; block 1037
+
+.define k1038 = 6
+L1038:  bne L421
+        ; block 1038
+
+.define k1039 = 7
+L1039:  jsr EXT
+        ; block 1039
+
+.define k1040 = 0
+L1040:  mov ARR[k1040], r0
+        ; block 1040
+
+.define k1041 = 1
+L1041:  cmp #k1041, L828
+        ; block 1041
+
+.define k1042 = 2
+L1042:  bne L633
+        ; block 1042
+
+.define k1043 = 3
+L1043:  jsr EXT
+        ; block 1043
+
+.define k1044 = 4
+L1044:  mov ARR[k1044], r4
+        ; block 1044
+
+.define k1045 = 5
+L1045:  cmp #k1045, L976
+        ; block 1045
+
+.define k1046 = 6
+L1046:  bne L845
+        ; block 1046
+
+.define k1047 = 7
+L1047:  jsr EXT
+        ; block 1047
+
+.define k1048 = 0
+L1048:  mov ARR[k1048], r0
+        ; block 1048
+
+.define k1049 = 1
+L1049:  cmp #k1049, L1124
+        ; block 1049
+
+.define k1050 = 2
+L1050:  bne L1057
+        ; block 1050
+
+.define k1051 = 3
+L1051:  jsr EXT
+        ; block 1051
+
+.define k1052 = 4
+L1052:  mov ARR[k1052], r4
+        ; block 1052
+
+.define k1053 = 5
+L1053:  cmp #k1053, L1272
+        ; block 1053
+
+.define k1054 = 6
+L1054:  bne L1269
+        ; block 1054
+
+.define k1055 = 7
+L1055:  jsr EXT
+        ; block 1055
+
+.define k1056 = 0
+L1056:  mov ARR[k1056], r0
+        ; block 1056
+
+.define k1057 = 1
+L1057:  cmp #k1057, L120
+        ; block 1057
+
+.define k1058 = 2
+L1058:  bne L181
+        ; block 1058
+
+.define k1059 = 3
+L1059:  jsr EXT
+        ; block 1059
+
+.define k1060 = 4
+L1060:  mov ARR[k1060], r4
+        ; block 1060
+
+.define k1061 = 5
+L1061:  cmp #k1061, L268
+        ; block 1061
+
+.define k1062 = 6
+L1062:  bne L393
+        ; block 1062
+
+.define k1063 = 7
+L1063:  jsr EXT
+        ; block 1063
+
+.define k1064 = 0
+L1064:  mov ARR[k1064], r0
+        ; block 1064
+
+.define k1065 = 1
+L1065:  cmp #k1065, L416
+        ; block 1065
+
+.define k1066 = 2
+L1066:  bne L605
+        ; block 1066
+
+.define k1067 = 3
+L1067:  jsr EXT
+        ; block 1067
+
+.define k1068 = 4
+L1068:  mov ARR[k1068], r4
+        ; block 1068
+
+.define k1069 = 5
+L1069:  cmp #k1069, L564
+        ; block 1069
+
+.define k1070 = 6
+L1070:  bne L817
+        ; block 1070
+
+.define k1071 = 7
+L1071:  jsr EXT
+        ; block 1071
+
+.define k1072 = 0
+L1072:  mov ARR[k1072], r0
+        ; block 1072
+
+.define k1073 = 1
+L1073:  cmp #k1073, L712
+        ; block 1073
+
+.define k1074 = 2
+L1074:  bne L1029
+        ; block 1074
+
+.define k1075 = 3
+L1075:  jsr EXT
+        ; block 1075
+
+.define k1076 = 4
+L1076:  mov ARR[k1076], r4
+        ; block 1076
+
+.define k1077 = 5
+L1077:  cmp #k1077, L860
+        ; block 1077
+
+.define k1078 = 6
+L1078:  bne L1241
+        ; block 1078
+
+.define k1079 = 7
+L1079:  jsr EXT
+        ; block 1079
+
+.define k1080 = 0
+L1080:  mov ARR[k1080], r0
+        ; block 1080
+
+.define k1081 = 1
+L1081:  cmp #k1081, L1008
+        ; block 1081
+
+.define k1082 = 2
+L1082:  bne L153
+        ; block 1082
+
+.define k1083 = 3
+L1083:  jsr EXT
+        ; block 1083
+
+.define k1084 = 4
+L1084:  mov ARR[k1084], r4
+        ; block 1084
+
+.define k1085 = 5
+L1085:  cmp #k1085, L1156
+        ; block 1085
+
+.define k1086 = 6
+L1086:  bne L365
+        ; block 1086
+
+.define k1087 = 7
+L1087:  jsr EXT
+        ; block 1087
+
+.define k1088 = 0
+L1088:  mov ARR[k1088], r0
+        ; block 1088
+
+.define k1089 = 1
+L1089:  cmp #k1089, L4
+        ; block 1089
+
+.define k1090 = 2
+L1090:  bne L577
+        ; block 1090
+
+.define k1091 = 3
+L1091:  jsr EXT
+        ; block 1091
+
+.define k1092 = 4
+L1092:  mov ARR[k1092], r4
+        ; block 1092
+
+.define k1093 = 5
+L1093:  cmp #k1093, L152
+        ; block 1093
+
+.define k1094 = 6
+L1094:  bne L789
+        ; block 1094
+
+.define k1095 = 7
+L1095:  jsr EXT
+        ; block 1095
+
+.define k1096 = 0
+L1096:  mov ARR[k1096], r0
+        ; block 1096
+
+.define k1097 = 1
+L1097:  cmp #k1097, L300
+        ; block 1097
+
+.define k1098 = 2
+L1098:  bne L1001
+        ; block 1098
+
+.define k1099 = 3
+L1099:  jsr EXT
+        ; block 1099
+
+.define k1100 = 4
+L1100:  mov ARR[k1100], r4
+        ; block 1100
+
+.define k1101 = 5
+L1101:  cmp #k1101, L448
+        ; block 1101
+
+.define k1102 = 6
+L1102:  bne L1213
+        ; block 1102
+
+.define k1103 = 7
+L1103:  jsr EXT
+        ; block 1103
+
+.define k1104 = 0
+L1104:  mov ARR[k1104], r0
+        ; block 1104
+
+.define k1105 = 1
+L1105:  cmp #k1105, L596
+        ; block 1105
+
+.define k1106 = 2
+L1106:  bne L125
+        ; block 1106
+
+.define k1107 = 3
+L1107:  jsr EXT
+        ; block 1107
+
+.define k1108 = 4
+L1108:  mov ARR[k1108], r4
+        ; block 1108
+
+.define k1109 = 5
+L1109:  cmp #k1109, L744
+        ; block 1109
+
+.define k1110 = 6
+L1110:  bne L337
+        ; block 1110
+
+.define k1111 = 7
+L1111:  jsr EXT
+        ; block 1111
+
+.define k1112 = 0
+L1112:  mov ARR[k1112], r0
+        ; block 1112
+
+.define k1113 = 1
+L1113:  cmp #k1113, L892
+        ; block 1113
+
+.define k1114 = 2
+L1114:  bne L549
+        ; block 1114
+
+.define k1115 = 3
+L1115:  jsr EXT
+        ; block 1115
+
+.define k1116 = 4
+L1116:  mov ARR[k1116], r4
+        ; block 1116
+
+.define k1117 = 5
+L1117:  cmp #k1117, L1040
+        ; block 1117
+
+.define k1118 = 6
+L1118:  bne L761
+        ; block 1118
+
+.define k1119 = 7
+L1119:  jsr EXT
+        ; block 1119
+
+.define k1120 = 0
+L1120:  mov ARR[k1120], r0
+        ; block 1120
+
+.define k1121 = 1
+L1121:  cmp #k1121, L1188
+        ; block 1121
+
+.define k1122 = 2
+L1122:  bne L973
+        ; block 1122
+
+.define k1123 = 3
+L1123:  jsr EXT
+        ; block 1123
+
+.define k1124 = 4
+L1124:  mov ARR[k1124], r4
+        ; block 1124
+
+.define k1125 = 5
+L1125:  cmp #k1125, L36
+        ; block 1125
+
+.define k1126 = 6
+L1126:  bne L1185
+        ; block 1126
+
+.define k1127 = 7
+L1127:  jsr EXT
+        ; block 1127
+
+.define k1128 = 0
+L1128:  mov ARR[k1128], r0
+        ; block 1128
+
+.define k1129 = 1
+L1129:  cmp #k1129, L184
+        ; block 1129
+
+.define k1130 = 2
+L1130:  bne L97
+        ; block 1130
+
+.define k1131 = 3
+L1131:  jsr EXT
+        ; block 1131
+
+.define k1132 = 4
+L1132:  mov ARR[k1132], r4
+        ; block 1132
+
+.define k1133 = 5
+L1133:  cmp #k1133, L332
+        ; block 1133
+
+.define k1134 = 6
+L1134:  bne L309
+        ; block 1134
+
+.define k1135 = 7
+L1135:  jsr EXT
+        ; block 1135
+
+.define k1136 = 0
+L1136:  mov ARR[k1136], r0
+        ; block 1136
+
+.define k1137 = 1
+L1137:  cmp #k1137, L480
+        ; block 1137
+
+.define k1138 = 2
+L1138:  bne L521
+        ; block 1138
+
+.define k1139 = 3
+L1139:  jsr EXT
+        ; block 1139
+
+.define k1140 = 4
+L1140:  mov ARR[k1140], r4
+        ; block 1140
+
+.define k1141 = 5
+L1141:  cmp #k1141, L628
+        ; block 1141
+
+.define k1142 = 6
+L1142:  bne L733
+        ; block 1142
+
+.define k1143 = 7
+L1143:  jsr EXT
+        ; block 1143
+
+.define k1144 = 0
+L1144:  mov ARR[k1144], r0
+        ; block 1144
+
+.define k1145 = 1
+L1145:  cmp #k1145, L776
+        ; block 1145
+
+.define k1146 = 2
+L1146:  bne L945
+        ; block 1146
+
+.define k1147 = 3
+L1147:  jsr EXT
+        ; block 1147
+
+.define k1148 = 4
+L1148:  mov ARR[k1148], r4
+        ; block 1148
+
+.define k1149 = 5
+L1149:  cmp #k1149, L924
+        ; block 1149
+
+.define k1150 = 6
+L1150:  bne L1157
+        ; block 1150
+
+.define k1151 = 7
+L1151:  jsr EXT
+        ; block 1151
+
+.define k1152 = 0
+L1152:  mov ARR[k1152], r0
+        ; block 1152
+
+.define k1153 = 1
+L1153:  cmp #k1153, L1072
+        ; block 1153
+
+.define k1154 = 2
+L1154:  bne L69
+        ; block 1154
+
+.define k1155 = 3
+L1155:  jsr EXT
+        ; block 1155
+
+.define k1156 = 4
+L1156:  mov ARR[k1156], r4
+        ; block 1156
+
+.define k1157 = 5
+L1157:  cmp #k1157, L1220
+        ; block 1157
+
+.define k1158 = 6
+L1158:  bne L281
+        ; block 1158
+
+.define k1159 = 7
+L1159:  jsr EXT
+        ; block 1159
+
+.define k1160 = 0
+L1160:  mov ARR[k1160], r0
+        ; block 1160
+
+.define k1161 = 1
+L1161:  cmp #k1161, L68
+        ; block 1161
+
+.define k1162 = 2
+L1162:  bne L493
+        ; block 1162
+
+.define k1163 = 3
+L1163:  jsr EXT
+        ; block 1163
+
+.define k1164 = 4
+L1164:  mov ARR[k1164], r4
+        ; block 1164
+
+.define k1165 = 5
+L1165:  cmp #k1165, L216
+        ; block 1165
+
+.define k1166 = 6
+L1166:  bne L705
+        ; block 1166
+
+.define k1167 = 7
+L1167:  jsr EXT
+        ; block 1167
+
+.define k1168 = 0
+L1168:  mov ARR[k1168], r0
+        ; block 1168
+
+.define k1169 = 1
+L1169:  cmp #k1169, L364
+        ; block 1169
+
+.define k1170 = 2
+L1170:  bne L917
+        ; block 1170
+
+.define k1171 = 3
+L1171:  jsr EXT
+        ; block 1171
+
+.define k1172 = 4
+L1172:  mov ARR[k1172], r4
+        ; block 1172
+
+.define k1173 = 5
+L1173:  cmp #k1173, L512
+        ; block 1173
+
+.define k1174 = 6
+L1174:  bne L1129
+        ; block 1174
+
+.define k1175 = 7
+L1175:  jsr EXT
+        ; block 1175
+
+.define k1176 = 0
+L1176:  mov ARR[k1176], r0
+        ; block 1176
+
+.define k1177 = 1
+L1177:  cmp #k1177, L660
+        ; block 1177
+
+.define k1178 = 2
+L1178:  bne L41
+        ; block 1178
+
+.define k1179 = 3
+L1179:  jsr EXT
+        ; block 1179
+
+.define k1180 = 4
+L1180:  mov ARR[k1180], r4
+        ; block 1180
+
+.define k1181 = 5
+L1181:  cmp #k1181, L808
+        ; block 1181
+
+.define k1182 = 6
+L1182:  bne L253
+        ; block 1182
+
+.define k1183 = 7
+L1183:  jsr EXT
+        ; block 1183
+
+.define k1184 = 0
+L1184:  mov ARR[k1184], r0
+        ; block 1184
+
+.define k1185 = 1
+L1185:  cmp #k1185, L956
+        ; block 1185
+
+.define k1186 = 2
+L1186:  bne L465
+        ; block 1186
+
+.define k1187 = 3
+L1187:  jsr EXT
+        ; block 1187
+
+.define k1188 = 4
+L1188:  mov ARR[k1188], r4
+        ; block 1188
+
+.define k1189 = 5
+L1189:  cmp #k1189, L1104
+        ; block 1189
+
+.define k1190 = 6
+L1190:  bne L677
+        ; block 1190
+
+.define k1191 = 7
+L1191:  jsr EXT
+        ; block 1191
+
+.define k1192 = 0
+L1192:  mov ARR[k1192], r0
+        ; block 1192
+
+.define k1193 = 1
+L1193:  cmp #k1193, L1252
+        ; block 1193
+
+.define k1194 = 2
+L1194:  bne L889
+        ; block 1194
+
+.define k1195 = 3
+L1195:  jsr EXT
+        ; block 1195
+
+.define k1196 = 4
+L1196:  mov ARR[k1196], r4
+        ; block 1196
+
+.define k1197 = 5
+L1197:  cmp #k1197, L100
+        ; block 1197
+
+.define k1198 = 6
+L1198:  bne L1101
+        ; block 1198
+
+.define k1199 = 7
+L1199:  jsr EXT
+        ; block 1199
+
+.define k1200 = 0
+L1200:  mov ARR[k1200], r0
+        ; block 1200
+
+.define k1201 = 1
+L1201:  cmp #k1201, L248
+        ; block 1201
+
+.define k1202 = 2
+L1202:  bne L13
+        ; block 1202
+
+.define k1203 = 3
+L1203:  jsr EXT
+        ; block 1203
+
+.define k1204 = 4
+L1204:  mov ARR[k1204], r4
+        ; block 1204
+
+.define k1205 = 5
+L1205:  cmp #k1205, L396
+        ; block 1205
+
+.define k1206 = 6
+L1206:  bne L225
+        ; block 1206
+
+.define k1207 = 7
+L1207:  jsr EXT
+        ; block 1207
+
+.define k1208 = 0
+L1208:  mov ARR[k1208], r0
+        ; block 1208
+
+.define k1209 = 1
+L1209:  cmp #k1209, L544
+        ; block 1209
+
+.define k1210 = 2
+L1210:  bne L437
+        ; block 1210
+
+.define k1211 = 3
+L1211:  jsr EXT
+        ; block 1211
+
+.define k1212 = 4
+L1212:  mov ARR[k1212], r4
+        ; block 1212
+
+.define k1213 = 5
+L1213:  cmp #k1213, L692
+        ; block 1213
+
+.define k1214 = 6
+L1214:  bne L649
+        ; block 1214
+
+.define k1215 = 7
+L1215:  jsr EXT
+        ; block 1215
+
+.define k1216 = 0
+L1216:  mov ARR[k1216], r0
+        ; block 1216
+
+.define k1217 = 1
+L1217:  cmp #k1217, L840
+        ; block 1217
+
+.define k1218 = 2
+L1218:  bne L861
+        ; block 1218
+
+.define k1219 = 3
+L1219:  jsr EXT
+        ; block 1219
+
+.define k1220 = 4
+L1220:  mov ARR[k1220], r4
+        ; block 1220
+
+.define k1221 = 5
+L1221:  cmp #k1221, L988
+        ; block 1221
+
+.define k1222 = 6
+L1222:  bne L1073
+        ; block 1222
+
+.define k1223 = 7
+L1223:  jsr EXT
+        ; block 1223
+
+.define k1224 = 0
+L1224:  mov ARR[k1224], r0
+        ; block 1224
+
+.define k1225 = 1
+L1225:  cmp #k1225, L1136
+        ; block 1225
+
+.define k1226 = 2
+L1226:  bne L1285
+        ; block 1226
+
+.define k1227 = 3
+L1227:  jsr EXT
+        ; block 1227
+
+.define k1228 = 4
+L1228:  mov ARR[k1228], r4
+        ; block 1228
+
+.define k1229 = 5
+L1229:  cmp #k1229, L1284
+        ; block 1229
+
+.define k1230 = 6
+L1230:  bne L197
+        ; block 1230
+
+.define k1231 = 7
+L1231:  jsr EXT
+        ; block 1231
+
+.define k1232 = 0
+L1232:  mov ARR[k1232], r0
+        ; block 1232
+
+.define k1233 = 1
+L1233:  cmp #k1233, L132
+        ; block 1233
+
+.define k1234 = 2
+L1234:  bne L409
+        ; block 1234
+
+.define k1235 = 3
+L1235:  jsr EXT
+        ; block 1235
+
+.define k1236 = 4
+L1236:  mov ARR[k1236], r4
+        ; block 1236
+
+.define k1237 = 5
+L1237:  cmp #k1237, L280
+        ; block 1237
+
+.define k1238 = 6
+L1238:  bne L621
+        ; block 1238
+
+.define k1239 = 7
+L1239:  jsr EXT
+        ; block 1239
+
+.define k1240 = 0
+L1240:  mov ARR[k1240], r0
+        ; block 1240
+
+.define k1241 = 1
+L1241:  cmp #k1241, L428
+        ; block 1241
+
+.define k1242 = 2
+L1242:  bne L833
+        ; block 1242
+
+.define k1243 = 3
+L1243:  jsr EXT
+        ; block 1243
+
+.define k1244 = 4
+L1244:  mov ARR[k1244], r4
+        ; block 1244
+
+.define k1245 = 5
+L1245:  cmp #k1245, L576
+        ; block 1245
+
+.define k1246 = 6
+L1246:  bne L1045
+        ; block 1246
+
+.define k1247 = 7
+L1247:  jsr EXT
+        ; block 1247
+
+.define k1248 = 0
+L1248:  mov ARR[k1248], r0
+        ; block 1248
+
+.define k1249 = 1
+L1249:  cmp #k1249, L724
+        ; block 1249
+
+.define k1250 = 2
+L1250:  bne L1257
+        ; block 1250
+
+.define k1251 = 3
+L1251:  jsr EXT
+        ; block 1251
+
+.define k1252 = 4
+L1252:  mov ARR[k1252], r4
+        ; block 1252
+
+.define k1253 = 5
+L1253:  cmp #k1253, L872
+        ; block 1253
+
+.define k1254 = 6
+L1254:  bne L169
+        ; block 1254
+
+.define k1255 = 7
+L1255:  jsr EXT
+        ; block 1255
+
+.define k1256 = 0
+L1256:  mov ARR[k1256], r0
+        ; block 1256
+
+.define k1257 = 1
+L1257:  cmp #k1257, L1020
+        ; block 1257
+
+.define k1258 = 2
+L1258:  bne L381
+        ; block 1258
+
+.define k1259 = 3
+L1259:  jsr EXT
+        ; block 1259
+
+.define k1260 = 4
+L1260:  mov ARR[k1260], r4
+        ; block 1260
+
+.define k1261 = 5
+L1261:  cmp #k1261, L1168
+        ; block 1261
+
+.define k1262 = 6
+L1262:  bne L593
+        ; block 1262
+
+.define k1263 = 7
+L1263:  jsr EXT
+        ; block 1263
+
+.define k1264 = 0
+L1264:  mov ARR[k1264], r0
+        ; block 1264
+
+.define k1265 = 1
+L1265:  cmp #k1265, L16
+        ; block 1265
+
+.define k1266 = 2
+L1266:  bne L805
+        ; block 1266
+
+.define k1267 = 3
+L1267:  jsr EXT
+        ; block 1267
+
+.define k1268 = 4
+L1268:  mov ARR[k1268], r4
+        ; block 1268
+
+.define k1269 = 5
+L1269:  cmp #k1269, L164
+        ; block 1269
+
+.define k1270 = 6
+L1270:  bne L1017
+        ; block 1270
+
+.define k1271 = 7
+L1271:  jsr EXT
+        ; block 1271
+
+.define k1272 = 0
+L1272:  mov ARR[k1272], r0
+        ; block 1272
+
+.define k1273 = 1
+L1273:  cmp #k1273, L312
+        ; block 1273
+
+.define k1274 = 2
+L1274:  bne L1229
+        ; block 1274
+
+.define k1275 = 3
+L1275:  jsr EXT
+        ; block 1275
+
+.define k1276 = 4
+L1276:  mov ARR[k1276], r4
+        ; block 1276
+
+.define k1277 = 5
+L1277:  cmp #k1277, L460
+        ; block 1277
+
+.define k1278 = 6
+L1278:  bne L141
+        ; block 1278
+
+.define k1279 = 7
+L1279:  jsr EXT
+        ; block 1279
+
+.define k1280 = 0
+L1280:  mov ARR[k1280], r0
+        ; block 1280
+
+.define k1281 = 1
+L1281:  cmp #k1281, L608
+        ; block 1281
+
+.define k1282 = 2
+L1282:  bne L353
+        ; block 1282
+
+.define k1283 = 3
+L1283:  jsr EXT
+        ; block 1283
+
+.define k1284 = 4
+L1284:  mov ARR[k1284], r4
+        ; block 1284
+
+.define k1285 = 5
+L1285:  cmp #k1285, L756
+        ; block 1285
+
+.define k1286 = 6
+L1286:  bne L565
+        ; block 1286
+
+.define k1287 = 7
+L1287:  jsr EXT
+        ; block 1287
+
+.define k1288 = 0
+L1288:  mov ARR[k1288], r0
+        ; block 1288
+
+.define k1289 = 1
+L1289:  cmp #k1289, L904
+        ; block 1289
+
+.define k1290 = 2
+L1290:  bne L777
+        ; block 1290
+
+.define k1291 = 3
+L1291:  jsr EXT
+        ; block 1291
+
+.define k1292 = 4
+L1292:  mov ARR[k1292], r4
+        ; block 1292
+
+.define k1293 = 5
+L1293:  cmp #k1293, L1052
+        ; block 1293
+
+.define k1294 = 6
+L1294:  bne L989
+        ; block 1294
+
+.define k1295 = 7
+L1295:  jsr EXT
+        ; block 1295
+
+.define k1296 = 0
+L1296:  mov ARR[k1296], r0
+        ; block 1296
+
+.define k1297 = 1
+L1297:  cmp #k1297, L1200
+        ; block 1297
+
+.define k1298 = 2
+L1298:  bne L1201
+        ; block 1298
+
+.define k1299 = 3
+L1299:  jsr EXT
+        ; block 1299
+
+END:    hlt
+ARR:    .data 0, 1, -1, 100, -100, 8191, -8192, 16383
@@ -0,0 +1,12 @@
+; .data values out of range, and misplaced commas and quotes
+.define big = 16384
+LOW:    .data -8193
+HIGH:   .data 16384
+NAMED:  .data 1, big
+FIRST:  .data , 1
+LAST:   .data 1, 2,
+DOUBLE: .data 1,, 2
+WORD:   .data 1, two
+OPEN:   .string "abc
+CLOSE:  .string abc"
+NONE:   .string
@@ -0,0 +1,9 @@
+; The ends of the 14 bit range, as numbers and as constants
+.define low = -8192
+.define high = 16383
+.entry EDGES
+MAIN:   prn EDGES[1]
+        hlt
+EDGES:  .data -8192, 16383, low, high
+SIGNS:  .data +5, -1, 0,-0
+TEXT:   .string "a, b"
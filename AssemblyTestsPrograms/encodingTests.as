@@ -0,0 +1,14 @@
+; Direct and extern destinations, indexed externs, one operand index, registers
+.extern EXT
+.entry VAL
+.define two = 2
+MAIN:   mov r1, VAL
+        mov VAL, EXT
+        cmp EXT[two], r2
+        inc TAB[1]
+        clr r5
+        add #3, r6
+        jmp EXT
+        hlt
+VAL:    .data 7
+TAB:    .data 1, -1
@@ -0,0 +1,7 @@
+; Tables that cannot be included
+MISSING: .include "tables/missing.txt"
+RANGE:   .include "tables/range.txt"
+BAD:     .include "tables/bad.txt"
+ODD:     .include "tables/odd.bin"
+NONAME:  .include
+QUOTES:  .include tables/values.txt
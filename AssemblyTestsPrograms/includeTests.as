@@ -0,0 +1,9 @@
+; Data tables kept in files, a text list and 16 bit little endian words
+.entry VALUES
+MAIN:   mov VALUES[2], r3
+        prn WORDS[3]
+        hlt
+VALUES: .include "tables/values.txt"
+WORDS:  .include "tables/words.bin"
+        .include "tables/values.txt"
+END:    .data 7
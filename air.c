@@ -0,0 +1,276 @@
+/* Needed for mmap() and the nanoseconds of the modification times when compiling with -ansi */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "global_definitions.h"
+#include "utility_functions.h"
+#include "identification.h"
+#include "diagnostics.h"
+#include "file_io.h"
+#include "include_file.h"
+#include "air.h"
+
+/* The most words or records a valid file has, so the lengths below never overflow */
+#define MAX_AIR_COUNT (1 << 28)
+
+
+/**
+ * Air Length
+ *
+ * @param header - The header of an ".air" file.
+ * @return The length of the file.
+ */
+static size_t airLength(const AirHeader *header) {
+    return sizeof(AirHeader)
+        + ((size_t)header->entryCount + (size_t)header->externCount) * sizeof(int)
+        + ((size_t)header->codeLength + (size_t)header->dataLength) * sizeof(unsigned short)
+        + (size_t)header->namesLength;
+}
+
+/**
+ * Valid Air
+ *
+ * Checks that a mapped file is an ".air" file this assembler wrote, so loading it never reads past its end.
+ *
+ * @param air - The mapping.
+ * @param length - The length of the mapping.
+ * @return True if the file is valid, False otherwise.
+ */
+static bool validAir(const char *air, size_t length) {
+    const AirHeader *header = (const AirHeader *)air;
+    const char *names;
+    int nameCount = 0;
+    int i;
+
+    if (length < sizeof(AirHeader) || header->magic != AIR_MAGIC) {
+        return False;
+    }
+
+    if (header->codeLength < 0 || header->codeLength > MAX_AIR_COUNT || header->dataLength < 0 || header->dataLength > MAX_AIR_COUNT ||
+        header->entryCount < 0 || header->entryCount > MAX_AIR_COUNT || header->externCount < 0 || header->externCount > MAX_AIR_COUNT ||
+        header->includeCount < 0 || header->includeCount > MAX_AIR_COUNT || header->namesLength < 0 || airLength(header) != length) {
+        return False;
+    }
+
+    /* Every record has its name, the last one terminated */
+    names = air + length - header->namesLength;
+    for (i = 0; i < header->namesLength; i++) {
+        if (names[i] == '\0') {
+            nameCount++;
+        }
+    }
+
+    return (nameCount == header->entryCount + header->externCount + header->includeCount && (header->namesLength == 0 || names[header->namesLength - 1] == '\0'));
+}
+
+bool not_older(const struct stat *first, const struct stat *second) {
+    if (first->st_mtim.tv_sec != second->st_mtim.tv_sec) {
+        return (first->st_mtim.tv_sec > second->st_mtim.tv_sec);
+    }
+
+    return (first->st_mtim.tv_nsec >= second->st_mtim.tv_nsec);
+}
+
+/**
+ * Up to Date
+ *
+ * @param air - A valid ".air" file.
+ * @param length - The length of the file.
+ * @param airStatus - The status of the file.
+ * @param sourceStatus - The status of its source, NULL when it has none.
+ * @return True if the file is not older than its source and the files it includes.
+ */
+static bool upToDate(const char *air, size_t length, const struct stat *airStatus, const struct stat *sourceStatus) {
+    const AirHeader *header = (const AirHeader *)air;
+    const char *names = air + length - header->namesLength;
+    struct stat includeStatus;
+    int i;
+
+    if (sourceStatus != NULL && !not_older(airStatus, sourceStatus)) {
+        return False;
+    }
+
+    /* The included files follow the names of the records */
+    for (i = 0; i < header->entryCount + header->externCount; i++) {
+        names += strlen(names) + 1;
+    }
+
+    /* As for the source, an included file that is not shipped is taken as it was */
+    for (i = 0; i < header->includeCount; i++) {
+        if (stat_file(names, &includeStatus) == 0 ? !not_older(airStatus, &includeStatus) : errno != ENOENT) {
+            return False;
+        }
+
+        names += strlen(names) + 1;
+    }
+
+    return True;
+}
+
+/**
+ * Load Records
+ *
+ * @param buffer - Receives the records.
+ * @param addresses - The addresses of the records.
+ * @param count - The number of records.
+ * @param names - The names of the records, one after the other.
+ * @return The names that follow the names of the records.
+ */
+static const char *loadRecords(OutputBuffer *buffer, const int *addresses, int count, const char *names) {
+    int i;
+
+    reset_output_buffer(buffer);
+
+    for (i = 0; i < count; i++) {
+        append_symbol_record(buffer, names, addresses[i]);
+        names += strlen(names) + 1;
+    }
+
+    return names;
+}
+
+/**
+ * Store Records
+ *
+ * @param buffer - The records.
+ * @param addresses - Receives the addresses of the records.
+ * @param names - Receives the names of the records, one after the other.
+ * @return The end of the names.
+ */
+static char *storeRecords(OutputBuffer *buffer, int *addresses, char *names) {
+    size_t length;
+    int i;
+
+    for (i = 0; i < buffer->records; i++) {
+        addresses[i] = buffer->addresses[i];
+
+        length = strlen(buffer->names + buffer->nameOffsets[i]) + 1;
+        memcpy(names, buffer->names + buffer->nameOffsets[i], length);
+        names += length;
+    }
+
+    return names;
+}
+
+char *map_air_file(const char *sourceFileName, const char *airFileName, size_t *length) {
+    struct stat sourceStatus;
+    struct stat airStatus;
+    bool hasSource;
+    int sourceError;
+    char *air;
+    int fd;
+
+    fd = open_file(airFileName, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    /* A program shipped without its source is taken from the ".air" file as is */
+    hasSource = (stat_file(sourceFileName, &sourceStatus) == 0);
+    sourceError = (hasSource ? 0 : errno);
+    if (fstat(fd, &airStatus) != 0 || airStatus.st_size == 0 || (!hasSource && sourceError != ENOENT)) {
+        close(fd);
+        return NULL;
+    }
+
+    *length = (size_t)airStatus.st_size;
+    air = mmap(NULL, *length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (air == MAP_FAILED) {
+        return NULL;
+    }
+
+    if (!validAir(air, *length) || !upToDate(air, *length, &airStatus, (hasSource ? &sourceStatus : NULL))) {
+        munmap(air, *length);
+        return NULL;
+    }
+
+    return air;
+}
+
+void unmap_air_file(char *air, size_t length) {
+    munmap(air, length);
+}
+
+struct LineTable *load_air_file(const char *air, OutputBuffer *entryRecords, OutputBuffer *externRecords) {
+    const AirHeader *header = (const AirHeader *)air;
+    const int *entryAddresses = (const int *)(header + 1);
+    const int *externAddresses = entryAddresses + header->entryCount;
+    const unsigned short *words = (const unsigned short *)(externAddresses + header->externCount);
+    const char *names = (const char *)(words + header->codeLength + header->dataLength);
+    LineTable *lines = create_line_table(0, 0);
+    int i;
+
+    for (i = 0; i < header->codeLength; i++) {
+        append_word(&lines->code, words[i]);
+    }
+
+    for (i = 0; i < header->dataLength; i++) {
+        append_word(&lines->data, words[header->codeLength + i]);
+    }
+
+    names = loadRecords(entryRecords, entryAddresses, header->entryCount, names);
+    loadRecords(externRecords, externAddresses, header->externCount, names);
+
+    return lines;
+}
+
+char *build_air_file(struct LineTable *lines, OutputBuffer *entryRecords, OutputBuffer *externRecords, size_t *length) {
+    AirHeader header;
+    char *air;
+    int *addresses;
+    unsigned short *words;
+    char *names;
+    size_t pathLength;
+    int i;
+
+    header.magic = AIR_MAGIC;
+    header.codeLength = lines->code.length;
+    header.dataLength = lines->data.length;
+    header.entryCount = entryRecords->records;
+    header.externCount = externRecords->records;
+    header.includeCount = lines->includeCount;
+    header.namesLength = (int)(entryRecords->namesLength + externRecords->namesLength);
+
+    for (i = 0; i < lines->includeCount; i++) {
+        header.namesLength += (int)strlen(lines->includes[i].path) + 1;
+    }
+
+    *length = airLength(&header);
+    air = malloc(*length);
+    if (air == NULL) {
+        memory_allocation_failed();
+    }
+
+    memcpy(air, &header, sizeof(AirHeader));
+
+    addresses = (int *)(air + sizeof(AirHeader));
+    words = (unsigned short *)(addresses + header.entryCount + header.externCount);
+
+    for (i = 0; i < header.codeLength; i++) {
+        words[i] = (unsigned short)(lines->code.words[i] & WORD_MASK);
+    }
+
+    for (i = 0; i < header.dataLength; i++) {
+        words[header.codeLength + i] = (unsigned short)(lines->data.words[i] & WORD_MASK);
+    }
+
+    names = storeRecords(externRecords, addresses + header.entryCount, storeRecords(entryRecords, addresses, (char *)(words + header.codeLength + header.dataLength)));
+
+    for (i = 0; i < lines->includeCount; i++) {
+        pathLength = strlen(lines->includes[i].path) + 1;
+        memcpy(names, lines->includes[i].path, pathLength);
+        names += pathLength;
+    }
+
+    return air;
+}
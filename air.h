@@ -0,0 +1,89 @@
+#ifndef _AIR_H
+#define _AIR_H
+
+#include <stddef.h>
+
+struct stat;
+
+/* Expects global_definitions.h and utility_functions.h to be included first */
+
+/* ------------------------------------ Static Definitions ------------------------------------ */
+
+/* An ".air" file holds a program that was validated and had its labels resolved, ready for the output files.
+ * "ASSEMBLER_AIR=1" writes it next to the ".ob" file, and makes a program whose ".air" file is at least as new as its ".as" file
+ * and the files it includes (or has no ".as" file at all) taken from the ".air" file, without pre-processing or validating it again.
+ * Without it the ".air" files are neither read nor written. The variable is read by the command line (and sent to the daemon
+ * by assembler_client) and reaches the compilation as CompileOptions.air (see compilation.h). */
+#define AIR_VARIABLE "ASSEMBLER_AIR"
+#define AIR_EXTENSION ".air"
+
+/* "AIR2", the layout below changes with the number */
+#define AIR_MAGIC 0x32524941
+
+
+/* ------------------------------------ Data Types ------------------------------------ */
+
+/* Defines the start of an ".air" file, in the byte order of the machine that wrote it. It is followed by:
+ *   the addresses of the entries, then of the externs (ints)
+ *   the words of the code, then of the data (unsigned shorts)
+ *   the names of the entries, then of the externs, then of the included files (null terminated) */
+typedef struct AirHeader
+{
+    int magic;
+    int codeLength;
+    int dataLength;
+    int entryCount;
+    int externCount;
+    int includeCount;
+    int namesLength;
+
+} AirHeader;
+
+
+/* ------------------------------------ Functions ------------------------------------ */
+
+/** not_older
+ *  @brief Compares the modification times of two files, to the nanosecond.
+ *  @param first The status of a file.
+ *  @param second The status of another file.
+ *  @return True if the first file was modified at the same time as the second one or after it.
+ */
+bool not_older(const struct stat *first, const struct stat *second);
+
+/** map_air_file
+ *  @brief Maps an ".air" file into memory, if it is up to date.
+ *  @param sourceFileName The ".as" file the ".air" file was assembled from.
+ *  @param airFileName The ".air" file.
+ *  @param length Receives the length of the mapping.
+ *  @return The mapping, NULL if the file does not exist, is older than the source or one of the files it includes,
+ *          or is not a valid ".air" file.
+ */
+char *map_air_file(const char *sourceFileName, const char *airFileName, size_t *length);
+
+/** unmap_air_file
+ *  @brief Unmaps a file mapped by map_air_file.
+ *  @param air The mapping.
+ *  @param length The length of the mapping.
+ */
+void unmap_air_file(char *air, size_t length);
+
+/** load_air_file
+ *  @brief Takes the segments and the symbol records of a program from its ".air" file.
+ *  @param air The mapping of the file.
+ *  @param entryRecords Receives the entry records, its previous contents are dropped.
+ *  @param externRecords Receives the extern records, its previous contents are dropped.
+ *  @return A table with no lines and the code and the data segments of the program (see identification.h).
+ */
+struct LineTable *load_air_file(const char *air, OutputBuffer *entryRecords, OutputBuffer *externRecords);
+
+/** build_air_file
+ *  @brief Builds the ".air" file of an assembled program.
+ *  @param lines The assembled lines, with their code and data segments and their included files.
+ *  @param entryRecords The entry records of the program.
+ *  @param externRecords The extern records of the program.
+ *  @param length Receives the length of the file.
+ *  @return The contents of the file, allocated with malloc().
+ */
+char *build_air_file(struct LineTable *lines, OutputBuffer *entryRecords, OutputBuffer *externRecords, size_t *length);
+
+#endif
@@ -6,1260 +6,548 @@
 #include "global_definitions.h"
 #include "utility_functions.h"
 #include "identification.h"
+#include "instruction_set.h"
+#include "line_scanner.h"
 #include "error_handling.h"
+#include "file_io.h"
 #include "analysis.h"
+#include "diagnostics.h"
+#include "parallel.h"
+#include "air.h"
+#include "include_file.h"
+
+
+
+/* Defines the extern records of a chunk of lines, merged in the order of the chunks */
+typedef struct ChunkRecords
+{
+    int first;                  /* The first line of the chunk */
+    OutputBuffer *records;
+} ChunkRecords;
+
+/* Defines the encoding of the lines on parallel threads, every line has its address already */
+typedef struct EncodingContext
+{
+    LineTable *lines;
+    HashTable *symbolsLabelsValuesHash;
+    OutputBuffer *externRecords;                /* Receives the records of the first chunk directly */
+    ChunkRecords chunks[MAX_WORKER_THREADS];    /* The records of the other chunks */
+    int chunkCount;                             /* Taken with an atomic increment */
+} EncodingContext;
 
+/**
+ * Label Name
+ *
+ * @param text - A line that begins with a label.
+ * @param labelName - Receives the name of the label.
+ */
+static void labelNameOf(const char *text, char *labelName) {
+    int labelLength = strchr(text, ':') - text;
 
-
-void calculate_memory_addresses_for_instructions(CommandType commandType, char *line, HashTable *symbolsLabelsValuesHash, int * directiveOrder, HashTable *entriesExternsHash, int * currentMemoryAddress) {
-    switch (commandType) {
-        case DATA_DIRECTIVE:
-            break;
-        case STRING_DIRECTIVE:
-            break;
-        case INSTRUCTION:
-            calculate_instruction_memory_address(line, symbolsLabelsValuesHash, entriesExternsHash, currentMemoryAddress);
-            break;
-        default:
-            break;
-
-    }
-}
-
-void calculate_memory_addresses_for_directives(CommandType commandType, char *line, HashTable *symbolsLabelsValuesHash, int * directiveOrder, HashTable *entriesExternsHash, int * currentMemoryAddress) {
-    switch (commandType) {
-        case DATA_DIRECTIVE:
-            calculate_data_directive_memory_address(line, symbolsLabelsValuesHash, directiveOrder, currentMemoryAddress);
-            break;
-        case STRING_DIRECTIVE:
-            calculate_string_directive_memory_address(line, symbolsLabelsValuesHash, directiveOrder, currentMemoryAddress);
-            break;
-        case INSTRUCTION:
-            break;
-        default:
-            break;
-
-    }
+    memcpy(labelName, text, labelLength);
+    labelName[labelLength] = '\0';
 }
 
+/**
+ * Add Symbol Record
+ *
+ * Records a label that is declared as an entry or as an extern for the entry or the extern file.
+ *
+ * @param labelName - The name of the label.
+ * @param address - The address of the label.
+ * @param entriesExternsHash - The hash table containing the entries and externs.
+ * @param entryRecords - The buffer collecting the entry records.
+ * @param externRecords - The buffer collecting the extern records.
+ */
+static void addSymbolRecord(char *labelName, int address, HashTable *entriesExternsHash, OutputBuffer *entryRecords, OutputBuffer *externRecords) {
 
-void build_binary_file(char * inputFileName, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash, HashTable *instructionsHash, HashTable *registersHash){
-
-    char line[MAX_LINE_LENGTH];             /* Buffer to store each line from the file */
-    char outputFileName[MAX_LINE_LENGTH];   /* Buffer to store the output file name */
-    char entryFileName[MAX_LINE_LENGTH];    /* Buffer to store the entry file name */
-    char externFileName[MAX_LINE_LENGTH];   /* Buffer to store the extern file name */
-
-    FILE *inputFile = NULL;                 /* File pointer for the input file */
-    FILE *outputFile = NULL;                /* File pointer for the output file */
-    FILE *entryFile = NULL;                 /* File pointer for the entry file */
-    FILE *externFile = NULL;                /* File pointer for the extern file */
-
-    CommandType commandType;                /* Type of the command in the line */
-
-    int currentMemoryAddress = STARTING_MEMORY_LOCATION;                     /* Line number in the input file */
-
-
-    /* Open the input file */
-    inputFile = openFile(inputFileName, "r");
-
-    /* Open a new file with the same name but a ".am" extension for writing */
-    sprintf(outputFileName, "%s.temp", removeFileExtension(inputFileName));
-    outputFile = openFile(outputFileName, "w");
-
-    sprintf(entryFileName, "%s.ent", removeFileExtension(inputFileName));
-    entryFile = openFile(entryFileName, "w");
-
-    sprintf(externFileName, "%s.ext", removeFileExtension(inputFileName));
-    externFile = openFile(externFileName, "w");
-
-    while (fgets(line, sizeof(line), inputFile) != NULL) {
-        
-        /* Identify the command type */
-        commandType = identifyCommandType(line, instructionsHash);
-        switch (commandType) {
-            case INSTRUCTION:
-                analyze_instruction(line, symbolsLabelsValuesHash, entriesExternsHash, instructionsHash, registersHash, outputFile, entryFile, externFile, &currentMemoryAddress);
-            default:
-                break;
-        }
-
-    }
-
-    /* Move the file pointer to the beginning of the file */
-
-    rewind(inputFile);
-
-    while (fgets(line, sizeof(line), inputFile) != NULL) {
-        
-        /* Identify the command type */
-        commandType = identifyCommandType(line, instructionsHash);
-        switch (commandType) {
-            case DATA_DIRECTIVE:
-                analyze_data_directive(line, symbolsLabelsValuesHash, entriesExternsHash, instructionsHash, outputFile, entryFile, externFile);
-                break;
-            case STRING_DIRECTIVE:
-                analyze_string_directive(line, symbolsLabelsValuesHash, entriesExternsHash, instructionsHash, outputFile, entryFile, externFile);
-                break;
-            case INSTRUCTION:
-                break;
-            default:
-                break;
-
-        }
-
+    if(ht_search(entriesExternsHash, labelName) != NULL && strcmp(ht_get_type(entriesExternsHash, labelName), "entryDirective") == 0){
+        append_symbol_record(entryRecords, labelName, address);
     }
 
-    /* Close the files */
-    fclose(inputFile);
-    fclose(outputFile);
-    fclose(entryFile);
-    fclose(externFile);
-
-    if(entryExists(entriesExternsHash) == False){
-        /* Attempt to delete the file */
-        if (remove(entryFileName) != 0) {
-            perror("Error deleting file");
-        }
+    else if(ht_search(entriesExternsHash, labelName) != NULL && strcmp(ht_get_type(entriesExternsHash, labelName), "externDirective") == 0){
+        append_symbol_record(externRecords, labelName, address);
     }
-
-    if(externExists(entriesExternsHash) == False){
-        /* Attempt to delete the file */
-        if (remove(externFileName) != 0) {
-            perror("Error deleting file");
-        }
-    }
-
 }
 
-void build_encoded_file(char * inputFileName, HashTable *symbolsLabelsValuesHash, int currentMemoryAddress){
-
-    FILE *tempFile = NULL;                 /* File pointer for the input file */
-    FILE *outputFile = NULL;                /* File pointer for the output file */
-
-    char **splitedLine;                     /* Array to store the splited line */
-    int numberOfElements = 0;               /* Reset the elemnts number - for the string spliter counter */
-
-    char line[MAX_LINE_LENGTH];             /* Buffer to store each line from the file */
-    char tempFileName[MAX_LINE_LENGTH];     /* Buffer to store the output file name */
-    char outputFileName[MAX_LINE_LENGTH];   /* Buffer to store the output file name */
-
-    char * encodedBinary = NULL;            /* String to store the encoded representation of the binary string */
-    char * directiveMemorySizeString = NULL;         /* String to store the memory size */
-    char * instructionMemorySizeString = NULL;         /* String to store the memory size */
-
-    sprintf(tempFileName, "%s.temp", removeFileExtension(inputFileName));
-
-    /* Open the input file */
-    tempFile = openFile(tempFileName, "r");
-
-    /* Open a new file with the same name but a ".ob" extension for writing */
-    sprintf(outputFileName, "%s.ob", removeFileExtension(inputFileName));
-    outputFile = openFile(outputFileName, "w");
-
-    directiveMemorySizeString = intToString(get_directives_memory_size(symbolsLabelsValuesHash));
-    instructionMemorySizeString = intToString(currentMemoryAddress - get_directives_memory_size(symbolsLabelsValuesHash) - STARTING_MEMORY_LOCATION);
-
-    /* Write the memory sizes to the output file */
-
-    fputs("  ", outputFile);
-    fputs(instructionMemorySizeString, outputFile);
-    fputs(" ", outputFile);
-    fputs(directiveMemorySizeString, outputFile);
-    fputs("\n", outputFile);
-
-
-    /* Free the memory allocated for the memory size strings */
-    free(directiveMemorySizeString);
-    free(instructionMemorySizeString);
-
-
-    while (fgets(line, sizeof(line), tempFile) != NULL) {
-
-        splitedLine = splitString(line, " ", &numberOfElements);
-
-        /* Encode the binary string */
-        encodedBinary = encodeBinaryString(splitedLine[1]);
-
-        /* Write the encoded line to the output file */
-
-        fputs(splitedLine[0], outputFile);
-        fputs(" ", outputFile);
-        fputs(encodedBinary, outputFile);
-        fputs("\n", outputFile);
-
-        /* Free the memory allocated for the encoded binary string */
-        free(encodedBinary);
-        freeStringArray(splitedLine, numberOfElements);
+/**
+ * Encode Operand
+ *
+ * Writes the words a direct, an indexed or an immediate operand, or a register operand that does not
+ * share its word, adds after the first word of the instruction.
+ *
+ * @param operand - The operand.
+ * @param isSource - True for the source operand, False for the destination operand.
+ * @param lines - The classified lines, receives the words in its code segment.
+ * @param word - The index of the first word of the operand in the code segment.
+ * @param symbolsLabelsValuesHash - The hash table containing the labels, all of them with their address.
+ * @param externRecords - The buffer collecting the extern records.
+ * @return The index of the word after the operand.
+ */
+static int encodeOperand(Operand *operand, bool isSource, LineTable *lines, int word, HashTable *symbolsLabelsValuesHash, OutputBuffer *externRecords) {
 
-    }
+    int *words = lines->code.words;
 
-    /* Close the files */
-    fclose(tempFile);
-    fclose(outputFile);
+    switch (operand->mode) {
+        case IMMEDIATE:
+            words[word++] = (operand->value & 0xFFF) << 2 | ARE_ABSOLUTE;
+            break;
+        case DIRECT:
+        case INDEX:
+            /* An extern is resolved by the linker, at the word that refers to it */
+            if (operand->isExtern) {
+                append_symbol_record(externRecords, operand_symbol(lines, operand), STARTING_MEMORY_LOCATION + word);
+                words[word++] = ARE_EXTERNAL;
+            }
+            else {
+                words[word++] = (get_operand_address(lines, operand, symbolsLabelsValuesHash) & 0xFFF) << 2 | ARE_RELOCATABLE;
+            }
 
-    /* Attempt to delete the file */
-    if (remove(tempFileName) != 0) {
-        perror("Error deleting file");
+            if (operand->mode == INDEX) {
+                words[word++] = (operand->value & 0xFFF) << 2 | ARE_ABSOLUTE;
+            }
+            break;
+        case REGISTER:
+            words[word++] = operand->registerNumber << (isSource ? 5 : 2) | ARE_ABSOLUTE;
+            break;
+        default:
+            break;
     }
 
-
-
+    return word;
 }
 
-void decimalToBinary(int decimal, int numBits, char *binary) {
-    int i; /* Loop counter */
-    if (binary == NULL) {
-        fprintf(stderr, "Memory allocation failed\n");
-        exit(EXIT_FAILURE);
-    }
-
-    /* Handle negative numbers using two's complement */
-    if (decimal < 0) {
-        decimal = (1 << numBits) + decimal; /* Convert to positive value in two's complement */
-    }
+/**
+ * Operand Modes
+ *
+ * @param record - The record of an instruction line.
+ * @param source - Receives the source operand, NULL when there is none.
+ * @param destination - Receives the destination operand, NULL when there is none.
+ * @param sourceMode - Receives the addressing mode of the source operand.
+ * @param destinationMode - Receives the addressing mode of the destination operand.
+ */
+static void operandModes(LineRecord *record, Operand **source, Operand **destination, AddressingMode *sourceMode, AddressingMode *destinationMode) {
 
+    /* A single operand instruction only has a destination operand */
+    *source = (record->operandCount == 2 ? &record->operands[0] : NULL);
+    *destination = (record->operandCount > 0 ? &record->operands[record->operandCount - 1] : NULL);
 
-    /* Convert decimal to binary */
-    for (i = numBits - 1; i >= 0; i--) {
-        binary[i] = (decimal & 1) ? '1' : '0'; /* Extract the least significant bit */
-        decimal >>= 1; /* Shift right to get next bit */
-    }
-    binary[numBits] = '\0'; /* Null-terminate the string */
-
+    *sourceMode = (*source != NULL ? (*source)->mode : IMMEDIATE);
+    *destinationMode = (*destination != NULL ? (*destination)->mode : IMMEDIATE);
 }
 
+/**
+ * Define Instruction Label
+ *
+ * Gives the label of an instruction line the address of the instruction.
+ *
+ * @param lines - The classified lines, with the address and the size of the instruction line.
+ * @param line - The instruction line.
+ * @param symbolsLabelsValuesHash - The hash table containing the labels.
+ * @param entriesExternsHash - The hash table containing the entries and externs.
+ * @param entryRecords - The buffer collecting the entry records.
+ * @param externRecords - The buffer collecting the extern records.
+ */
+static void defineInstructionLabel(LineTable *lines, int line, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash, OutputBuffer *entryRecords, OutputBuffer *externRecords) {
 
-void calculate_data_directive_memory_address(char * line, HashTable *symbolsLabelsValuesHash, int * directiveOrder, int * currentMemoryAddress){
-
-    char **splitedLine;                    /* Array to store the splited line */
-    int numberOfElements = 0;              /* Reset the elemnts number - for the string spliter counter */
-    int i = 0;                             /* Loop counter */
-    char * directiveOrderString = NULL;    /* String to store the directive order */
-    int memorySize;                        /* The size of the memory to be allocated */
-    char * memorySizeString = NULL;        /* String to store the memory size */
-    int memoryAddress;                     /* The memory address of the directive */
-    char * memoryAddressString = NULL;     /* String to store the memory address */
-
-    /* copy line to side variable */
-    char* originalLine = malloc(strlen(line) + 1);
-
-    char labelName[MAX_LABEL_LENGTH];
-    char value[MAX_LINE_LENGTH];
-    char variableValue[MAX_LINE_LENGTH] = "";
-
-    if (originalLine == NULL) {
-        perror(MEMORY_ALLOCATION_ERROR);
-        exit(EXIT_FAILURE);
-    }
-
-    strcpy(originalLine, line);
-
-
-    /* Skip leading whitespaces */
-    while (*line && (*line == ' ' || *line == '\t')) {
-        line++;
-    }
-
-
-    removeSubstring(line, ".data");
-
-
-    if(hasLabel(line)){
-
-        splitedLine = splitString(line, ":", &numberOfElements);
-
-        /* copy the label name to the labelName variable */
-        strcpy(labelName, splitedLine[0]);
-
-        /* copy the value to the value variable */
-        strcpy(value, splitedLine[1]);
-    }
-
-    numberOfElements = 0;
-
-    strcat(labelName, ":");
-    removeSubstring(line, labelName);
-    removeSubstring(labelName, ":");
-
-    removeWhiteSpaces(line);
-
-    splitedLine = splitString(line, ",", &numberOfElements);
-
-    for (i = 0; i < numberOfElements; i++) {
-
-        /* Add the string to value */
-
-        if(ht_search(symbolsLabelsValuesHash, splitedLine[i]) != NULL){
-            strcat(variableValue, ht_search(symbolsLabelsValuesHash, splitedLine[i]));
-            strcat(variableValue, ",");
-        }
-
-        else{
-            strcat(variableValue, splitedLine[i]);
-            strcat(variableValue, ",");
-        }
-
-
-    }
-
-    removeLastCharacter(variableValue);
-
-
-    
-    if(hasLabel(originalLine)){
-
-        directiveOrderString = intToString(*directiveOrder);
-        memorySize = numberOfElements;
-        memorySizeString = intToString(memorySize);
-
-        memoryAddress = *currentMemoryAddress;
-        *currentMemoryAddress += memorySize;
-
-        memoryAddressString = intToString(memoryAddress);
-
-        ht_insert(symbolsLabelsValuesHash, labelName, variableValue, "dataDirective", memoryAddressString, memorySizeString, directiveOrderString);
-
-        (*directiveOrder)++;
-
-        free(directiveOrderString);
-        free(memorySizeString);
-        free(memoryAddressString);
-    }
-    
-
-    freeStringArray(splitedLine, numberOfElements);
-    free(originalLine);
+    char labelName[MAX_LINE_LENGTH * 2];
+    char * memorySizeString = intToString(lines->wordCounts[line]);   /* String to store the memory size */
+    char * memoryAddressString = intToString(lines->addresses[line]); /* String to store the memory address */
 
-    return;
+    labelNameOf(LINE_TEXT(lines, line), labelName);
 
+    ht_insert(symbolsLabelsValuesHash, labelName, "NULL", "instruction", memoryAddressString, memorySizeString, "-1");
+    addSymbolRecord(labelName, lines->addresses[line], entriesExternsHash, entryRecords, externRecords);
 
+    free(memorySizeString);
+    free(memoryAddressString);
 }
 
+/**
+ * Encode Instruction
+ *
+ * Writes the words of an instruction to the code segment, at its address.
+ *
+ * @param lines - The classified lines, with the operands parsed by the validation, receives the words in its code segment.
+ * @param line - The instruction line.
+ * @param symbolsLabelsValuesHash - The hash table containing the labels, all of them with their address.
+ * @param externRecords - The buffer collecting the extern records.
+ */
+static void encodeInstruction(LineTable *lines, int line, HashTable *symbolsLabelsValuesHash, OutputBuffer *externRecords) {
 
-void calculate_string_directive_memory_address(char * line, HashTable *symbolsLabelsValuesHash, int * directiveOrder, int * currentMemoryAddress){
-
-    char **splitedLine;                    /* Array to store the splited line */
-    int numberOfElements = 0;              /* Reset the elemnts number - for the string spliter counter */
-    char * directiveOrderString = NULL;    /* String to store the directive order */
-    int memorySize;                        /* The size of the memory to be allocated */
-    char * memorySizeString = NULL;        /* String to store the memory size */
-    int memoryAddress;                     /* The memory address of the directive */
-    char * memoryAddressString = NULL;     /* String to store the memory address */
+    Operand *source, *destination;
+    AddressingMode sourceMode, destinationMode;
+    int word = lines->addresses[line] - STARTING_MEMORY_LOCATION;
 
-    /* copy line to side variable */
-    char* originalLine = malloc(strlen(line) + 1);
+    operandModes(&lines->records[line], &source, &destination, &sourceMode, &destinationMode);
 
-    char labelName[MAX_LABEL_LENGTH];
-    char value[MAX_LINE_LENGTH];
+    lines->code.words[word++] = lines->firstWords[line];
 
-    if (originalLine == NULL) {
-        perror(MEMORY_ALLOCATION_ERROR);
-        exit(EXIT_FAILURE);
+    /* Two registers share a single word */
+    if (sourceMode == REGISTER && destinationMode == REGISTER && source != NULL) {
+        lines->code.words[word] = source->registerNumber << 5 | destination->registerNumber << 2 | ARE_ABSOLUTE;
+        return;
     }
 
-    strcpy(originalLine, line);
-
-
-    /* Skip leading whitespaces */
-    while (*line && (*line == ' ' || *line == '\t')) {
-        line++;
+    if (source != NULL) {
+        word = encodeOperand(source, True, lines, word, symbolsLabelsValuesHash, externRecords);
     }
 
-    removeSubstring(line, ".string");
-
-    if(hasLabel(line)){
-
-        splitedLine = splitString(line, ":", &numberOfElements);
-
-        strcpy(labelName, splitedLine[0]);
-        strcpy(value, splitedLine[1]);
+    if (destination != NULL) {
+        encodeOperand(destination, False, lines, word, symbolsLabelsValuesHash, externRecords);
     }
-
-    numberOfElements = 0;
-
-    strcat(labelName, ":");
-    removeSubstring(line, labelName);
-    removeSubstring(labelName, ":");
-
-    removeWhiteSpaces(line);
-
-    if(hasLabel(originalLine)){
-
-        removeLeadingSpaces(value);
-        directiveOrderString = intToString(*directiveOrder);
-        /* Calculate the string size - both of the quotes + /0 character */
-        memorySize = countCharacters(value) - 1;
-
-        memorySizeString = intToString(memorySize);
-        memoryAddress = *currentMemoryAddress;
-
-        *currentMemoryAddress += memorySize;
-        memoryAddressString = intToString(memoryAddress);
-
-        ht_insert(symbolsLabelsValuesHash, labelName, value, "stringDirective", memoryAddressString, memorySizeString, directiveOrderString);
-
-        (*directiveOrder)++;
-
-        free(directiveOrderString);
-        free(memorySizeString);
-        free(memoryAddressString);
-
-    }
-
-    freeStringArray(splitedLine, numberOfElements);
-    free(originalLine);
-
-    return;
-
 }
 
+/**
+ * Define Data Label
+ *
+ * Gives the label of a data, a string or an include line its address, once the size of the code segment is known.
+ *
+ * @param lines - The classified lines, receives the address of the line.
+ * @param line - The data, string or include line.
+ * @param dataAddress - The address of the data segment.
+ * @param directiveOrder - The order of the directive among the labelled directives.
+ * @param symbolsLabelsValuesHash - The hash table containing the labels.
+ * @param entriesExternsHash - The hash table containing the entries and externs.
+ * @param entryRecords - The buffer collecting the entry records.
+ * @param externRecords - The buffer collecting the extern records.
+ */
+static void defineDataLabel(LineTable *lines, int line, int dataAddress, int directiveOrder, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash, OutputBuffer *entryRecords, OutputBuffer *externRecords) {
 
-void calculate_instruction_memory_address(char * line, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash, int * currentMemoryAddress){
-
-    char **splitedLine;                    /* Array to store the splited line */
-    int numberOfElements = 0;              /* Reset the elemnts number - for the string spliter counter */
-    int memorySize = 1;                    /* The size of the memory to be allocated */
-    char * memorySizeString = NULL;        /* String to store the memory size */
-    int memoryAddress;                     /* The memory address of the directive */
-    char * memoryAddressString = NULL;     /* String to store the memory address */
-
-    AddressingMode operand1AddressingMode;
-    AddressingMode operand2AddressingMode;
-
-    /* copy line to side variable */
-    char* originalLine = malloc(strlen(line) + 1);
-
-    char labelName[MAX_LABEL_LENGTH];
-    char instruction[4];
+    char labelName[MAX_LINE_LENGTH * 2];
+    char * directiveOrderString = intToString(directiveOrder);
+    char * memorySizeString = intToString(lines->wordCounts[line]);
+    char * memoryAddressString = NULL;
 
-    if (originalLine == NULL) {
-        perror(MEMORY_ALLOCATION_ERROR);
-        exit(EXIT_FAILURE);
-    }
+    lines->addresses[line] = dataAddress + lines->records[line].dataOffset;
+    memoryAddressString = intToString(lines->addresses[line]);
 
-    strcpy(originalLine, line);
+    labelNameOf(LINE_TEXT(lines, line), labelName);
 
-    /* Skip leading whitespaces */
-    while (*line && (*line == ' ' || *line == '\t')) {
-        line++;
-    }
+    ht_insert(symbolsLabelsValuesHash, labelName, "NULL", (lines->kinds[line] == STRING_DIRECTIVE ? "stringDirective" : "dataDirective"), memoryAddressString, memorySizeString, directiveOrderString);
+    addSymbolRecord(labelName, lines->addresses[line], entriesExternsHash, entryRecords, externRecords);
 
-    if(hasLabel(line)){
+    free(directiveOrderString);
+    free(memorySizeString);
+    free(memoryAddressString);
+}
 
-        splitedLine = splitString(line, ":", &numberOfElements);
+/**
+ * Reserve Words
+ *
+ * Sizes a segment for words written at their index rather than appended.
+ *
+ * @param segment - The segment.
+ * @param length - The number of words.
+ */
+static void reserveWords(Segment *segment, int length) {
 
-        strcpy(labelName, splitedLine[0]);
+    if (length > segment->capacity) {
+        segment->capacity = length;
+        segment->words = realloc(segment->words, segment->capacity * sizeof(int));
 
-        freeStringArray(splitedLine, numberOfElements);
-        
+        if (segment->words == NULL) {
+            memory_allocation_failed();
+        }
     }
 
-    strcat(labelName, ":");
-    removeSubstring(line, labelName);
-    removeSubstring(labelName, ":");
-
-    numberOfElements = 0;
-    removeLeadingSpaces(line);
-
-    splitedLine = splitString(line, " ", &numberOfElements);
-    strcpy(instruction, splitedLine[0]);
-
-    freeStringArray(splitedLine, numberOfElements);
-    removeWhiteSpaces(instruction);
-
-    removeSubstring(line, instruction);
-
-    if (strcmp(instruction, "mov") == 0 || strcmp(instruction, "cmp") == 0 || strcmp(instruction, "add") == 0 ||
-        strcmp(instruction, "sub") == 0 || strcmp(instruction, "lea") == 0) {
-
-
-            removeLeadingSpaces(line);
-            numberOfElements = 0;
-            splitedLine = splitString(line, ",", &numberOfElements);
-
-            operand1AddressingMode = analyzeAddressingMode(splitedLine[0], symbolsLabelsValuesHash, entriesExternsHash);
-            operand2AddressingMode = analyzeAddressingMode(splitedLine[1], symbolsLabelsValuesHash, entriesExternsHash);
-
-            freeStringArray(splitedLine, numberOfElements);
-
-            if(operand1AddressingMode == IMMEDIATE){
-                memorySize += 1;
-            }
-
-            else if(operand1AddressingMode == DIRECT){
-                memorySize += 1;
-            }
-
-            else if(operand1AddressingMode == INDEX){
-                memorySize += 2;
-            }
-
-            else if(operand1AddressingMode == REGISTER){
-                memorySize += 1;
-            }
-
-            if(operand2AddressingMode == IMMEDIATE){
-                memorySize += 1;
-            }
-
-            else if(operand2AddressingMode == DIRECT){
-                memorySize += 1;
-            }
-
-            else if(operand2AddressingMode == INDEX){
-                memorySize += 2;
-            }
-
-            else if(operand2AddressingMode == REGISTER){
-                memorySize += 1;
-            }
-
-            /* If both operands are registers, then the memory size should be decreased by 1 */
-            if(operand1AddressingMode == REGISTER && operand2AddressingMode == REGISTER){
-                memorySize -= 1;
-            }
+    segment->length = length;
+}
 
+/**
+ * Assign Addresses
+ *
+ * Gives every line its address and size, and every label its address, in a single pass over the lines.
+ * The words are not encoded yet, but every word has its place in the segments (the validation laid out the data segment).
+ *
+ * @param lines - The classified lines.
+ * @param symbolsLabelsValuesHash - The hash table containing the symbols, receives the label addresses.
+ * @param entriesExternsHash - The hash table containing the entries and externs.
+ * @param entryRecords - The buffer collecting the entry records.
+ * @param externRecords - The buffer collecting the extern records.
+ */
+static void assignAddresses(LineTable *lines, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash, OutputBuffer *entryRecords, OutputBuffer *externRecords) {
 
+    Operand *source, *destination;
+    AddressingMode sourceMode, destinationMode;
+    int codeLength = 0;
+    int *dataLabels;                        /* The labelled data, string and include lines, in the order of the source */
+    int dataLabelCount = 0;
+    int i;
 
+    dataLabels = malloc((lines->count + 1) * sizeof(int));
+    if (dataLabels == NULL) {
+        memory_allocation_failed();
     }
 
-    else if (strcmp(instruction, "not") == 0 || strcmp(instruction, "clr") == 0 || strcmp(instruction, "inc") == 0 ||
-               strcmp(instruction, "dec") == 0 || strcmp(instruction, "jmp") == 0 || strcmp(instruction, "bne") == 0 ||
-               strcmp(instruction, "red") == 0 || strcmp(instruction, "prn") == 0 || strcmp(instruction, "jsr") == 0) {
-
-
-        removeLeadingSpaces(line);
-        numberOfElements = 0;
-        splitedLine = splitString(line, " ", &numberOfElements);
-        operand1AddressingMode = analyzeAddressingMode(splitedLine[0], symbolsLabelsValuesHash, entriesExternsHash);
-
-        freeStringArray(splitedLine, numberOfElements);
-
-        if(operand1AddressingMode == IMMEDIATE){
-            memorySize += 1;
-        }
+    for (i = 0; i < lines->count; i++) {
+        switch (lines->kinds[i]) {
+            case INSTRUCTION:
+                operandModes(&lines->records[i], &source, &destination, &sourceMode, &destinationMode);
 
-        else if(operand1AddressingMode == DIRECT){
-            memorySize += 1;
-        }
+                lines->addresses[i] = STARTING_MEMORY_LOCATION + codeLength;
+                lines->wordCounts[i] = instruction_words(lines->records[i].instruction, sourceMode, destinationMode);
+                lines->firstWords[i] = (unsigned short)first_word(lines->records[i].instruction, sourceMode, destinationMode);
+                codeLength += lines->wordCounts[i];
 
-        else if(operand1AddressingMode == INDEX){
-            memorySize += 2;
-        }
+                if (lines->labelLengths[i] > 0) {
+                    defineInstructionLabel(lines, i, symbolsLabelsValuesHash, entriesExternsHash, entryRecords, externRecords);
+                }
+                break;
+            case DATA_DIRECTIVE:
+            case STRING_DIRECTIVE:
+            case INCLUDE_DIRECTIVE:
 
-        /* Must be REGISTER mode*/
-        else{
-            memorySize += 1;
+                /* The validation kept the place of a labelled directive in the data segment */
+                if (lines->labelLengths[i] > 0) {
+                    dataLabels[dataLabelCount++] = i;
+                }
+                break;
+            default:
+                break;
         }
-
-
     }
 
-    memorySizeString = intToString(memorySize);
-    memoryAddress = *currentMemoryAddress;
-    *currentMemoryAddress += memorySize;
-    memoryAddressString = intToString(memoryAddress);
-
-    if(hasLabel(originalLine)){
-        ht_insert(symbolsLabelsValuesHash, labelName, "NULL", "instruction", memoryAddressString, memorySizeString, "-1");
+    /* The data segment follows the code segment */
+    for (i = 0; i < dataLabelCount; i++) {
+        defineDataLabel(lines, dataLabels[i], STARTING_MEMORY_LOCATION + codeLength, i, symbolsLabelsValuesHash, entriesExternsHash, entryRecords, externRecords);
     }
 
-    free(memorySizeString);
-    free(memoryAddressString);
-    free(originalLine);
-
-    return;
+    reserveWords(&lines->code, codeLength);
 
+    free(dataLabels);
 }
 
-AddressingMode analyzeAddressingMode(char *operand, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash) {
-
-
-    cleanCommand(operand);
-
-    /* If the operand starts with a '#' suspect immediate addressing mode */
-    if (operand[0] == '#') {
-        return IMMEDIATE;
-    /* If there is a use of existing data directive or string directive return direct addressing mode*/
-    } else if ((ht_search(symbolsLabelsValuesHash, operand) != NULL) || (ht_search(entriesExternsHash, operand) != NULL )) {
-        return DIRECT;
+/**
+ * Encode a Chunk of Lines
+ *
+ * The worker of run_chunks(), writes the words of the lines [first, last) at their addresses.
+ * The extern records of the chunk are kept apart until the chunks before it are done.
+ *
+ * @param argument - The encoding context.
+ * @param first - The first line.
+ * @param last - The line after the last line.
+ */
+static void encodeLineChunk(void *argument, int first, int last) {
 
-    /* If the opernad contains a '[' and a ']' and a valid integer in between suspect index addressing mode */
-    } else if (strchr(operand, '[') != NULL && strchr(operand, ']') != NULL) {
-            return INDEX;
+    EncodingContext *context = (EncodingContext *)argument;
+    LineTable *lines = context->lines;
+    OutputBuffer *externRecords = context->externRecords;
+    int chunk;
+    int i;
 
-    /* If the operand is a register return register addressing mode */
-    } else if (strcmp(operand, "r0") == 0 || strcmp(operand, "r1") == 0 || strcmp(operand, "r2") == 0 || strcmp(operand, "r3") == 0 || strcmp(operand, "r4") == 0 || strcmp(operand, "r5") == 0 || strcmp(operand, "r6") == 0 || strcmp(operand, "r7") == 0) {
-        return REGISTER;
+    if (first > 0) {
+        externRecords = create_output_buffer();
 
-    } else {
-        return UNDEFINED_ADDRESSING;
+        chunk = __atomic_fetch_add(&context->chunkCount, 1, __ATOMIC_RELAXED);
+        context->chunks[chunk].first = first;
+        context->chunks[chunk].records = externRecords;
     }
-}
-
-void analyze_data_directive(char * line, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash, HashTable *instructionsHash, FILE *outputFile, FILE *entryFile, FILE *externFile){
 
-    char **splitedLine;                    /* Array to store the splited line */
-    int numberOfElements = 0;              /* Reset the elemnts number - for the string spliter counter */
-    int i = 0;                             /* Loop counter */
-    char * binary = NULL;                  /* String to store the binary representation of the decimal number */
-
-    char labelName[MAX_LABEL_LENGTH];
-    char value[MAX_LINE_LENGTH];
-
-    /* Skip leading whitespaces */
-    while (*line && (*line == ' ' || *line == '\t')) {
-        line++;
+    for (i = first; i < last; i++) {
+        switch (lines->kinds[i]) {
+            case INSTRUCTION:
+                encodeInstruction(lines, i, context->symbolsLabelsValuesHash, externRecords);
+                break;
+            case INCLUDE_DIRECTIVE:
+                generate_include_directive(lines, i);
+                break;
+            default:
+                break;
+        }
     }
+}
 
-    removeSubstring(line, ".data");
-
-
-    if(hasLabel(line)){
+void generate_code(LineTable *lines, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash, OutputBuffer *entryRecords, OutputBuffer *externRecords) {
 
-        splitedLine = splitString(line, ":", &numberOfElements);
+    EncodingContext context;
+    ChunkRecords chunk;
+    OutputBuffer *records;
+    int i, j;
 
-        strcpy(labelName, splitedLine[0]);
-        freeStringArray(splitedLine, numberOfElements);
+    /* The addresses first, then every line can be encoded on its own */
+    assignAddresses(lines, symbolsLabelsValuesHash, entriesExternsHash, entryRecords, externRecords);
 
-        strcpy(value, ht_search(symbolsLabelsValuesHash, labelName));
+    context.lines = lines;
+    context.symbolsLabelsValuesHash = symbolsLabelsValuesHash;
+    context.externRecords = externRecords;
+    context.chunkCount = 0;
 
-        /* if the label is an entry or an extern, write it to the entry or extern file */
+    run_chunks(lines->count, MIN_ENCODED_LINES_PER_THREAD, encodeLineChunk, &context);
 
-        if(ht_search(entriesExternsHash, labelName) != NULL && strcmp(ht_get_type(entriesExternsHash, labelName), "entryDirective") == 0){
-            fprintf(entryFile, "%s %04d\n", labelName, stringToInt(ht_get_memory_address(symbolsLabelsValuesHash, labelName)));
-        }
-        
-        else if(ht_search(entriesExternsHash, labelName) != NULL && strcmp(ht_get_type(entriesExternsHash, labelName), "externDirective") == 0){
-            fprintf(externFile, "%s %04d\n", labelName, stringToInt(ht_get_memory_address(symbolsLabelsValuesHash, labelName)));
+    /* The chunks finish in any order, their records go to the extern file in the order of their lines */
+    for (i = 1; i < context.chunkCount; i++) {
+        chunk = context.chunks[i];
+        for (j = i; j > 0 && context.chunks[j - 1].first > chunk.first; j--) {
+            context.chunks[j] = context.chunks[j - 1];
         }
+        context.chunks[j] = chunk;
     }
 
-    numberOfElements = 0;
-
-    splitedLine = splitString(value, ",", &numberOfElements);
-
-    for (i = 0; i < numberOfElements; i++) {
-
-        /* Write line to the output file */
-        binary = (char *)malloc(14 + 1); /* Allocate memory for the binary string */
-        decimalToBinary(stringToInt(splitedLine[i]), 14, binary);
+    for (i = 0; i < context.chunkCount; i++) {
+        records = context.chunks[i].records;
 
-        fprintf(outputFile, "%04d ", stringToInt(ht_get_memory_address(symbolsLabelsValuesHash, labelName)) + i);
-        fputs(binary, outputFile);
-        fputs("\n", outputFile);
-
-        free(binary);
+        for (j = 0; j < records->records; j++) {
+            append_symbol_record(externRecords, records->names + records->nameOffsets[j], records->addresses[j]);
+        }
 
+        free_output_buffer(records);
     }
-
-    freeStringArray(splitedLine, numberOfElements);
-
-    return;
-
 }
 
-void analyze_string_directive(char * line, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash, HashTable *instructionsHash, FILE *outputFile, FILE *entryFile, FILE *externFile){
-
-    char **splitedLine;                    /* Array to store the splited line */
-    int numberOfElements = 0;              /* Reset the elemnts number - for the string spliter counter */
-    int i;                                 /* Loop counter */
-    int counter = 0;                       /* Counter to count the number of characters in the string */
-    char * binary = NULL;                  /* String to store the binary representation of the decimal number */
-
-    char labelName[MAX_LABEL_LENGTH];
-    char value[MAX_LINE_LENGTH];
-
-    /* Skip leading whitespaces */
-    while (*line && (*line == ' ' || *line == '\t')) {
-        line++;
-    }
-
-    removeSubstring(line, ".data");
-
-
-    if(hasLabel(line)){
+/**
+ * Write Segment
+ *
+ * @param output - Receives the lines of the segment, 13 characters each.
+ * @param segment - The segment to write.
+ * @param address - The address of the first word of the segment.
+ * @return The number of characters written.
+ */
+static size_t writeSegment(char *output, Segment *segment, int address) {
 
-        splitedLine = splitString(line, ":", &numberOfElements);
+    char binary[14 + 1];                    /* String to store the binary representation of a word */
+    char * encodedBinary = NULL;            /* String to store the encoded representation of the binary string */
+    size_t length = 0;
+    int i;
 
-        strcpy(labelName, splitedLine[0]);
-        freeStringArray(splitedLine, numberOfElements);
+    for (i = 0; i < segment->length; i++) {
 
-        strcpy(value, ht_search(symbolsLabelsValuesHash, labelName));
+        decimalToBinary(segment->words[i], 14, binary);
+        encodedBinary = encodeBinaryString(binary);
 
-        /* if the label is an entry or an extern, write it to the entry or extern file */
-        if(ht_search(entriesExternsHash, labelName) != NULL && strcmp(ht_get_type(entriesExternsHash, labelName), "entryDirective") == 0){
-            fprintf(entryFile, "%s %04d\n", labelName, stringToInt(ht_get_memory_address(symbolsLabelsValuesHash, labelName)));
-        }
+        length += sprintf(output + length, "%04d %s\n", address + i, encodedBinary);
 
-        else if(ht_search(entriesExternsHash, labelName) != NULL && strcmp(ht_get_type(entriesExternsHash, labelName), "externDirective") == 0){
-            fprintf(externFile, "%s %04d\n", labelName, stringToInt(ht_get_memory_address(symbolsLabelsValuesHash, labelName)));
-        }
+        free(encodedBinary);
     }
 
-    for (i = 1; value[i+1] != '\0'; i++) {
-
-        /* Write line to the output file */
-        binary = (char *)malloc(14 + 1); /* Allocate memory for the binary string */
-        decimalToBinary((int)(value[i]), 14, binary);
-
-        fprintf(outputFile, "%04d ", stringToInt(ht_get_memory_address(symbolsLabelsValuesHash, labelName)) + (i - 1));
-        fputs(binary, outputFile);
-        fputs("\n", outputFile);
-
-        counter++;
+    return length;
+}
 
-        free(binary);
+char *build_encoded_file(LineTable *lines, size_t *length){
 
+    char * encodedFile = NULL;              /* The contents of the ".ob" file */
+    int words = lines->code.length + lines->data.length;
 
+    /* The memory sizes line, then a line of an address (4 digits, more past 9999), a space, 7 symbols and a '\n' for every word */
+    encodedFile = (char *)malloc(2 * 12 + 4 + (size_t)words * (11 + 1 + 7 + 1) + 1);
+    if (encodedFile == NULL) {
+        memory_allocation_failed();
     }
 
-    /* add the null terminator */
-    fprintf(outputFile, "%04d ", stringToInt(ht_get_memory_address(symbolsLabelsValuesHash, labelName)) + counter);
-    fputs("00000000000000", outputFile);
-    fputs("\n", outputFile);
+    /* Write the memory sizes to the output file */
+    *length = sprintf(encodedFile, "  %d %d\n", lines->code.length, lines->data.length);
 
-    return;
+    *length += writeSegment(encodedFile + *length, &lines->code, STARTING_MEMORY_LOCATION);
+    *length += writeSegment(encodedFile + *length, &lines->data, STARTING_MEMORY_LOCATION + lines->code.length);
 
+    return encodedFile;
 }
 
-void analyze_instruction(char * line, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash, HashTable *instructionsHash, HashTable *registersHash, FILE *outputFile, FILE *entryFile, FILE *externFile, int * currentMemoryAddress){
-
-    char **splitedLine;                    /* Array to store the splited line */
-    int numberOfElements = 0;              /* Reset the elemnts number - for the string spliter counter */
-
-    int memorySize = 1;                    /* The size of the memory to be allocated */
-    int labelIndex;
-
-    char * binary = NULL;                  /* String to store the binary representation of the decimal number */
-
-    bool alsoRegister = False;
+void commit_output_files(char * inputFileName, char * objectFile, size_t objectLength, OutputBuffer *entryRecords, OutputBuffer *externRecords, FileBatch *batch){
 
-    AddressingMode operand1AddressingMode;
-    AddressingMode operand2AddressingMode;
+    char outputFileName[MAX_LINE_LENGTH];                       /* Buffer to store the output file name */
+    char * baseName = removeFileExtension(inputFileName);       /* The file name without the extension */
+    char * records = NULL;                                      /* The formatted entry or extern records */
+    size_t recordsLength;
 
-    /* Allocate memory for the binary string */
-
-    char firstWordbinaryCode[15] = ""; 
-    char secondWordbinaryCode[15] = ""; 
-    char thirdWordbinaryCode[15] = ""; 
-    char fourthWordbinaryCode[15] = ""; 
-    char fifthWordbinaryCode[15] = ""; 
-
-    bool hasSecondWord = False;
-    bool hasThirdWord = False;
-    bool hasFourthWord = False;
-    bool hasFifthWord = False;
-    
-    char labelName[MAX_LABEL_LENGTH];
-    char instruction[4];
-
-    /* Skip leading whitespaces */
-    while (*line && (*line == ' ' || *line == '\t')) {
-        line++;
+    /* The entry and extern files are created only if records were collected for them,
+       otherwise a file left over from a previous run is removed */
+    sprintf(outputFileName, "%s.ent", baseName);
+    if ((records = format_output_buffer(entryRecords, &recordsLength)) != NULL) {
+        batch_write_file(batch, outputFileName, records, recordsLength);
     }
-
-    strcat(firstWordbinaryCode,  "0000");
-
-    if(hasLabel(line)){
-
-        splitedLine = splitString(line, ":", &numberOfElements);
-
-        strcpy(labelName, splitedLine[0]);
-
-        /* if the label is an entry or an extern, write it to the entry or extern file */
-        if(ht_search(entriesExternsHash, labelName) != NULL && strcmp(ht_get_type(entriesExternsHash, labelName), "entryDirective") == 0){
-            fprintf(entryFile, "%s %04d\n", labelName, *currentMemoryAddress);
-        }
-
-        else if(ht_search(entriesExternsHash, labelName) != NULL && strcmp(ht_get_type(entriesExternsHash, labelName), "externDirective") == 0){
-            fprintf(externFile, "%s %04d\n", labelName, *currentMemoryAddress);
-        }
-
-        freeStringArray(splitedLine, numberOfElements);
-        
+    else {
+        batch_remove_file(batch, outputFileName);
     }
 
-    strcat(labelName, ":");
-    removeSubstring(line, labelName);
-    removeSubstring(labelName, ":");
-
-    numberOfElements = 0;
-    removeLeadingSpaces(line);
-
-    splitedLine = splitString(line, " ", &numberOfElements);
-    strcpy(instruction, splitedLine[0]);
-
-    freeStringArray(splitedLine, numberOfElements);
-    removeWhiteSpaces(instruction);
-
-    removeSubstring(line, instruction);
-    strcat(firstWordbinaryCode, ht_search(instructionsHash, instruction));
-
-
-    if (strcmp(instruction, "mov") == 0 || strcmp(instruction, "cmp") == 0 || strcmp(instruction, "add") == 0 ||
-        strcmp(instruction, "sub") == 0 || strcmp(instruction, "lea") == 0) {
-
-
-            removeLeadingSpaces(line);
-            numberOfElements = 0;
-            splitedLine = splitString(line, ",", &numberOfElements);
-
-            /* Analyze the addressing mode of the operands */
-            operand1AddressingMode = analyzeAddressingMode(splitedLine[0], symbolsLabelsValuesHash, entriesExternsHash);
-            operand2AddressingMode = analyzeAddressingMode(splitedLine[1], symbolsLabelsValuesHash, entriesExternsHash);
-
-            if(operand1AddressingMode == IMMEDIATE){
-                memorySize += 1;
-                strcat(firstWordbinaryCode, "00");
-
-                hasSecondWord = True;
-                binary = (char *)malloc(12 + 1); /* Allocate memory for the binary string */
-                decimalToBinary(get_imidiate_data(splitedLine[0], symbolsLabelsValuesHash, entriesExternsHash), 12, binary);
-                strcat(secondWordbinaryCode, binary);
-                strcat(secondWordbinaryCode, "00");
-                free(binary);
-            }
-
-            else if(operand1AddressingMode == DIRECT){
-                memorySize += 1;
-                strcat(firstWordbinaryCode, "01");
-
-                hasSecondWord = True;
-                binary = (char *)malloc(12 + 1); /* Allocate memory for the binary string */
-                decimalToBinary(get_label_address(splitedLine[0], symbolsLabelsValuesHash, entriesExternsHash), 12, binary);
-                strcat(secondWordbinaryCode, binary);
-                if(ht_search(entriesExternsHash, splitedLine[0]) != NULL && strcmp(ht_get_type(entriesExternsHash, splitedLine[0]), "externDirective") == 0){
-                    strcat(secondWordbinaryCode, "01");
-                }
-                else{
-                    strcat(secondWordbinaryCode, "10");
-                }
-
-                free(binary);
-
-                if(ht_search(entriesExternsHash, splitedLine[0]) != NULL && strcmp(ht_get_type(entriesExternsHash, splitedLine[0]), "externDirective") == 0){
-                    fprintf(externFile, "%s %04d\n", splitedLine[0], (*currentMemoryAddress) + 1);
-                }
-
-
-            }
-
-            else if(operand1AddressingMode == INDEX){
-                memorySize += 2;
-                strcat(firstWordbinaryCode, "10");
-
-                hasSecondWord = True;
-                hasThirdWord = True;
-                binary = (char *)malloc(12 + 1); /* Allocate memory for the binary string */
-                decimalToBinary(get_indexed_label_address(splitedLine[0], symbolsLabelsValuesHash, entriesExternsHash, &labelIndex), 12, binary);
-                strcat(secondWordbinaryCode, binary);
-                free(binary);
-                binary = (char *)malloc(12 + 1); /* Allocate memory for the binary string */
-                decimalToBinary(labelIndex, 12, binary);
-                strcat(thirdWordbinaryCode, binary);
-
-                if(ht_search(entriesExternsHash, splitedLine[0]) != NULL && strcmp(ht_get_type(entriesExternsHash, splitedLine[0]), "externDirective") == 0){
-                    strcat(secondWordbinaryCode, "01");
-                    strcat(thirdWordbinaryCode, "00");
-                }
-                else{
-                    strcat(secondWordbinaryCode, "10");
-                    strcat(thirdWordbinaryCode, "00");
-                }
-
-                free(binary);
-
-
-                if(ht_search(entriesExternsHash, splitedLine[0]) != NULL && strcmp(ht_get_type(entriesExternsHash, splitedLine[0]), "externDirective") == 0){
-                    fprintf(externFile, "%s %04d\n", splitedLine[0], (*currentMemoryAddress) + 1);
-                }
-
-            }
-
-            else if(operand1AddressingMode == REGISTER){
-                memorySize += 1;
-                strcat(firstWordbinaryCode, "11");
-
-                hasSecondWord = True;
-                strcat(secondWordbinaryCode, "000000");
-                strcat(secondWordbinaryCode, ht_search(registersHash, splitedLine[0]));                
-
-
-            }
-
-            if(operand2AddressingMode == IMMEDIATE){
-                memorySize += 1;
-                strcat(firstWordbinaryCode, "00");
-                binary = (char *)malloc(12 + 1); /* Allocate memory for the binary string */
-                decimalToBinary(get_imidiate_data(splitedLine[1], symbolsLabelsValuesHash, entriesExternsHash), 12, binary);
-
-                if(operand1AddressingMode != INDEX){
-                    hasThirdWord = True;
-                    strcat(thirdWordbinaryCode, binary);
-                    strcat(thirdWordbinaryCode, "00");
-                }
-
-                else{
-                    hasFourthWord = True;
-                    strcat(fourthWordbinaryCode, binary);
-                    strcat(fourthWordbinaryCode, "00");
-                }
-
-                free(binary);
-
-            }
-
-            else if(operand2AddressingMode == DIRECT){
-                memorySize += 1;
-                strcat(firstWordbinaryCode, "01");
-                binary = (char *)malloc(12 + 1); /* Allocate memory for the binary string */
-                decimalToBinary(get_imidiate_data(splitedLine[1], symbolsLabelsValuesHash, entriesExternsHash), 12, binary);
-
-
-                if(ht_search(entriesExternsHash, splitedLine[1]) != NULL && strcmp(ht_get_type(entriesExternsHash, splitedLine[1]), "externDirective") == 0){
-                    fprintf(externFile, "%s %04d\n", splitedLine[1], (*currentMemoryAddress) + 1);
-                }
-
-                if(operand1AddressingMode != INDEX){
-                    hasThirdWord = True;
-                    strcat(thirdWordbinaryCode, binary);
-                    
-                    if(ht_search(entriesExternsHash, splitedLine[1]) != NULL && strcmp(ht_get_type(entriesExternsHash, splitedLine[0]), "externDirective") == 0){
-                        strcat(thirdWordbinaryCode, "01");
-                    }
-                    else{
-                        strcat(thirdWordbinaryCode, "10");
-                    }
-                }
-
-                else{
-                    hasFourthWord = True;
-                    strcat(fourthWordbinaryCode, binary);
-                    if(ht_search(entriesExternsHash, splitedLine[1]) != NULL && strcmp(ht_get_type(entriesExternsHash, splitedLine[0]), "externDirective") == 0){
-                        strcat(fourthWordbinaryCode, "01");
-                    }
-                    else{
-                        strcat(fourthWordbinaryCode, "10");
-                    }
-                }
-                free(binary);
-
-            }
-
-            else if(operand2AddressingMode == INDEX){
-                memorySize += 2;
-                strcat(firstWordbinaryCode, "10");
-                binary = (char *)malloc(12 + 1); /* Allocate memory for the binary string */
-                decimalToBinary(get_indexed_label_address(splitedLine[1], symbolsLabelsValuesHash, entriesExternsHash, &labelIndex), 12, binary);
-
-                if(ht_search(entriesExternsHash, splitedLine[1]) != NULL && strcmp(ht_get_type(entriesExternsHash, splitedLine[1]), "externDirective") == 0){
-                    fprintf(externFile, "%s %04d\n", splitedLine[1], (*currentMemoryAddress) + 1);
-                }
-
-                if(operand1AddressingMode != INDEX){
-                    hasThirdWord = True;
-                    hasFourthWord = True;
-                    strcat(thirdWordbinaryCode, binary);
-                    free(binary);
-                    binary = (char *)malloc(12 + 1); /* Allocate memory for the binary string */
-                    decimalToBinary(labelIndex, 12, binary);
-                    strcat(fourthWordbinaryCode, binary);
-                    free(binary);
-                    if(ht_search(entriesExternsHash, splitedLine[1]) != NULL && strcmp(ht_get_type(entriesExternsHash, splitedLine[0]), "externDirective") == 0){
-                        strcat(thirdWordbinaryCode, "01");
-                        strcat(fourthWordbinaryCode, "00");
-                    }
-                    else{
-                        strcat(thirdWordbinaryCode, "10");
-                        strcat(fourthWordbinaryCode, "00");
-                    }
-                }
-
-                else{
-                    hasFourthWord = True;
-                    hasFifthWord = True;
-                    strcat(fourthWordbinaryCode, binary);
-                    free(binary);
-                    binary = (char *)malloc(12 + 1); /* Allocate memory for the binary string */
-                    decimalToBinary(labelIndex, 12, binary);
-                    strcat(fifthWordbinaryCode, binary);
-                    free(binary);
-                    if(ht_search(entriesExternsHash, splitedLine[1]) != NULL && strcmp(ht_get_type(entriesExternsHash, splitedLine[0]), "externDirective") == 0){
-                        strcat(fourthWordbinaryCode, "01");
-                        strcat(fifthWordbinaryCode, "00");
-                    }
-                    else{
-                        strcat(fourthWordbinaryCode, "10");
-                        strcat(fifthWordbinaryCode, "00");
-                    }
-                }
-
-            }
-
-            else if(operand2AddressingMode == REGISTER){
-                memorySize += 1;
-                strcat(firstWordbinaryCode, "11");
-                if(operand1AddressingMode == REGISTER){
-                    alsoRegister = True;
-                }
-
-                if(alsoRegister == False){
-                    if(operand1AddressingMode != INDEX){
-
-                        hasThirdWord = True;
-                        strcat(thirdWordbinaryCode, "000000");
-                        strcat(thirdWordbinaryCode, ht_search(registersHash, splitedLine[1]));
-                        strcat(thirdWordbinaryCode, "00");
-                    }
-
-                    else{
-                        hasFourthWord = True;
-                        strcat(fourthWordbinaryCode, "000000");
-                        strcat(fourthWordbinaryCode, ht_search(registersHash, splitedLine[1]));
-                        strcat(fourthWordbinaryCode, "00");
-                    }
-                }
-
-            }
-
-            /* If both operands are registers, then the memory size should be decreased by 1 */
-            if(operand1AddressingMode == REGISTER && operand2AddressingMode == REGISTER){
-                memorySize -= 1;
-                hasThirdWord = False;
-                strcat(secondWordbinaryCode, ht_search(registersHash, splitedLine[1]));
-                strcat(secondWordbinaryCode, "00");
-            }
-
-            if(operand1AddressingMode == REGISTER && operand2AddressingMode != REGISTER){
-                strcat(secondWordbinaryCode, "00000");
-            }
-
-
-            freeStringArray(splitedLine, numberOfElements);
-
+    sprintf(outputFileName, "%s.ext", baseName);
+    if ((records = format_output_buffer(externRecords, &recordsLength)) != NULL) {
+        batch_write_file(batch, outputFileName, records, recordsLength);
+    }
+    else {
+        batch_remove_file(batch, outputFileName);
     }
 
-    else if (strcmp(instruction, "not") == 0 || strcmp(instruction, "clr") == 0 || strcmp(instruction, "inc") == 0 ||
-               strcmp(instruction, "dec") == 0 || strcmp(instruction, "jmp") == 0 || strcmp(instruction, "bne") == 0 ||
-               strcmp(instruction, "red") == 0 || strcmp(instruction, "prn") == 0 || strcmp(instruction, "jsr") == 0) {
-
-
-        removeLeadingSpaces(line);
-        numberOfElements = 0;
-        splitedLine = splitString(line, " ", &numberOfElements);
-        operand1AddressingMode = analyzeAddressingMode(splitedLine[0], symbolsLabelsValuesHash, entriesExternsHash);
-
-        strcat(firstWordbinaryCode, "00");
-
-        if(operand1AddressingMode == IMMEDIATE){
-            strcat(firstWordbinaryCode, "00");
-            memorySize += 1;
-
-            hasSecondWord = True;
-            binary = (char *)malloc(12 + 1); /* Allocate memory for the binary string */
-            decimalToBinary(get_imidiate_data(splitedLine[0], symbolsLabelsValuesHash, entriesExternsHash), 12, binary);
-            strcat(secondWordbinaryCode, binary);
-            strcat(secondWordbinaryCode, "00");
-            free(binary);
-
-        }
-
-        else if(operand1AddressingMode == DIRECT){
-            strcat(firstWordbinaryCode, "01");
-            memorySize += 1;
-
-            hasSecondWord = True;
-            binary = (char *)malloc(12 + 1); /* Allocate memory for the binary string */
-            decimalToBinary(get_label_address(splitedLine[0], symbolsLabelsValuesHash, entriesExternsHash), 12, binary);
-            strcat(secondWordbinaryCode, binary);
-            if(ht_search(entriesExternsHash, splitedLine[0]) != NULL && strcmp(ht_get_type(entriesExternsHash, splitedLine[0]), "externDirective") == 0){
-                strcat(secondWordbinaryCode, "01");
-            }
-            else{
-                strcat(secondWordbinaryCode, "10");
-            }
-
-            free(binary);
-
-            if(ht_search(entriesExternsHash, splitedLine[0]) != NULL && strcmp(ht_get_type(entriesExternsHash, splitedLine[0]), "externDirective") == 0){
-                fprintf(externFile, "%s %04d\n", splitedLine[0], (*currentMemoryAddress) + 1);
-            }
+    /* The object file is renamed last, so once it appears its .ent / .ext files are already in place */
+    sprintf(outputFileName, "%s.ob", baseName);
+    batch_write_file(batch, outputFileName, objectFile, objectLength);
 
-        }
+    free(baseName);
+}
 
-        else if(operand1AddressingMode == INDEX){
-            strcat(firstWordbinaryCode, "10");
-            memorySize += 2;
-            hasSecondWord = True;
-            hasThirdWord = True;
-            binary = (char *)malloc(12 + 1); /* Allocate memory for the binary string */
-            decimalToBinary(get_indexed_label_address(splitedLine[0], symbolsLabelsValuesHash, entriesExternsHash, &labelIndex), 12, binary);
-            strcat(secondWordbinaryCode, binary);
-            free(binary);
-            binary = (char *)malloc(12 + 1); /* Allocate memory for the binary string */
-            decimalToBinary(labelIndex, 12, binary);
-            strcat(thirdWordbinaryCode, binary);
-            free(binary);
-
-            if(ht_search(entriesExternsHash, splitedLine[0]) != NULL && strcmp(ht_get_type(entriesExternsHash, splitedLine[0]), "externDirective") == 0){
-                fprintf(externFile, "%s %04d\n", splitedLine[0], (*currentMemoryAddress) + 1);
-            }
+void remove_output_files(char * inputFileName, FileBatch *batch){
 
-        }
+    char outputFileName[MAX_LINE_LENGTH];                       /* Buffer to store the output file name */
+    char * baseName = removeFileExtension(inputFileName);       /* The file name without the extension */
 
-        /* Must be REGISTER mode*/
-        else{
-            strcat(firstWordbinaryCode, "11");
-            memorySize += 1;
-            hasSecondWord = True;
-            strcat(secondWordbinaryCode, "0000000000");
-            strcat(secondWordbinaryCode, ht_search(registersHash, splitedLine[0]));
-            strcat(secondWordbinaryCode, "00");
-        }
+    sprintf(outputFileName, "%s.ob", baseName);
+    batch_remove_file(batch, outputFileName);
 
-        freeStringArray(splitedLine, numberOfElements);
+    sprintf(outputFileName, "%s.ent", baseName);
+    batch_remove_file(batch, outputFileName);
 
-    }
+    sprintf(outputFileName, "%s.ext", baseName);
+    batch_remove_file(batch, outputFileName);
 
-    else if (strcmp(instruction, "rts") == 0 || strcmp(instruction, "hlt") == 0) {
-        strcat(firstWordbinaryCode, "0000");
+    /* The ".air" file of the previous source would be older than the source anyway */
+    if (strlen(baseName) + strlen(AIR_EXTENSION) < MAX_LINE_LENGTH) {
+        sprintf(outputFileName, "%s%s", baseName, AIR_EXTENSION);
+        batch_remove_file(batch, outputFileName);
     }
 
-    strcat(firstWordbinaryCode, "00");
-
-    fprintf(outputFile, "%04d ", *currentMemoryAddress);
-    fputs(firstWordbinaryCode, outputFile);
-    fputs("\n", outputFile);
+    free(baseName);
+}
 
-    if(hasSecondWord){
-        fprintf(outputFile, "%04d ", *currentMemoryAddress + 1);
-        fputs(secondWordbinaryCode, outputFile);
-        fputs("\n", outputFile);
+void decimalToBinary(int decimal, int numBits, char *binary) {
+    int i; /* Loop counter */
+    if (binary == NULL) {
+        memory_allocation_failed();
     }
 
-    if(hasThirdWord){
-        fprintf(outputFile, "%04d ", *currentMemoryAddress + 2);
-        fputs(thirdWordbinaryCode, outputFile);
-        fputs("\n", outputFile);
+    /* Handle negative numbers using two's complement */
+    if (decimal < 0) {
+        decimal = (1 << numBits) + decimal; /* Convert to positive value in two's complement */
     }
 
-    if(hasFourthWord){
-        fprintf(outputFile, "%04d ", *currentMemoryAddress + 3);
-        fputs(fourthWordbinaryCode, outputFile);
-        fputs("\n", outputFile);
-    }
 
-    if(hasFifthWord){
-        fprintf(outputFile, "%04d ", *currentMemoryAddress + 4);
-        fputs(fifthWordbinaryCode, outputFile);
-        fputs("\n", outputFile);
+    /* Convert decimal to binary */
+    for (i = numBits - 1; i >= 0; i--) {
+        binary[i] = (decimal & 1) ? '1' : '0'; /* Extract the least significant bit */
+        decimal >>= 1; /* Shift right to get next bit */
     }
-
-    *currentMemoryAddress += memorySize;
-
-    return;
-
+    binary[numBits] = '\0'; /* Null-terminate the string */
 
 }
 
-int get_imidiate_data(char *operand, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash){
-
-        char **splitedLine;                    /* Array to store the splited line */
-        int numberOfElements = 0;              /* Reset the elemnts number - for the string spliter counter */
-        int value;                         /* The value of the immediate data */
-        cleanCommand(operand);
-
-        if (operand[0] == '#') {
 
-            splitedLine = splitString(operand, "#", &numberOfElements);
-
-            if(isValidInteger(splitedLine[0])){
-                value = stringToInt(splitedLine[0]);
-                freeStringArray(splitedLine, numberOfElements);
-                return value;
-            }
-
-            else if(ht_search(symbolsLabelsValuesHash, splitedLine[0]) != NULL && strcmp(ht_get_type(symbolsLabelsValuesHash, splitedLine[0]), "constant") == 0){
-                value = stringToInt(ht_search(symbolsLabelsValuesHash, splitedLine[0]));
-                freeStringArray(splitedLine, numberOfElements);
-                return value;
-            }
+void generate_include_directive(LineTable *lines, int lineIndex){
 
-        }
+    /* Only a labelled directive takes memory */
+    if(lines->labelLengths[lineIndex] == 0){
+        return;
+    }
 
-        return 0;
+    /* The words go straight from the mapped file to the place the address pass kept for them */
+    decode_included_file(&lines->includes[lines->records[lineIndex].include], lines->data.words + lines->records[lineIndex].dataOffset);
 }
 
-int get_label_address(char *label, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash){
-
-    cleanCommand(label);
 
-    if (ht_search(symbolsLabelsValuesHash, label) != NULL && (strcmp(ht_get_type(symbolsLabelsValuesHash, label), "dataDirective") == 0 ||
-                                                              strcmp(ht_get_type(symbolsLabelsValuesHash, label), "stringDirective") == 0 ||
-                                                              strcmp(ht_get_type(symbolsLabelsValuesHash, label), "instruction") == 0)){
-            return stringToInt(ht_get_memory_address(symbolsLabelsValuesHash, label));
+int get_operand_address(LineTable *lines, Operand *operand, HashTable *symbolsLabelsValuesHash){
 
-    }        
+    char *label = operand_symbol(lines, operand);
+    int line = find_symbol(&lines->labels, label, (int)strlen(label));
 
-    else if(ht_search(entriesExternsHash, label) != NULL){
+    if (line < 0) {
         return 0;
     }
 
-        return 0;
-}
-
-int get_indexed_label_address(char *label, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash, int * index){
-
-    char **splitedLine;                    /* Array to store the splited line */
-    int numberOfElements = 0;              /* Reset the elemnts number - for the string spliter counter */
-    int address;                           /* The address of the indexed label */
-
-    if (strchr(label, '[') != NULL && strchr(label, ']') != NULL) {
-
-            splitedLine = splitString(label, "[", &numberOfElements);
-            removeSubstring(splitedLine[1], "]");
-            
-            if(ht_search(symbolsLabelsValuesHash,splitedLine[0]) != NULL && (strcmp(ht_get_type(symbolsLabelsValuesHash, splitedLine[0]), "dataDirective") == 0 || strcmp(ht_get_type(symbolsLabelsValuesHash, splitedLine[0]), "stringDirective") == 0)){
-                if(isValidInteger(splitedLine[1])){
-
-                    *index = stringToInt(splitedLine[1]);
-                    address = stringToInt(ht_get_memory_address(symbolsLabelsValuesHash, splitedLine[0]));
-                    freeStringArray(splitedLine, numberOfElements);
-                    return address;
-                }
-
-                else if (ht_search(symbolsLabelsValuesHash, splitedLine[1]) != NULL && strcmp(ht_get_type(symbolsLabelsValuesHash, splitedLine[1]), "constant") == 0){
-
-                    *index = stringToInt(ht_search(symbolsLabelsValuesHash, splitedLine[1]));
-                    address = stringToInt(ht_get_memory_address(symbolsLabelsValuesHash, splitedLine[0]));
-                    freeStringArray(splitedLine, numberOfElements);
-                    return address;
-                }
-
-            }
-
-            else{
-                
-                if(isValidInteger(splitedLine[1])){
-
-                    *index = stringToInt(splitedLine[1]);
-                    freeStringArray(splitedLine, numberOfElements);
-                    return 0;
-                }
-
-                else if (ht_search(symbolsLabelsValuesHash, splitedLine[1]) != NULL && strcmp(ht_get_type(symbolsLabelsValuesHash, splitedLine[1]), "constant") == 0){
-
-                    *index = stringToInt(ht_search(symbolsLabelsValuesHash, splitedLine[1]));
-                    freeStringArray(splitedLine, numberOfElements);
-                    return 0;
-                }
-
-                return 0;
-            }
+    /* Only data and strings can be indexed */
+    if (lines->kinds[line] == DATA_DIRECTIVE || lines->kinds[line] == STRING_DIRECTIVE || lines->kinds[line] == INCLUDE_DIRECTIVE ||
+        (operand->mode == DIRECT && lines->kinds[line] == INSTRUCTION)) {
+        return lines->addresses[line];
     }
 
+    /* Externals are resolved by the linker */
     return 0;
 }
 
@@ -1276,8 +564,7 @@ char* encodeBinaryString(const char* binaryString) {
     size_t length = strlen(binaryString);
     char* transformedString = (char*)malloc((length + 1) * sizeof(char)); /* +1 for null terminator */
     if (transformedString == NULL) {
-        fprintf(stderr, "Memory allocation failed\n");
-        exit(EXIT_FAILURE);
+        memory_allocation_failed();
     }
 
     for (i = 0; i < length; i += 2) {
@@ -1299,76 +586,3 @@ char* encodeBinaryString(const char* binaryString) {
     transformedString[length / 2] = '\0'; /* Null-terminate the transformed string */
     return transformedString;
 }
-
-int get_directives_memory_size(HashTable *table){
-
-    int i, j, order;
-    int totalMemorySize = 0;
-
-    for (j = 0; j < table -> size; j++){
-
-        for (i = 0; i < table -> size; i++)
-        {
-            if ((table -> items[i]) && (table -> items[i] -> order != NULL)){
-                order = stringToInt(table -> items[i] -> order);
-                if (order == j && (strcmp(table -> items[i] -> type, "dataDirective") == 0 || strcmp(table -> items[i] -> type, "stringDirective") == 0))
-                {
-                    totalMemorySize += stringToInt(table -> items[i] -> memorySize);
-                }
-            }
-        }
-    }
-
-    return totalMemorySize;
-}
-
-bool entryExists(HashTable *table) {
-
-    int i, j;
-
-    for (j = 0; j < table -> size; j++){
-
-        for (i = 0; i < table -> size; i++)
-        {
-            if ((table -> items[i]) && (table -> items[i] -> order != NULL)){
-                if ((strcmp(table -> items[i] -> type, "entryDirective") == 0))
-                {
-                    return True;
-                }
-            }
-        }
-    }
-
-    return False;
-}
-
-bool externExists(HashTable *table) {
-
-    int i, j;
-
-    for (j = 0; j < table -> size; j++){
-
-        for (i = 0; i < table -> size; i++)
-        {
-            if ((table -> items[i]) && (table -> items[i] -> order != NULL)){
-                if ((strcmp(table -> items[i] -> type, "externDirective") == 0))
-                {
-                    return True;
-                }
-            }
-        }
-    }
-
-    return False;
-}
-
-
-
-
-
-
-
-
-
-
-
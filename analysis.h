@@ -1,42 +1,40 @@
-/** calculate_memory_addresses_for_instructions
- *  @brief This function calculates the memory addresses for the instructions
- *  @param commandType The type of the command
- *  @param line The line to be analyzed
- *  @param symbolsLabelsValuesHash The hash table containing the symbols, labels and their values
- *  @param directiveOrder The order of the directive
+/** generate_code
+ *  @brief This function generates the code and the data segments of the file
+ *         A first pass over the lines gives every line and every label its address (the data labels follow the code segment),
+ *         then the lines are encoded at their addresses on parallel threads. The extern records stay in the order of their words.
+ *  @param lines The classified lines of the file, receives the segments
+ *  @param symbolsLabelsValuesHash The hash table containing the symbols, labels and their values, receives the label addresses
  *  @param entriesExternsHash The hash table containing the entries and externs
- *  @param currentMemoryAddress The current memory address
+ *  @param entryRecords The buffer collecting the entry records
+ *  @param externRecords The buffer collecting the extern records
  */
-void calculate_memory_addresses_for_instructions(CommandType commandType, char *line, HashTable *symbolsLabelsValuesHash, int * directiveOrder, HashTable *entriesExternsHash, int * currentMemoryAddress);
+void generate_code(LineTable *lines, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash, OutputBuffer *entryRecords, OutputBuffer *externRecords);
 
-/** calculate_memory_addresses_for_directives
- *  @brief This function calculates the memory addresses for the directives
- *  @param commandType The type of the command
- *  @param line The line to be analyzed
- *  @param symbolsLabelsValuesHash The hash table containing the symbols, labels and their values
- *  @param directiveOrder The order of the directive
- *  @param entriesExternsHash The hash table containing the entries and externs
- *  @param currentMemoryAddress The current memory address
+/** build_encoded_file
+ *  @brief This function builds the encoded file in memory
+ *  @param lines The classified lines, holds the code and the data segments
+ *  @param length Receives the length of the encoded file
+ *  @return The encoded file, allocated with malloc()
  */
-void calculate_memory_addresses_for_directives(CommandType commandType, char *line, HashTable *symbolsLabelsValuesHash, int * directiveOrder, HashTable *entriesExternsHash, int * currentMemoryAddress);
+char *build_encoded_file(LineTable *lines, size_t *length);
 
-/** build_binary_file
- *  @brief This function builds the binary file
+/** commit_output_files
+ *  @brief This function adds the output files to a batch, the entry and extern files first and the object file last
  *  @param inputFileName The name of the input file
- *  @param symbolsLabelsValuesHash The hash table containing the symbols, labels and their values
- *  @param entriesExternsHash The hash table containing the entries and externs
- *  @param instructionsHash The hash table containing the instructions
- *  @param registersHash The hash table containing the registers
+ *  @param objectFile The encoded file, owned by the batch from now on
+ *  @param objectLength The length of the encoded file
+ *  @param entryRecords The buffer collecting the entry records
+ *  @param externRecords The buffer collecting the extern records
+ *  @param batch The batch
  */
-void build_binary_file(char * inputFileName, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash, HashTable *instructionsHash, HashTable *registersHash);
+void commit_output_files(char * inputFileName, char * objectFile, size_t objectLength, OutputBuffer *entryRecords, OutputBuffer *externRecords, FileBatch *batch);
 
-/** build_encoded_file
- *  @brief This function builds the encoded file
+/** remove_output_files
+ *  @brief This function adds the removal of the output files left over from a previous run to a batch
  *  @param inputFileName The name of the input file
- *  @param symbolsLabelsValuesHash The hash table containing the symbols, labels and their values
- *  @param currentMemoryAddress The current memory address
+ *  @param batch The batch
  */
-void build_encoded_file(char * inputFileName, HashTable *symbolsLabelsValuesHash, int currentMemoryAddress);
+void remove_output_files(char * inputFileName, FileBatch *batch);
 
 /** decimalToBinary
  *  @brief This function converts a decimal number to a binary number
@@ -46,106 +44,21 @@ void build_encoded_file(char * inputFileName, HashTable *symbolsLabelsValuesHash
  */
 void decimalToBinary(int decimal, int numBits, char *binary);
 
-/** calculate_data_directive_memory_address
- *  @brief This function calculates the memory address for the data directive
- *  @param line The line to be analyzed
- *  @param symbolsLabelsValuesHash The hash table containing the symbols, labels and their values
- *  @param directiveOrder The order of the directive
- *  @param currentMemoryAddress The current memory address
- */
-void calculate_data_directive_memory_address(char * line, HashTable *symbolsLabelsValuesHash, int * directiveOrder, int * currentMemoryAddress);
-
-/** calculate_string_directive_memory_address
- *  @brief This function calculates the memory address for the string directive
- *  @param line The line to be analyzed
- *  @param symbolsLabelsValuesHash The hash table containing the symbols, labels and their values
- *  @param directiveOrder The order of the directive
- *  @param currentMemoryAddress The current memory address
+/** generate_include_directive
+ *  @brief This function writes the words of the file an include directive maps to the data segment
+ *  @param lines The classified lines, with the included files, receives the words in its data segment
+ *  @param lineIndex The index of the line in the table, with its data segment offset
  */
-void calculate_string_directive_memory_address(char * line, HashTable *symbolsLabelsValuesHash, int * directiveOrder, int * currentMemoryAddress);
+void generate_include_directive(LineTable *lines, int lineIndex);
 
-/** calculate_instruction_memory_address
- *  @brief This function calculates the memory address for the instruction
- *  @param line The line to be analyzed
+/** get_operand_address
+ *  @brief This function gets the address of the label a direct or an indexed operand refers to, without taking a lock
+ *  @param lines The classified lines, keeps the label names the operands refer to and the lines that define them
+ *  @param operand The operand
  *  @param symbolsLabelsValuesHash The hash table containing the symbols, labels and their values
- *  @param currentMemoryAddress The current memory address
+ *  @return The label address, 0 for an extern
  */
-void calculate_instruction_memory_address(char * line, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash, int * currentMemoryAddress);
-
-/** analyzeAddressingMode
- *  @brief This function analyzes the addressing mode
- *  @param operand The operand to be analyzed
- *  @param symbolsLabelsValuesHash The hash table containing the symbols, labels and their values
- *  @param entriesExternsHash The hash table containing the entries and externs
- *  @return The addressing mode
- */
-AddressingMode analyzeAddressingMode(char *operand, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash);
-
-/** analyze_data_directive
- *  @brief This function analyzes the data directive
- *  @param line The line to be analyzed
- *  @param symbolsLabelsValuesHash The hash table containing the symbols, labels and their values
- *  @param entriesExternsHash The hash table containing the entries and externs
- *  @param instructionsHash The hash table containing the instructions
- *  @param outputFile The output file
- *  @param entryFile The entry file
- *  @param externFile The extern file
- */
-void analyze_data_directive(char * line, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash, HashTable *instructionsHash, FILE *outputFile, FILE *entryFile, FILE *externFile);
-
-/** analyze_string_directive
- *  @brief This function analyzes the string directive
- *  @param line The line to be analyzed
- *  @param symbolsLabelsValuesHash The hash table containing the symbols, labels and their values
- *  @param entriesExternsHash The hash table containing the entries and externs
- *  @param instructionsHash The hash table containing the instructions
- *  @param outputFile The output file
- *  @param entryFile The entry file
- *  @param externFile The extern file
- */
-void analyze_string_directive(char * line, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash, HashTable *instructionsHash, FILE *outputFile, FILE *entryFile, FILE *externFile);
-
-/** analyze_instruction
- *  @brief This function analyzes the instruction
- *  @param line The line to be analyzed
- *  @param symbolsLabelsValuesHash The hash table containing the symbols, labels and their values
- *  @param entriesExternsHash The hash table containing the entries and externs
- *  @param instructionsHash The hash table containing the instructions
- *  @param registersHash The hash table containing the registers
- *  @param outputFile The output file
- *  @param entryFile The entry file
- *  @param externFile The extern file
- *  @param currentMemoryAddress The current memory address
- */
-void analyze_instruction(char * line, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash, HashTable *instructionsHash, HashTable *registersHash, FILE *outputFile, FILE *entryFile, FILE *externFile, int * currentMemoryAddress);
-
-/** get_imidiate_data
- *  @brief This function gets the imidiate data
- *  @param operand The operand to be analyzed
- *  @param symbolsLabelsValuesHash The hash table containing the symbols, labels and their values
- *  @param entriesExternsHash The hash table containing the entries and externs
- *  @return The imidiate data
- */
-int get_imidiate_data(char *operand, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash);
-
-/** get_label_address
- *  @brief This function gets the label address
- *  @param label The label to be analyzed
- *  @param symbolsLabelsValuesHash The hash table containing the symbols, labels and their values
- *  @param entriesExternsHash The hash table containing the entries and externs
- *  @return The label address
- */
-int get_label_address(char *label, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash);
-
-/** get_indexed_label_address
- *  @brief This function gets the indexed label address
- *  @param label The label to be analyzed
- *  @param symbolsLabelsValuesHash The hash table containing the symbols, labels and their values
- *  @param entriesExternsHash The hash table containing the entries and externs
- *  @param index The index
- *  @return The indexed label address
- */
-int get_indexed_label_address(char *label, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash, int * index);
+int get_operand_address(LineTable *lines, Operand *operand, HashTable *symbolsLabelsValuesHash);
 
 /** encodeBinaryString
  *  @brief This function encodes the binary string
@@ -154,23 +67,3 @@ int get_indexed_label_address(char *label, HashTable *symbolsLabelsValuesHash, H
  */
 char* encodeBinaryString(const char* binaryString);
 
-/** get_directives_memory_size
- *  @brief This function gets the directives memory size
- *  @param table The table to be analyzed
- * @return The directives memory size
- */
-int get_directives_memory_size(HashTable *table);
-
-/** entryExists
- *  @brief This function checks if the entry exists
- *  @param table The table to be analyzed
- * @return True if the entry exists, False otherwise
- */
-bool entryExists(HashTable *table);
-
-/** externExists
- *  @brief This function checks if the extern exists
- *  @param table The table to be analyzed
- * @return True if the extern exists, False otherwise
- */
-bool externExists(HashTable *table);
\ No newline at end of file
@@ -1,22 +1,101 @@
 #include <stdlib.h> 
 #include <stdio.h>
+#include <string.h>
 
 #include "global_definitions.h"
 #include "compilation.h"
+#include "air.h"
+#include "daemon.h"
+#include "manifest.h"
+#include "jobs.h"
 
+/* Defines the programs of the command line, the programs of a manifest are read when its turn comes */
+typedef struct ProgramArguments
+{
+    int argc;
+    char **argv;
+    int next;                                   /* The next argument */
+    FILE *manifest;                             /* The manifest being read, NULL between manifests */
+    char program[MAX_MANIFEST_LINE_LENGTH];
+
+} ProgramArguments;
+
+/**
+ * Next Program
+ *
+ * Returns the programs of the command line one after another, so a manifest of any length is assembled by this one process.
+ *
+ * @param context - The program arguments.
+ * @return The next program, NULL when there are no more.
+ */
+static char *nextProgram(void *context) {
+    ProgramArguments *arguments = (ProgramArguments *)context;
+    const char *manifestPath;
+
+    for (;;) {
+        if (arguments->manifest != NULL) {
+            if (next_manifest_program(arguments->manifest, arguments->program)) {
+                return arguments->program;
+            }
+
+            close_manifest(arguments->manifest);
+            arguments->manifest = NULL;
+        }
+
+        if (arguments->next >= arguments->argc) {
+            return NULL;
+        }
+
+        manifestPath = manifest_argument(arguments->argv[arguments->next]);
+        if (manifestPath == NULL) {
+            return arguments->argv[arguments->next++];
+        }
+
+        arguments->manifest = open_manifest(manifestPath);
+        arguments->next++;
+    }
+}
 
 int main(int argc, char *argv[])
 {
-    int i;
+    char *socketPath;
+    char defaultSocket[MAX_REQUEST_LINE_LENGTH];
+    ProgramArguments arguments;
+    CompileOptions options;
+
     if (argc < 2) {
         fprintf(stderr, EXECUTION_FORMAT_ERROR);
-        fprintf(stderr, "\nExpected: %s program1 program2 ...\n", argv[0]);
+        fprintf(stderr, "\nExpected: %s program1 program2 ... (or @manifest, --manifest=manifest)\n", argv[0]);
         exit(EXIT_FAILURE);
     }
 
-    for (i = 1; i < argc; i++) {
-        compile(argv[i]);
+    /* The options are taken from the environment here, the compilation never reads it */
+    init_compile_options(&options);
+    set_compile_option(&options, AIR_VARIABLE, getenv(AIR_VARIABLE));
+    set_compile_option(&options, JOBS_VARIABLE, getenv(JOBS_VARIABLE));
+
+    /* Serve the assembler_client requests instead of assembling */
+    if (argc == 2 && strncmp(argv[1], DAEMON_OPTION, strlen(DAEMON_OPTION)) == 0) {
+        if (argv[1][strlen(DAEMON_OPTION)] == '=') {
+            socketPath = argv[1] + strlen(DAEMON_OPTION) + 1;
+        } else if (argv[1][strlen(DAEMON_OPTION)] == '\0') {
+            socketPath = (daemon_socket_path(defaultSocket, sizeof(defaultSocket)) ? defaultSocket : NULL);
+        } else {
+            socketPath = NULL;
+        }
+
+        if (socketPath != NULL) {
+            return run_daemon(socketPath);
+        }
     }
 
+    arguments.argc = argc;
+    arguments.argv = argv;
+    arguments.next = 1;
+    arguments.manifest = NULL;
+
+    /* The files are compiled on as many threads as make (or JOBS_VARIABLE) allows */
+    compile_programs(nextProgram, &arguments, &options);
+
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,534 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+
+#include "global_definitions.h"
+#include "compilation.h"
+#include "pre_processor.h"
+#include "identification.h"
+#include "assembler_api.h"
+#include "diagnostics.h"
+#include "token_file.h"
+
+/* The first room of the arrays of a builder, they double when they run out */
+#define INITIAL_BUILDER_CAPACITY 64
+
+/* Defines a program being built, kept as the parts of a ".asb" file (see token_file.h) until it is assembled */
+struct AssemblerBuilder
+{
+    char sourceName[MAX_LINE_LENGTH];       /* The name the errors are reported with */
+    CompileOptions compileOptions;          /* The options finish_file_outputs() writes the files with */
+
+    TokenRecord *records;
+    int recordCount;
+    int recordCapacity;
+
+    TokenOperand *operands;
+    int operandCount;
+    int operandCapacity;
+
+    char *names;
+    int namesLength;
+    int namesCapacity;
+
+    int label;                              /* The label of the next line, TOKEN_NO_NAME when it has none */
+    bool outOfMemory;                       /* An allocation failed, the program is reported as ASSEMBLER_OUT_OF_MEMORY */
+};
+
+/**
+ * Copy Symbols
+ *
+ * Copies the records of an output buffer into an array of symbols, the count grows with every copied name
+ * so a failed allocation leaves an array free_assembler_result() can free.
+ *
+ * @param records - The records.
+ * @param symbols - Receives the symbols.
+ * @param count - Receives the number of symbols.
+ */
+static void copySymbols(OutputBuffer *records, AssemblerSymbol **symbols, int *count) {
+    const char *name;
+    int i;
+
+    *symbols = malloc((records->records + 1) * sizeof(AssemblerSymbol));
+    if (*symbols == NULL) {
+        memory_allocation_failed();
+    }
+
+    for (i = 0; i < records->records; i++) {
+        name = records->names + records->nameOffsets[i];
+
+        (*symbols)[i].address = records->addresses[i];
+        (*symbols)[i].name = malloc(strlen(name) + 1);
+        if ((*symbols)[i].name == NULL) {
+            memory_allocation_failed();
+        }
+
+        strcpy((*symbols)[i].name, name);
+        (*count)++;
+    }
+}
+
+/**
+ * Copy Segments
+ *
+ * @param lines - The classified lines holding the code and the data segments.
+ * @param result - Receives the words of the code segment followed by the data segment.
+ */
+static void copySegments(LineTable *lines, AssemblerResult *result) {
+    int i;
+
+    result->words = malloc((lines->code.length + lines->data.length + 1) * sizeof(int));
+    if (result->words == NULL) {
+        memory_allocation_failed();
+    }
+
+    /* A negative value is kept in the segment as an int, the result holds its 14 bits as the .ob file does */
+    for (i = 0; i < lines->code.length; i++) {
+        result->words[i] = lines->code.words[i] & WORD_MASK;
+    }
+    for (i = 0; i < lines->data.length; i++) {
+        result->words[lines->code.length + i] = lines->data.words[i] & WORD_MASK;
+    }
+    result->codeLength = lines->code.length;
+    result->dataLength = lines->data.length;
+}
+
+/**
+ * Assemble
+ *
+ * Assembles a source held in memory, or the parts of a tokenized program, collecting the errors instead of printing them.
+ *
+ * @param source - The source, does not need to be null terminated. Ignored when a program is given.
+ * @param length - The length of the source.
+ * @param program - The parts of a tokenized program, NULL to assemble the source.
+ * @param name - The name the errors are reported with, NULL for the default.
+ * @param result - Receives the result.
+ * @return The status, also kept in result->status.
+ */
+static int assemble(const char *source, int length, const TokenProgram *program, const char *name, AssemblerResult *result) {
+
+    char sourceName[MAX_LINE_LENGTH];       /* The name the errors are reported with */
+    DiagnosticSink *sink;                   /* Collects the errors of this thread */
+    DiagnosticSink *previousSink;           /* The sink of an enclosing call, restored when done */
+    jmp_buf outOfMemory;                    /* Where memory_allocation_failed() jumps to */
+    char *data;                             /* A copy of the source, the pre-processor terminates its lines in place */
+    SourceBuffer *original;
+    SourceBuffer *expanded;
+    LineTable *lines;
+    Workspace *workspace;
+
+    memset(result, 0, sizeof(AssemblerResult));
+    result->firstAddress = STARTING_MEMORY_LOCATION;
+
+    sprintf(sourceName, "%.*s", MAX_LINE_LENGTH - 1, (name != NULL) ? name : DEFAULT_SOURCE_NAME);
+
+    /* The sink lives on the heap, so it keeps its contents across the jump */
+    sink = malloc(sizeof(DiagnosticSink));
+    if (sink == NULL) {
+        result->status = ASSEMBLER_OUT_OF_MEMORY;
+        return result->status;
+    }
+
+    sink->diagnostics = NULL;
+    sink->count = 0;
+    sink->capacity = 0;
+    sink->outOfMemory = &outOfMemory;
+    previousSink = set_diagnostic_sink(sink);
+
+    if (setjmp(outOfMemory) != 0) {
+
+        /* The memory the assembly had allocated until then is lost, only the result is freed */
+        set_diagnostic_sink(previousSink);
+        free_assembler_result(result);
+
+        result->diagnostics = sink->diagnostics;
+        result->diagnosticCount = sink->count;
+        result->status = ASSEMBLER_OUT_OF_MEMORY;
+        free(sink);
+
+        return result->status;
+    }
+
+    /* Nothing is read or written, the defaults do */
+    workspace = create_workspace(NULL);
+
+    if (program != NULL) {
+        lines = assemble_token_program(program, sourceName, workspace);
+    }
+    else {
+        data = malloc(length + 1);
+        if (data == NULL) {
+            memory_allocation_failed();
+        }
+        memcpy(data, source, length);
+
+        original = create_source_buffer(data, length);
+        expanded = expand_macros(original);
+        free_source_buffer(original);
+
+        lines = assemble_source(expanded, sourceName, workspace);
+        free_source_buffer(expanded);
+    }
+
+    if (lines != NULL) {
+        copySegments(lines, result);
+        copySymbols(workspace->entryRecords, &result->entries, &result->entryCount);
+        copySymbols(workspace->externRecords, &result->externs, &result->externCount);
+        free_line_table(lines);
+        result->status = ASSEMBLER_SUCCESS;
+    }
+    else {
+        result->status = ASSEMBLER_ERRORS;
+    }
+
+    free_workspace(workspace);
+
+    set_diagnostic_sink(previousSink);
+    result->diagnostics = sink->diagnostics;
+    result->diagnosticCount = sink->count;
+    free(sink);
+
+    return result->status;
+}
+
+int assemble_buffer(const char *source, int length, const AssemblerOptions *options, AssemblerResult *result) {
+    return assemble(source, length, NULL, (options != NULL ? options->sourceName : NULL), result);
+}
+
+/**
+ * Reserve
+ *
+ * Makes room in an array of a builder, a failed allocation leaves the array as it was.
+ *
+ * @param builder - The builder, marked when memory ran out.
+ * @param array - The array.
+ * @param capacity - The number of elements the array has room for.
+ * @param needed - The number of elements the array needs room for.
+ * @param size - The size of an element.
+ * @return True if the array has room, False when memory ran out.
+ */
+static bool reserve(AssemblerBuilder *builder, void **array, int *capacity, int needed, size_t size) {
+    void *grown;
+    int newCapacity = *capacity;
+
+    if (builder->outOfMemory) {
+        return False;
+    }
+
+    if (needed <= *capacity) {
+        return True;
+    }
+
+    while (newCapacity < needed) {
+        newCapacity *= 2;
+    }
+
+    grown = realloc(*array, (size_t)newCapacity * size);
+    if (grown == NULL) {
+        builder->outOfMemory = True;
+        return False;
+    }
+
+    *array = grown;
+    *capacity = newCapacity;
+    return True;
+}
+
+/**
+ * Add a Name
+ *
+ * @param builder - The builder.
+ * @param name - The name, or the characters of a string.
+ * @return The offset of the name in the names of the builder, TOKEN_NO_NAME when memory ran out.
+ */
+static int addName(AssemblerBuilder *builder, const char *name) {
+    int length = (int)strlen(name) + 1;
+    int offset = builder->namesLength;
+
+    if (!reserve(builder, (void **)&builder->names, &builder->namesCapacity, builder->namesLength + length, 1)) {
+        return TOKEN_NO_NAME;
+    }
+
+    memcpy(builder->names + offset, name, length);
+    builder->namesLength += length;
+
+    return offset;
+}
+
+/**
+ * Add an Operand
+ *
+ * @param builder - The builder.
+ * @param mode - The addressing mode.
+ * @param flags - TOKEN_VALUE_NAME, TOKEN_INDEX_NAME.
+ * @param value - The value, a number or the offset of a name.
+ * @param index - The index, a number or the offset of a name.
+ */
+static void addOperand(AssemblerBuilder *builder, int mode, int flags, int value, int index) {
+    TokenOperand *operand;
+
+    if (!reserve(builder, (void **)&builder->operands, &builder->operandCapacity, builder->operandCount + 1, sizeof(TokenOperand))) {
+        return;
+    }
+
+    operand = &builder->operands[builder->operandCount++];
+    operand->mode = mode;
+    operand->flags = flags;
+    operand->value = value;
+    operand->index = index;
+}
+
+/**
+ * Add a Record
+ *
+ * Adds a line, with the label defined for it and the operands added since the previous line.
+ *
+ * @param builder - The builder.
+ * @param kind - The kind of the line.
+ * @param name - The offset of the name of the line, TOKEN_NO_NAME when it has none.
+ * @param opcode - The opcode of an instruction line.
+ * @param first - The first operand of the line.
+ */
+static void addRecord(AssemblerBuilder *builder, int kind, int name, int opcode, int first) {
+    TokenRecord *record;
+
+    if (!reserve(builder, (void **)&builder->records, &builder->recordCapacity, builder->recordCount + 1, sizeof(TokenRecord))) {
+        return;
+    }
+
+    record = &builder->records[builder->recordCount++];
+    record->kind = kind;
+    record->label = builder->label;
+    record->name = name;
+    record->opcode = opcode;
+    record->first = first;
+    record->count = builder->operandCount - first;
+
+    builder->label = TOKEN_NO_NAME;
+}
+
+/**
+ * Builder Program
+ *
+ * Points the parts of a tokenized program at the arrays of a builder, so its records are validated as they are.
+ *
+ * @param builder - The builder.
+ * @param program - Receives the parts, valid until the builder is freed.
+ */
+static void builderProgram(AssemblerBuilder *builder, TokenProgram *program) {
+    program->records = builder->records;
+    program->recordCount = builder->recordCount;
+    program->operands = builder->operands;
+    program->operandCount = builder->operandCount;
+    program->names = builder->names;
+    program->namesLength = builder->namesLength;
+}
+
+/**
+ * Free a Builder
+ *
+ * @param builder - The builder.
+ */
+static void freeBuilder(AssemblerBuilder *builder) {
+    free(builder->records);
+    free(builder->operands);
+    free(builder->names);
+    free(builder);
+}
+
+AssemblerBuilder *begin_file(const AssemblerOptions *options) {
+    AssemblerBuilder *builder = malloc(sizeof(AssemblerBuilder));
+
+    if (builder == NULL) {
+        return NULL;
+    }
+
+    sprintf(builder->sourceName, "%.*s", MAX_LINE_LENGTH - 1, (options != NULL && options->sourceName != NULL) ? options->sourceName : DEFAULT_SOURCE_NAME);
+
+    init_compile_options(&builder->compileOptions);
+    builder->compileOptions.air = (options != NULL && options->writeAir != 0);
+
+    builder->recordCount = 0;
+    builder->recordCapacity = INITIAL_BUILDER_CAPACITY;
+    builder->records = malloc(builder->recordCapacity * sizeof(TokenRecord));
+    builder->operandCount = 0;
+    builder->operandCapacity = INITIAL_BUILDER_CAPACITY;
+    builder->operands = malloc(builder->operandCapacity * sizeof(TokenOperand));
+    builder->namesLength = 0;
+    builder->namesCapacity = INITIAL_BUILDER_CAPACITY * 8;
+    builder->names = malloc(builder->namesCapacity);
+    builder->label = TOKEN_NO_NAME;
+    builder->outOfMemory = False;
+
+    if (builder->records == NULL || builder->operands == NULL || builder->names == NULL) {
+        free(builder->records);
+        free(builder->operands);
+        free(builder->names);
+        free(builder);
+        return NULL;
+    }
+
+    return builder;
+}
+
+void define_label(AssemblerBuilder *builder, const char *name) {
+    builder->label = addName(builder, name);
+}
+
+void define_constant(AssemblerBuilder *builder, const char *name, int value) {
+    int first = builder->operandCount;
+    int nameOffset = addName(builder, name);
+
+    addOperand(builder, TOKEN_IMMEDIATE, 0, value, 0);
+    addRecord(builder, TOKEN_CONSTANT, nameOffset, 0, first);
+}
+
+void emit_instruction(AssemblerBuilder *builder, int opcode, const AssemblerOperand *operands, int operandCount) {
+    int first = builder->operandCount;
+    const AssemblerOperand *operand;
+    int i;
+
+    for (i = 0; i < operandCount; i++) {
+        operand = &operands[i];
+
+        switch (operand->mode) {
+            case ASSEMBLER_IMMEDIATE:
+                if (operand->name != NULL) {
+                    addOperand(builder, TOKEN_IMMEDIATE, TOKEN_VALUE_NAME, addName(builder, operand->name), 0);
+                } else {
+                    addOperand(builder, TOKEN_IMMEDIATE, 0, operand->number, 0);
+                }
+                break;
+            case ASSEMBLER_DIRECT:
+                addOperand(builder, TOKEN_DIRECT, 0, addName(builder, operand->name), 0);
+                break;
+            case ASSEMBLER_INDEX:
+                if (operand->indexName != NULL) {
+                    addOperand(builder, TOKEN_INDEX, TOKEN_INDEX_NAME, addName(builder, operand->name), addName(builder, operand->indexName));
+                } else {
+                    addOperand(builder, TOKEN_INDEX, 0, addName(builder, operand->name), operand->number);
+                }
+                break;
+            default:
+                addOperand(builder, TOKEN_REGISTER, 0, operand->number, 0);
+                break;
+        }
+    }
+
+    addRecord(builder, TOKEN_INSTRUCTION, TOKEN_NO_NAME, opcode, first);
+}
+
+void emit_data(AssemblerBuilder *builder, const int *values, int count) {
+    int first = builder->operandCount;
+    int i;
+
+    for (i = 0; i < count; i++) {
+        addOperand(builder, TOKEN_IMMEDIATE, 0, values[i], 0);
+    }
+
+    addRecord(builder, TOKEN_DATA, TOKEN_NO_NAME, 0, first);
+}
+
+void emit_string(AssemblerBuilder *builder, const char *characters) {
+    addRecord(builder, TOKEN_STRING, addName(builder, characters), 0, builder->operandCount);
+}
+
+void emit_include(AssemblerBuilder *builder, const char *fileName) {
+    addRecord(builder, TOKEN_INCLUDE, addName(builder, fileName), 0, builder->operandCount);
+}
+
+void declare_entry(AssemblerBuilder *builder, const char *name) {
+    addRecord(builder, TOKEN_ENTRY, addName(builder, name), 0, builder->operandCount);
+}
+
+void declare_extern(AssemblerBuilder *builder, const char *name) {
+    addRecord(builder, TOKEN_EXTERN, addName(builder, name), 0, builder->operandCount);
+}
+
+int finish_file(AssemblerBuilder *builder, AssemblerResult *result) {
+    TokenProgram program;                   /* The records of the builder, validated and assembled as they are */
+
+    if (builder->outOfMemory) {
+        freeBuilder(builder);
+        memset(result, 0, sizeof(AssemblerResult));
+        result->firstAddress = STARTING_MEMORY_LOCATION;
+        result->status = ASSEMBLER_OUT_OF_MEMORY;
+        return result->status;
+    }
+
+    builderProgram(builder, &program);
+    assemble(NULL, 0, &program, builder->sourceName, result);
+    freeBuilder(builder);
+
+    return result->status;
+}
+
+int finish_file_outputs(AssemblerBuilder *builder, const char *programName) {
+    CompilationUnit unit;                   /* The program between the stages, as for a .as file */
+    TokenProgram program;                   /* The records of the builder, validated and assembled as they are */
+    int status;
+
+    if (builder->outOfMemory) {
+        freeBuilder(builder);
+        return ASSEMBLER_OUT_OF_MEMORY;
+    }
+
+    /* The output files are built in buffers of MAX_LINE_LENGTH */
+    if (strlen(programName) + strlen(TOKEN_EXTENSION) >= MAX_LINE_LENGTH) {
+        console_printf(CONSOLE_ERROR, "%s %s\n", FILE_NAME_LENGTH_ERROR, programName);
+        freeBuilder(builder);
+        return ASSEMBLER_ERRORS;
+    }
+
+    sprintf(unit.preProcessedFileName, "%s%s", programName, TOKEN_EXTENSION);
+    unit.source = NULL;
+    unit.tokens = NULL;
+    unit.air = NULL;
+    unit.hasSource = True;
+    unit.inMemory = False;
+    unit.workspace = create_workspace(&builder->compileOptions);
+
+    builderProgram(builder, &program);
+    unit.lines = assemble_token_program(&program, unit.preProcessedFileName, unit.workspace);
+    freeBuilder(builder);
+
+    status = (unit.lines != NULL ? ASSEMBLER_SUCCESS : ASSEMBLER_ERRORS);
+    write_compilation_unit(&unit);
+
+    free_workspace(unit.workspace);
+
+    return status;
+}
+
+void free_assembler_result(AssemblerResult *result) {
+    int i;
+
+    for (i = 0; i < result->entryCount; i++) {
+        free(result->entries[i].name);
+    }
+
+    for (i = 0; i < result->externCount; i++) {
+        free(result->externs[i].name);
+    }
+
+    for (i = 0; i < result->diagnosticCount; i++) {
+        free(result->diagnostics[i].message);
+        free(result->diagnostics[i].line);
+    }
+
+    free(result->words);
+    free(result->entries);
+    free(result->externs);
+    free(result->diagnostics);
+
+    result->words = NULL;
+    result->codeLength = 0;
+    result->dataLength = 0;
+    result->entries = NULL;
+    result->entryCount = 0;
+    result->externs = NULL;
+    result->externCount = 0;
+    result->diagnostics = NULL;
+    result->diagnosticCount = 0;
+}
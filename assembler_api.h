@@ -0,0 +1,190 @@
+#ifndef _ASSEMBLER_API_H
+#define _ASSEMBLER_API_H
+
+/* The public interface of libassembler, it does not depend on the other headers of the assembler.
+ * Every call works on its own state, so different threads may assemble at the same time. */
+
+/* ------------------------------------ Static Definitions ------------------------------------ */
+
+/* The status of an assembly */
+#define ASSEMBLER_SUCCESS 0                 /* The result holds the object words, the entries and the externs */
+#define ASSEMBLER_ERRORS 1                  /* The source has errors, the result holds their diagnostics */
+#define ASSEMBLER_OUT_OF_MEMORY 2           /* Memory ran out, the result holds the diagnostics found until then */
+
+/* The name given to the source in the diagnostics when the options do not name it */
+#define DEFAULT_SOURCE_NAME "buffer"
+
+/* The addressing modes of the operands of emit_instruction() */
+#define ASSEMBLER_IMMEDIATE 0               /* #number, or #constant when name is set */
+#define ASSEMBLER_DIRECT 1                  /* name */
+#define ASSEMBLER_INDEX 2                   /* name[number], or name[indexName] when indexName is set */
+#define ASSEMBLER_REGISTER 3                /* r<number> */
+
+
+/* ------------------------------------ Data Types ------------------------------------ */
+
+/* Defines the options of an assembly, a NULL options pointer takes the defaults */
+typedef struct AssemblerOptions
+{
+    const char *sourceName;                 /* Reported as the file of the diagnostics, DEFAULT_SOURCE_NAME when NULL */
+    int writeAir;                           /* Non zero for finish_file_outputs() to write the .air file too (as ASSEMBLER_AIR=1 does) */
+
+} AssemblerOptions;
+
+/* Defines an error found in the source */
+typedef struct AssemblerDiagnostic
+{
+    int lineNumber;                         /* The line, after the macros were expanded (as in the .am file) */
+    char *message;
+    char *line;                             /* The text of the line */
+
+} AssemblerDiagnostic;
+
+/* Defines an entry (its address) or an extern (the address of a word that refers to it) */
+typedef struct AssemblerSymbol
+{
+    char *name;
+    int address;
+
+} AssemblerSymbol;
+
+/* Defines an operand of an instruction built with emit_instruction() */
+typedef struct AssemblerOperand
+{
+    int mode;                               /* ASSEMBLER_IMMEDIATE, ... */
+    int number;                             /* IMMEDIATE - the value, INDEX - the index, REGISTER - the number of the register */
+    const char *name;                       /* IMMEDIATE - a constant instead of the value, DIRECT and INDEX - the label */
+    const char *indexName;                  /* INDEX - a constant instead of the index */
+
+} AssemblerOperand;
+
+/* Defines a program being built without text, see begin_file() */
+typedef struct AssemblerBuilder AssemblerBuilder;
+
+/* Defines everything an assembly produces, the same content as the .ob, .ent and .ext files */
+typedef struct AssemblerResult
+{
+    int status;
+
+    int *words;                             /* The 14 bit words of the code segment followed by the data segment */
+    int codeLength;
+    int dataLength;
+    int firstAddress;                       /* The address of the first word */
+
+    AssemblerSymbol *entries;
+    int entryCount;
+    AssemblerSymbol *externs;
+    int externCount;
+
+    AssemblerDiagnostic *diagnostics;
+    int diagnosticCount;
+
+} AssemblerResult;
+
+
+/* ------------------------------------ Functions ------------------------------------ */
+
+/** assemble_buffer
+ *  @brief Assembles a source held in memory, without touching the disk or printing anything.
+ *         The macros are expanded first, as for a .as file.
+ *  @param source The source, does not need to be null terminated.
+ *  @param length The length of the source.
+ *  @param options The options, NULL for the defaults.
+ *  @param result Receives the result, free it with free_assembler_result() whatever the status.
+ *  @return The status, also kept in result->status.
+ */
+int assemble_buffer(const char *source, int length, const AssemblerOptions *options, AssemblerResult *result);
+
+/** begin_file
+ *  @brief Starts a program built line by line instead of written as text. The lines go through the same validation,
+ *         address assignment and encoding as the lines of a .as file, the diagnostics show the text they stand for.
+ *  @param options The options, NULL for the defaults.
+ *  @return The builder, NULL when memory ran out.
+ */
+AssemblerBuilder *begin_file(const AssemblerOptions *options);
+
+/** define_label
+ *  @brief Gives the next line of the program a label, as "name:" before it.
+ *  @param builder The builder.
+ *  @param name The name of the label.
+ */
+void define_label(AssemblerBuilder *builder, const char *name);
+
+/** define_constant
+ *  @brief Adds a ".define name = value" line.
+ *  @param builder The builder.
+ *  @param name The name of the constant.
+ *  @param value The value.
+ */
+void define_constant(AssemblerBuilder *builder, const char *name, int value);
+
+/** emit_instruction
+ *  @brief Adds an instruction line.
+ *  @param builder The builder.
+ *  @param opcode The opcode of the instruction (0 for mov ... 15 for hlt).
+ *  @param operands The operands, the source operand first.
+ *  @param operandCount The number of operands, at most 2.
+ */
+void emit_instruction(AssemblerBuilder *builder, int opcode, const AssemblerOperand *operands, int operandCount);
+
+/** emit_data
+ *  @brief Adds a ".data" line.
+ *  @param builder The builder.
+ *  @param values The values.
+ *  @param count The number of values.
+ */
+void emit_data(AssemblerBuilder *builder, const int *values, int count);
+
+/** emit_string
+ *  @brief Adds a ".string" line.
+ *  @param builder The builder.
+ *  @param characters The characters of the string, null terminated.
+ */
+void emit_string(AssemblerBuilder *builder, const char *characters);
+
+/** emit_include
+ *  @brief Adds an ".include" line, which takes the words of a data table from a file: a ".bin" file holds 16 bit
+ *         little endian words, any other file a list of integers separated by commas or whitespaces.
+ *  @param builder The builder.
+ *  @param fileName The name of the file, relative to the directory of the program.
+ */
+void emit_include(AssemblerBuilder *builder, const char *fileName);
+
+/** declare_entry
+ *  @brief Adds an ".entry name" line.
+ *  @param builder The builder.
+ *  @param name The name of the label.
+ */
+void declare_entry(AssemblerBuilder *builder, const char *name);
+
+/** declare_extern
+ *  @brief Adds an ".extern name" line.
+ *  @param builder The builder.
+ *  @param name The name of the label.
+ */
+void declare_extern(AssemblerBuilder *builder, const char *name);
+
+/** finish_file
+ *  @brief Assembles a built program as assemble_buffer() does, and frees the builder.
+ *  @param builder The builder.
+ *  @param result Receives the result, free it with free_assembler_result() whatever the status.
+ *  @return The status, also kept in result->status.
+ */
+int finish_file(AssemblerBuilder *builder, AssemblerResult *result);
+
+/** finish_file_outputs
+ *  @brief Assembles a built program and writes its .ob, .ent and .ext files, as the assembler does for a .as file
+ *         (the errors are printed), and frees the builder.
+ *  @param builder The builder.
+ *  @param programName The name of the program, the output files are named after it.
+ *  @return ASSEMBLER_SUCCESS if the files were written, ASSEMBLER_ERRORS otherwise.
+ */
+int finish_file_outputs(AssemblerBuilder *builder, const char *programName);
+
+/** free_assembler_result
+ *  @brief Frees everything assemble_buffer() allocated in a result.
+ *  @param result The result.
+ */
+void free_assembler_result(AssemblerResult *result);
+
+#endif
@@ -0,0 +1,306 @@
+/* Needed for the sockets, getcwd() and getuid() when compiling with -ansi */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "global_definitions.h"
+#include "daemon.h"
+#include "manifest.h"
+
+/* A drop-in replacement for "./assembler program1 program2 ..." that hands the programs to a running
+ * "./assembler --daemon" instead of starting a new assembler process. */
+
+/**
+ * Write All
+ *
+ * Writes the whole text to a socket, retrying short writes.
+ *
+ * @param fd - The socket.
+ * @param text - The null terminated text.
+ * @return True if everything was written, False otherwise.
+ */
+static bool writeAll(int fd, const char *text) {
+    size_t length = strlen(text);
+    ssize_t written;
+
+    while (length > 0) {
+        written = write(fd, text, length);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            return False;
+        }
+        text += written;
+        length -= written;
+    }
+
+    return True;
+}
+
+/**
+ * Connect to the Daemon
+ *
+ * @return The connected socket, -1 on failure.
+ */
+static int connectToDaemon(void) {
+    struct sockaddr_un address;
+    struct stat status;
+    int fd;
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+
+    if (!daemon_socket_path(address.sun_path, sizeof(address.sun_path))) {
+        errno = ENAMETOOLONG;
+        return -1;
+    }
+
+    /* The default socket may sit in a shared directory, a socket another user put there is not our daemon */
+    if (getenv(DAEMON_SOCKET_VARIABLE) == NULL && stat(address.sun_path, &status) == 0 && status.st_uid != getuid()) {
+        errno = EACCES;
+        return -1;
+    }
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+
+    if (connect(fd, (struct sockaddr *)&address, sizeof(address)) != 0) {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+/**
+ * Send the Environment
+ *
+ * Sends the variables the options of the compilation are taken from, so the daemon compiles with the options
+ * this process would have had as "./assembler".
+ *
+ * @param fd - The connected socket.
+ * @return True if the variables were sent, False otherwise.
+ */
+static bool sendEnvironment(int fd) {
+    static const char *names[FORWARDED_VARIABLE_COUNT] = FORWARDED_VARIABLES;
+    const char *value;
+    int i;
+
+    for (i = 0; i < FORWARDED_VARIABLE_COUNT; i++) {
+        value = getenv(names[i]);
+
+        /* A variable that is not set is not sent, the daemon takes the default */
+        if (value == NULL) {
+            continue;
+        }
+
+        if (strchr(value, '\n') != NULL || strlen(names[i]) + strlen(value) + sizeof(REQUEST_ENVIRONMENT "=\n") > MAX_REQUEST_LINE_LENGTH) {
+            return False;
+        }
+
+        if (!writeAll(fd, REQUEST_ENVIRONMENT) || !writeAll(fd, names[i]) || !writeAll(fd, "=") || !writeAll(fd, value) || !writeAll(fd, "\n")) {
+            return False;
+        }
+    }
+
+    return True;
+}
+
+/**
+ * Send a Program
+ *
+ * @param fd - The connected socket.
+ * @param program - The program.
+ * @return True if the program was sent, False otherwise.
+ */
+static bool sendProgram(int fd, const char *program) {
+
+    /* A line of the protocol cannot hold a newline */
+    if (strchr(program, '\n') != NULL) {
+        return False;
+    }
+
+    return writeAll(fd, REQUEST_FILE) && writeAll(fd, program) && writeAll(fd, "\n");
+}
+
+/**
+ * Send a Manifest
+ *
+ * Sends the programs of a manifest as they are read, the daemon receives them like any other programs.
+ *
+ * @param fd - The connected socket.
+ * @param path - The manifest path, MANIFEST_STANDARD_INPUT for the standard input.
+ * @return True if the programs were sent, False otherwise.
+ */
+static bool sendManifest(int fd, const char *path) {
+    char program[MAX_MANIFEST_LINE_LENGTH];
+    FILE *manifest = open_manifest(path);
+    bool sent = True;
+
+    if (manifest == NULL) {
+        return False;
+    }
+
+    while (sent && next_manifest_program(manifest, program)) {
+        sent = sendProgram(fd, program);
+    }
+
+    close_manifest(manifest);
+
+    return sent;
+}
+
+/**
+ * Send Request
+ *
+ * @param fd - The connected socket.
+ * @param argc - The number of arguments.
+ * @param argv - The arguments, the programs start at argv[1].
+ * @return True if the request was sent, False otherwise.
+ */
+static bool sendRequest(int fd, int argc, char *argv[]) {
+    char directory[MAX_REQUEST_LINE_LENGTH - sizeof(REQUEST_DIRECTORY)];
+    const char *manifestPath;
+    bool sent;
+    int i;
+
+    if (getcwd(directory, sizeof(directory)) == NULL) {
+        return False;
+    }
+
+    if (!writeAll(fd, REQUEST_DIRECTORY) || !writeAll(fd, directory) || !writeAll(fd, "\n") || !sendEnvironment(fd)) {
+        return False;
+    }
+
+    for (i = 1; i < argc; i++) {
+        manifestPath = manifest_argument(argv[i]);
+        sent = (manifestPath != NULL ? sendManifest(fd, manifestPath) : sendProgram(fd, argv[i]));
+
+        if (!sent) {
+            return False;
+        }
+    }
+
+    return writeAll(fd, "\n");
+}
+
+/**
+ * Copy a Segment
+ *
+ * Copies a segment of the response to the stream the assembler printed it to.
+ *
+ * @param response - The response stream, positioned after the header of the segment.
+ * @param length - The length of the segment.
+ * @param stream - stdout or stderr.
+ * @return True if the whole segment was received, False otherwise.
+ */
+static bool copySegment(FILE *response, unsigned long length, FILE *stream) {
+    char buffer[BUFSIZ];
+    size_t chunk;
+
+    while (length > 0) {
+        chunk = (length < sizeof(buffer) ? (size_t)length : sizeof(buffer));
+        if (fread(buffer, 1, chunk, response) != chunk) {
+            return False;
+        }
+        fwrite(buffer, 1, chunk, stream);
+        length -= chunk;
+    }
+
+    /* stderr is unbuffered, stdout is flushed before it so the streams keep their order on a terminal */
+    fflush(stdout);
+
+    return True;
+}
+
+/**
+ * Receive Response
+ *
+ * Prints each segment of the response to the stream it was printed to by the daemon, as it arrives,
+ * and reads the status that follows them.
+ *
+ * @param fd - The connected socket.
+ * @param exitStatus - Receives the status.
+ * @return True if the whole response was received, False otherwise.
+ */
+static bool receiveResponse(int fd, int *exitStatus) {
+    char line[MAX_LINE_LENGTH];
+    int responseFd = dup(fd);
+    FILE *response = (responseFd < 0 ? NULL : fdopen(responseFd, "r"));
+    unsigned long length;
+    bool received = False;
+
+    if (response == NULL) {
+        if (responseFd >= 0) {
+            close(responseFd);
+        }
+        return False;
+    }
+
+    while (fgets(line, sizeof(line), response) != NULL) {
+        if (sscanf(line, RESPONSE_OUTPUT "%lu", &length) == 1) {
+            if (!copySegment(response, length, stdout)) {
+                break;
+            }
+        } else if (sscanf(line, RESPONSE_ERROR "%lu", &length) == 1) {
+            if (!copySegment(response, length, stderr)) {
+                break;
+            }
+        } else {
+            received = (sscanf(line, RESPONSE_STATUS "%d", exitStatus) == 1);
+            break;
+        }
+    }
+
+    fclose(response);
+
+    return received;
+}
+
+int main(int argc, char *argv[])
+{
+    int fd;
+    int exitStatus = EXIT_FAILURE;
+
+    if (argc < 2) {
+        fprintf(stderr, EXECUTION_FORMAT_ERROR);
+        fprintf(stderr, "\nExpected: %s program1 program2 ... (or @manifest, --manifest=manifest)\n", argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    /* A daemon that rejects the request closes the connection, the failed write reports it */
+    signal(SIGPIPE, SIG_IGN);
+
+    fd = connectToDaemon();
+    if (fd < 0) {
+        perror(DAEMON_SOCKET_ERROR);
+        exit(EXIT_FAILURE);
+    }
+
+    /* A request that could not be sent whole is ended early, the daemon then rejects it */
+    if (!sendRequest(fd, argc, argv)) {
+        shutdown(fd, SHUT_WR);
+        receiveResponse(fd, &exitStatus);
+        exitStatus = EXIT_FAILURE;
+
+    } else if (!receiveResponse(fd, &exitStatus)) {
+        fprintf(stderr, "%s\n", DAEMON_REQUEST_ERROR);
+        exitStatus = EXIT_FAILURE;
+    }
+
+    close(fd);
+
+    return exitStatus;
+}
@@ -2,26 +2,197 @@
 #include <stdlib.h>
 #include <string.h>
 
-#include "pre_processor.h"
 #include "global_definitions.h"
 #include "compilation.h"
+#include "pre_processor.h"
 #include "identification.h"
 #include "error_handling.h"
+#include "file_io.h"
 #include "analysis.h"
+#include "diagnostics.h"
+#include "air.h"
+#include "token_file.h"
+#include "jobs.h"
+
+/** Initialize the Compile Options
+ *
+ * @param options - The options, set to their defaults.
+ */
+
+void init_compile_options(CompileOptions *options) {
+
+    options->air = False;
+    options->jobs = 0;
+}
+
+/** Set a Compile Option
+ *
+ * An empty value or "0" turns an option off, as when the variable is not set. A number of jobs that is not a positive
+ * number leaves it to the number of processors.
+ *
+ * @param options - The options.
+ * @param name - The name of the environment variable.
+ * @param value - The value of the variable, NULL when it is not set.
+ * @return True if the variable is an option, False otherwise.
+ */
+
+bool set_compile_option(CompileOptions *options, const char *name, const char *value) {
+
+    char *end;
+    long jobs;
+
+    if (strcmp(name, AIR_VARIABLE) == 0) {
+        options->air = (value != NULL && value[0] != '\0' && strcmp(value, "0") != 0);
+        return True;
+    }
+
+    if (strcmp(name, JOBS_VARIABLE) == 0) {
+        jobs = (value != NULL ? strtol(value, &end, 10) : 0);
+        options->jobs = (value == NULL || *end != '\0' || jobs < 1 ? 0 : (jobs > MAX_JOBS ? MAX_JOBS : (int)jobs));
+        return True;
+    }
+
+    return False;
+}
+
+/** Create a Workspace
+ *
+ * @param options - The options of the files assembled in the workspace, NULL for the defaults.
+ * @return A pointer to the new workspace.
+ */
+
+Workspace *create_workspace(const CompileOptions *options) {
+
+    Workspace *workspace = (Workspace *)malloc(sizeof(Workspace));
+
+    if (workspace == NULL) {
+        memory_allocation_failed();
+    }
+
+    workspace->symbolsLabelsValuesHash = create_table(HT_CAPACITY);
+    workspace->entriesExternsHash = create_table(HT_CAPACITY);
+    workspace->entryRecords = create_output_buffer();
+    workspace->externRecords = create_output_buffer();
+
+    if (options != NULL) {
+        workspace->options = *options;
+    } else {
+        init_compile_options(&workspace->options);
+    }
+
+    return workspace;
+}
+
+/** Free a Workspace
+ *
+ * @param workspace - The workspace to free.
+ */
+
+void free_workspace(Workspace *workspace) {
+
+    free_table(workspace->symbolsLabelsValuesHash);
+    free_table(workspace->entriesExternsHash);
+    free_output_buffer(workspace->entryRecords);
+    free_output_buffer(workspace->externRecords);
+    free(workspace);
+}
 
 /** Compile
  *
- * This function compiles the input assembly file.
+ * This function compiles the input assembly file, its stages one after another.
  *
  * @param fileName - Name of the input assembly file.
+ * @param workspace - The workspace the file is assembled in, reused by the next file.
  * @return 0 if the file was compiled successfully, 1 if the file does not exist.
  */
  
-int compile(char * fileName){
+int compile(char * fileName, Workspace *workspace){
+
+    CompilationUnit unit;                         /* The file between the stages */
+
+    unit.workspace = workspace;
+
+    if (read_compilation_unit(fileName, &unit) == False) {
+        return 1;
+    }
+
+    assemble_compilation_unit(&unit);
+    write_compilation_unit(&unit);
+
+    return EXIT_SUCCESS;
+}
+
+/** Compile a Source
+ *
+ * This function compiles a source held in memory, as compile() compiles a file. The macros are expanded in memory
+ * and the errors are reported with the name of the ".am" file, but neither the ".as" nor the ".am" file is touched.
+ *
+ * @param programName - Name of the program, the output files are named after it.
+ * @param data - The source, allocated with malloc() with room for a terminator after it. Freed.
+ * @param length - The length of the source.
+ * @param workspace - The workspace the program is assembled in, reused by the next file.
+ * @return 0 if the program was compiled successfully, 1 if its name is too long.
+ */
+
+int compile_source(char *programName, char *data, int length, Workspace *workspace) {
+
+    CompilationUnit unit;                         /* The program between the stages */
+    SourceBuffer *original;
+
+    if (strlen(programName) + strlen(".am") >= MAX_LINE_LENGTH) {
+        console_printf(CONSOLE_ERROR, "%s %s\n", FILE_NAME_LENGTH_ERROR, programName);
+        free(data);
+        return 1;
+    }
+
+    sprintf(unit.preProcessedFileName, "%s.am", programName);
+    unit.workspace = workspace;
+    unit.tokens = NULL;
+    unit.air = NULL;
+    unit.lines = NULL;
+    unit.inMemory = True;
+
+    original = create_source_buffer(data, length);
+    unit.source = expand_macros(original);
+    free_source_buffer(original);
+    unit.hasSource = True;
+
+    console_printf(CONSOLE_OUTPUT, "Processing file %s...\n", unit.preProcessedFileName);
+
+    assemble_compilation_unit(&unit);
+    write_compilation_unit(&unit);
+
+    return EXIT_SUCCESS;
+}
+
+/** Read a Compilation Unit
+ *
+ * The first stage of compile(), pre-processes the input assembly file.
+ * A program with an up to date ".air" file is taken from it instead, without pre-processing it.
+ *
+ * @param fileName - Name of the input assembly file.
+ * @param unit - Receives the pre-processed file, its workspace is set by the caller.
+ * @return True if the file was read, False if it does not exist.
+ */
+
+bool read_compilation_unit(char * fileName, CompilationUnit *unit){
 
-    FILE *inputFile = NULL;                       /* File pointer for the input file */
-    char PreProcessedFileName[MAX_LINE_LENGTH];   /* Buffer to store the output file name of the pre-processed file */
     char manipulatedFileName[MAX_LINE_LENGTH];    /* Buffer to store the input file name */
+    char tokenFileName[MAX_LINE_LENGTH];          /* The tokenized program, read instead of the text when it exists */
+    char *baseName = NULL;                        /* The input file name without the extension */
+
+    unit->source = NULL;
+    unit->tokens = NULL;
+    unit->air = NULL;
+    unit->lines = NULL;
+    unit->hasSource = False;
+    unit->inMemory = False;
+
+    /* The file names are built in buffers of MAX_LINE_LENGTH */
+    if (strlen(fileName) + strlen(".as") >= MAX_LINE_LENGTH) {
+        console_printf(CONSOLE_ERROR, "%s %s\n", FILE_NAME_LENGTH_ERROR, fileName);
+        return False;
+    }
 
     strcpy(manipulatedFileName, fileName);
 
@@ -29,88 +200,229 @@ int compile(char * fileName){
     /* Add the ".as" extension to the input file name */
     sprintf(manipulatedFileName, "%s.as", manipulatedFileName);
 
-    /* Check the file even exists */
-    inputFile = openFile(manipulatedFileName, "r");
+    /* A program written by another program may come as tokens instead of text, unless the text is newer */
+    if (strlen(fileName) + strlen(TOKEN_EXTENSION) < MAX_LINE_LENGTH) {
+        sprintf(tokenFileName, "%s%s", fileName, TOKEN_EXTENSION);
+        unit->tokens = map_token_file(tokenFileName, manipulatedFileName, &unit->tokensLength);
+    }
 
-    if (inputFile == NULL) {
-        return 1;
+    /* The program was validated and assembled already, its output files are built from the ".air" file (when enabled, see air.h) */
+    if (unit->workspace->options.air && strlen(fileName) + strlen(AIR_EXTENSION) < MAX_LINE_LENGTH) {
+        sprintf(unit->preProcessedFileName, "%s%s", fileName, AIR_EXTENSION);
+        unit->air = map_air_file((unit->tokens != NULL ? tokenFileName : manipulatedFileName), unit->preProcessedFileName, &unit->airLength);
+
+        if (unit->air != NULL) {
+            if (unit->tokens != NULL) {
+                unmap_token_file(unit->tokens, unit->tokensLength);
+                unit->tokens = NULL;
+            }
+
+            console_printf(CONSOLE_OUTPUT, "Processing file %s...\n", unit->preProcessedFileName);
+            unit->hasSource = True;
+            return True;
+        }
     }
 
-    else {
-        fclose(inputFile);
+    /* The tokens need no pre-processing */
+    if (unit->tokens != NULL) {
+        strcpy(unit->preProcessedFileName, tokenFileName);
+        console_printf(CONSOLE_OUTPUT, "Processing file %s...\n", unit->preProcessedFileName);
+        unit->hasSource = True;
+        return True;
     }
 
-    /* Pre-process the file */
-    preProcessFile(manipulatedFileName);
+    /* Pre-process the file, the expanded source is kept for the next stage */
+    unit->source = write_expanded_file(manipulatedFileName);
+
+    /* The file does not exist (or cannot be read) */
+    if (unit->source == NULL) {
+        return False;
+    }
 
-    /* Process the pre-processed file */
-    sprintf(PreProcessedFileName, "%s.am", removeFileExtension(manipulatedFileName));
+    baseName = removeFileExtension(manipulatedFileName);
+    sprintf(unit->preProcessedFileName, "%s.am", baseName);
+    free(baseName);
 
     /* Print the file being processed */
-    printf("Processing file %s...\n", PreProcessedFileName);
+    console_printf(CONSOLE_OUTPUT, "Processing file %s...\n", unit->preProcessedFileName);
 
-    /* Process the file */
-    processFile(PreProcessedFileName);
+    unit->hasSource = True;
 
-    return EXIT_SUCCESS;
+    return True;
 }
 
-/** Process the File
+/** Assemble a Compilation Unit
  *
- * This function processes the input assembly file and creates the binary and encoded files.
+ * The second stage of compile(), checks the pre-processed file for errors and generates its code.
  *
- * @param inputFileName - Name of the input assembly file.
+ * @param unit - The pre-processed file, its source is freed.
  */
- 
-void processFile(char *inputFileName) {
+
+void assemble_compilation_unit(CompilationUnit *unit) {
+
+    if (unit->hasSource == False) {
+        return;
+    }
+
+    /* Nothing to check, the segments and the records are ready */
+    if (unit->air != NULL) {
+        unit->lines = load_air_file(unit->air, unit->workspace->entryRecords, unit->workspace->externRecords);
+        return;
+    }
+
+    if (unit->tokens != NULL) {
+        unit->lines = assemble_tokens(unit->tokens, unit->tokensLength, unit->preProcessedFileName, unit->workspace);
+        unmap_token_file(unit->tokens, unit->tokensLength);
+        unit->tokens = NULL;
+        return;
+    }
+
+    unit->lines = assemble_source(unit->source, unit->preProcessedFileName, unit->workspace);
+    free_source_buffer(unit->source);
+    unit->source = NULL;
+}
+
+/** Write a Compilation Unit
+ *
+ * The last stage of compile(), writes the output files of an assembled file or reports its errors.
+ *
+ * @param unit - The assembled file, its lines are freed.
+ */
+
+void write_compilation_unit(CompilationUnit *unit) {
+
+    FileBatch outputFiles;                        /* The output files, written (or removed) together */
+    char *objectFile = NULL;                      /* The encoded file */
+    size_t objectLength;
+    char airFileName[MAX_LINE_LENGTH];            /* The ".air" file, written for the next runs */
+    char *airFile = NULL;
+    size_t airLength;
+    char *baseName = NULL;
+
+    if (unit->hasSource == False) {
+        return;
+    }
+
+    init_file_batch(&outputFiles);
+
+    /* if there are errors, return */
+    if (unit->lines == NULL) {
+
+        /* Outputs of a previous run no longer match the source */
+        remove_output_files(unit->preProcessedFileName, &outputFiles);
+        submit_file_batch(&outputFiles);
+
+        console_printf(CONSOLE_OUTPUT, "Errors found in file %s. Compilation aborted.\n", unit->preProcessedFileName);
+        return;
+    }
+
+    /* ------------------------------------------- Encoded file creation ------------------------------------------- */
+
+    /* All the outputs are written to temporary files and renamed into place only once the file assembled successfully */
+    objectFile = build_encoded_file(unit->lines, &objectLength);
+    commit_output_files(unit->preProcessedFileName, objectFile, objectLength, unit->workspace->entryRecords, unit->workspace->externRecords, &outputFiles);
+
+    /* Written after the source was read, so it is newer than the source until the source changes */
+    if (unit->air == NULL && unit->inMemory == False && unit->workspace->options.air) {
+        baseName = removeFileExtension(unit->preProcessedFileName);
+
+        if (strlen(baseName) + strlen(AIR_EXTENSION) < MAX_LINE_LENGTH) {
+            sprintf(airFileName, "%s%s", baseName, AIR_EXTENSION);
+            airFile = build_air_file(unit->lines, unit->workspace->entryRecords, unit->workspace->externRecords, &airLength);
+            batch_write_file(&outputFiles, airFileName, airFile, airLength);
+        }
+
+        free(baseName);
+    }
+
+    submit_file_batch(&outputFiles);
+
+    /* Free the memory */
+    free_line_table(unit->lines);
+    unit->lines = NULL;
+
+    if (unit->air != NULL) {
+        unmap_air_file(unit->air, unit->airLength);
+        unit->air = NULL;
+    }
+}
+
+/** Take a Line
+ *
+ * Copies a classified line into the buffer of a pass, cut to the size of the buffer.
+ *
+ * @param lines - The classified lines.
+ * @param lineIndex - The index of the line.
+ * @param line - Receives the line.
+ * @param lineSize - The size of the buffer.
+ */
+
+static void takeLine(LineTable *lines, int lineIndex, char *line, int lineSize) {
+    strncpy(line, LINE_TEXT(lines, lineIndex), lineSize - 1);
+    line[lineSize - 1] = '\0';
+}
+
+/** Assemble Lines
+ *
+ * This function checks classified lines for errors and generates their code, without writing anything.
+ * The errors are reported with print_error().
+ *
+ * @param lines - The classified lines, freed when errors were found.
+ * @param source - The source the lines were read from, NULL for the records of a tokenized program.
+ * @param program - The tokenized program the lines stand for, NULL for a source. Its records are checked from their fields.
+ * @param inputFileName - Name of the source, for the error messages.
+ * @param workspace - The workspace, its previous contents are dropped. Receives the .ent and .ext records.
+ * @return The lines holding the code and the data segments, NULL if errors were found.
+ */
+
+static LineTable *assembleLines(LineTable *lines, SourceBuffer *source, const TokenProgram *program, char *inputFileName, Workspace *workspace) {
 
     char line[MAX_LINE_LENGTH * 2];                                        /* Buffer to store each line from the file */
-    FILE *inputFile = NULL;                                                /* File pointer for the input file */
+    int lineIndex;                                                         /* Index of the current line in the source */
     CommandType commandType;                                               /* Type of the command in the line */
     int lineNumber = 0;                                                    /* Counter for the line number */
     int directiveOrder = 0;                                                /* Counter for the directive order */
     bool foundError = False;                                               /* Flag to indicate if an error was found */
-    int currentMemoryAddress = STARTING_MEMORY_LOCATION;                   /* Counter for the current memory address */
     
-    HashTable *instructionsHash        = create_table(HT_CAPACITY);        /* Create the instruction table */
-    HashTable *symbolsLabelsValuesHash = create_table(HT_CAPACITY);        /* Create the symbols-labels values table */
-    HashTable *entriesExternsHash      = create_table(HT_CAPACITY);        /* Create the entries-externs table */
-    HashTable *registersHash           = create_table(HT_CAPACITY);        /* Create the registers table */
-
-    createInstructionTable(instructionsHash);
-    createRegistersTable(registersHash);
-
-    /* Open the input file */
-    inputFile = openFile(inputFileName, "r");
-    if (inputFile == NULL) {
-        free_table(instructionsHash);
-        free_table(symbolsLabelsValuesHash);
-        return;
-    }
+    HashTable *symbolsLabelsValuesHash = workspace->symbolsLabelsValuesHash;   /* The symbols-labels values table */
+    HashTable *entriesExternsHash      = workspace->entriesExternsHash;        /* The entries-externs table */
+
+    /* Drop what the previous file left in the workspace */
+    clear_table(symbolsLabelsValuesHash);
+    clear_table(entriesExternsHash);
+    reset_output_buffer(workspace->entryRecords);
+    reset_output_buffer(workspace->externRecords);
 
     /* "------------------------------------------- Directive errors ------------------------------------------- */
 
     /* Read lines from the input file - first iteration for error checking */
-    while (fgets(line, sizeof(line), inputFile) != NULL) {
-        
+    for (lineIndex = 0; lineIndex < lines->count; lineIndex++) {
+
         lineNumber++;
 
+        /* The records are checked from their fields, their lines are only for the error messages */
+        if (program != NULL) {
+            check_token_errors(program, LINE_TEXT(lines, lineIndex), lineNumber, inputFileName, symbolsLabelsValuesHash, &directiveOrder, entriesExternsHash, lines, lineIndex, &foundError);
+            continue;
+        }
+
+        copy_source_line(source, lineIndex, line, sizeof(line));
+
+        /* The later passes skip the line, none of it reaches the fixed-size buffers of the checks */
         if(checkIfLineLengthValid(line, lineNumber, inputFileName) == False) {
+            lines->kinds[lineIndex] = UNDEFINED;
             foundError = True;
             continue;
         }
         
-        /* Identify the command type */
-        commandType = identifyCommandType(line, instructionsHash);
+        /* Take the classified line */
+        commandType = (CommandType)lines->kinds[lineIndex];
+        takeLine(lines, lineIndex, line, sizeof(line));
 
         /* Check for errors */
-        check_errors(commandType, line, lineNumber, inputFileName, symbolsLabelsValuesHash, &directiveOrder, entriesExternsHash, &foundError);
+        check_errors(commandType, line, lineNumber, inputFileName, symbolsLabelsValuesHash, &directiveOrder, entriesExternsHash, lines, lineIndex, &foundError);
     }
 
-    /* Move the file pointer to the beginning of the file */
-
-    rewind(inputFile);
-
     /* Reset the line number */
     lineNumber = 0;  
 
@@ -118,155 +430,148 @@ void processFile(char *inputFileName) {
 
     /* ------------------------------------------- Entries / Exters errors ------------------------------------------- */
 
-    while (fgets(line, sizeof(line), inputFile) != NULL) {
-        
+    for (lineIndex = 0; lineIndex < lines->count; lineIndex++) {
+
         lineNumber++;
+
+        if (program != NULL) {
+            check_token_entries_externs_errors(program, LINE_TEXT(lines, lineIndex), lineNumber, inputFileName, entriesExternsHash, symbolsLabelsValuesHash, lineIndex, &foundError);
+            continue;
+        }
         
-        /* Identify the command type */
-        commandType = identifyCommandType(line, instructionsHash);
+        /* Take the classified line */
+        commandType = (CommandType)lines->kinds[lineIndex];
+        takeLine(lines, lineIndex, line, sizeof(line));
 
         /* Check for errors */
         check_entries_externs_errors(commandType, line, lineNumber, inputFileName, entriesExternsHash, symbolsLabelsValuesHash, &foundError);
     }
 
-    /* Move the file pointer to the beginning of the file */
-
-    rewind(inputFile);
-
     /* Reset the line number */
     lineNumber = 0;  
 
     /* ------------------------------------------- Instructions errors ------------------------------------------- */
 
     /* Read lines from the input file - third iteration for checking instructions errors after we have the symbols labels hash */
-    while (fgets(line, sizeof(line), inputFile) != NULL) {
-        
+    for (lineIndex = 0; lineIndex < lines->count; lineIndex++) {
+
         lineNumber++;
+
+        if (program != NULL) {
+            check_token_instruction_errors(program, LINE_TEXT(lines, lineIndex), lineNumber, inputFileName, entriesExternsHash, symbolsLabelsValuesHash, lines, lineIndex, &foundError);
+            continue;
+        }
         
-        /* Identify the command type */
-        commandType = identifyCommandType(line, instructionsHash);
+        /* Take the classified line */
+        commandType = (CommandType)lines->kinds[lineIndex];
+        takeLine(lines, lineIndex, line, sizeof(line));
 
         /* Check for errors */
-        check_instruction_errors(commandType, line, lineNumber, inputFileName, entriesExternsHash, symbolsLabelsValuesHash, &foundError);
-    }
-
-    /* if there are errors, free the memory and return */
-    if (foundError == True) {
-        free_table(instructionsHash);
-        free_table(symbolsLabelsValuesHash);
-        free_table(entriesExternsHash);
-        free_table(registersHash);
-        fclose(inputFile);
-        printf("Errors found in file %s. Compilation aborted.\n", inputFileName);
-        return;
+        check_instruction_errors(commandType, line, lineNumber, inputFileName, entriesExternsHash, symbolsLabelsValuesHash, lines, lineIndex, &foundError);
     }
 
-    /* Move the file pointer to the beginning of the file */
+    /* ------------------------------------------- Code Generation ------------------------------------------- */
 
-    rewind(inputFile);
+    /* Emit the words of every line in a single pass - only when there are no syntax errors */
+    if (foundError == False) {
+        generate_code(lines, symbolsLabelsValuesHash, entriesExternsHash, workspace->entryRecords, workspace->externRecords);
+    }
+    else {
+        free_line_table(lines);
+        lines = NULL;
+    }
 
-    /* Reset the line number */
-    lineNumber = 0; 
-    directiveOrder = 0;
-    /* ------------------------------------------- Memory Calculations ------------------------------------------- */
+    return lines;
+}
 
-    /* Read lines from the input file - Get the address memory for each instruction line - now we know there are no syntax errors */
-    while (fgets(line, sizeof(line), inputFile) != NULL) {
-        
-        lineNumber++;
-        
-        /* Identify the command type */
-        commandType = identifyCommandType(line, instructionsHash);
+/** Assemble a Source
+ *
+ * This function checks a pre-processed source for errors and generates its code, without writing anything.
+ * The errors are reported with print_error().
+ *
+ * @param source - The pre-processed source.
+ * @param inputFileName - Name of the source, for the error messages.
+ * @param workspace - The workspace, its previous contents are dropped. Receives the .ent and .ext records.
+ * @return The classified lines holding the code and the data segments, NULL if errors were found.
+ */
 
-        /* Check for errors */
-        calculate_memory_addresses_for_instructions(commandType, line, symbolsLabelsValuesHash, &directiveOrder, entriesExternsHash,&currentMemoryAddress);
-    }
+struct LineTable *assemble_source(SourceBuffer *source, char *inputFileName, Workspace *workspace) {
 
-    /* Move the file pointer to the beginning of the file */
+    /* Every pass works on the same cleaned lines, classify them once (in parallel for large files) */
+    return assembleLines(classify_source_lines(source), source, NULL, inputFileName, workspace);
+}
 
-    rewind(inputFile);
+/** Assemble Tokens
+ *
+ * This function checks a tokenized program (see token_file.h) for errors and generates its code, without writing anything.
+ * The errors are reported with print_error().
+ *
+ * @param tokens - The contents of the ".asb" file.
+ * @param length - The length of the contents.
+ * @param inputFileName - Name of the file, for the error messages.
+ * @param workspace - The workspace, its previous contents are dropped. Receives the .ent and .ext records.
+ * @return The lines holding the code and the data segments, NULL if errors were found.
+ */
 
-    /* Reset the line number */
-    lineNumber = 0; 
-    directiveOrder = 0;
-    /* ------------------------------------------- Memory Calculations ------------------------------------------- */
+struct LineTable *assemble_tokens(const char *tokens, size_t length, char *inputFileName, Workspace *workspace) {
 
-    /* Read lines from the input file - Get the address memory for each directive line - now we know there are no syntax errors */
-    while (fgets(line, sizeof(line), inputFile) != NULL) {
-        
-        lineNumber++;
-        
-        /* Identify the command type */
-        commandType = identifyCommandType(line, instructionsHash);
+    TokenProgram program;                  /* The parts of the ".asb" file */
 
-        /* Check for errors */
-        calculate_memory_addresses_for_directives(commandType, line, symbolsLabelsValuesHash, &directiveOrder, entriesExternsHash,&currentMemoryAddress);
+    if (read_token_program(tokens, length, inputFileName, &program) == False) {
+        return NULL;
     }
 
-    /* Close the input file */
-    fclose(inputFile);
-    
-    /* ------------------------------------------- Binary File Creation ------------------------------------------- */
-    build_binary_file(inputFileName, symbolsLabelsValuesHash, entriesExternsHash, instructionsHash, registersHash);
-
+    return assemble_token_program(&program, inputFileName, workspace);
+}
 
+/** Assemble a Token Program
+ *
+ * This function checks the parts of a tokenized program for errors and generates its code, without writing anything.
+ * The errors are reported with print_error().
+ *
+ * @param program - The parts of the program, read from a ".asb" file or kept by a builder.
+ * @param inputFileName - Name of the program, for the error messages.
+ * @param workspace - The workspace, its previous contents are dropped. Receives the .ent and .ext records.
+ * @return The lines holding the code and the data segments, NULL if errors were found.
+ */
 
-    /* ------------------------------------------- Encoded file creation ------------------------------------------- */
-    build_encoded_file(inputFileName, symbolsLabelsValuesHash, currentMemoryAddress);
+struct LineTable *assemble_token_program(const struct TokenProgram *program, char *inputFileName, Workspace *workspace) {
 
-    /* Free the memory */
-    free_table(instructionsHash);
-    free_table(symbolsLabelsValuesHash);
-    free_table(entriesExternsHash);
-    free_table(registersHash);
+    /* The records are validated from their fields, without scanning text */
+    LineTable *lines = classify_token_lines(program, inputFileName);
 
+    if (lines == NULL) {
+        return NULL;
+    }
 
+    return assembleLines(lines, NULL, program, inputFileName, workspace);
 }
 
-/** Create the Instruction Table
+/** Process the File
  *
- * This function creates the instruction table and stores it in a hash map.
+ * This function processes the input assembly file and generates its code and writes the output files.
  *
- * @param mp - Pointer to the hash map to store the instruction table.
+ * @param inputFileName - Name of the input assembly file.
+ * @param workspace - The workspace the file is assembled in.
  */
+ 
+void processFile(char *inputFileName, Workspace *workspace) {
 
-void createInstructionTable(HashTable* mp){
-
-    ht_insert(mp, "mov", "0000",  "instruction", "NULL", "NULL", "NULL");
-    ht_insert(mp, "cmp", "0001",  "instruction", "NULL", "NULL", "NULL");
-    ht_insert(mp, "add", "0010",  "instruction", "NULL", "NULL", "NULL");
-    ht_insert(mp, "sub", "0011",  "instruction", "NULL", "NULL", "NULL");
-    ht_insert(mp, "not", "0100",  "instruction", "NULL", "NULL", "NULL");
-    ht_insert(mp, "clr", "0101",  "instruction", "NULL", "NULL", "NULL");
-    ht_insert(mp, "lea", "0110",  "instruction", "NULL", "NULL", "NULL");
-    ht_insert(mp, "inc", "0111",  "instruction", "NULL", "NULL", "NULL");
-    ht_insert(mp, "dec", "1000",  "instruction", "NULL", "NULL", "NULL");
-    ht_insert(mp, "jmp", "1001",  "instruction", "NULL", "NULL", "NULL");
-    ht_insert(mp, "bne", "1010",  "instruction", "NULL", "NULL", "NULL");
-    ht_insert(mp, "red", "1011",  "instruction", "NULL", "NULL", "NULL");
-    ht_insert(mp, "prn", "1100",  "instruction", "NULL", "NULL", "NULL");
-    ht_insert(mp, "jsr", "1101",  "instruction", "NULL", "NULL", "NULL");
-    ht_insert(mp, "rts", "1110",  "instruction", "NULL", "NULL", "NULL");
-    ht_insert(mp, "hlt", "1111",  "instruction", "NULL", "NULL", "NULL");
-}
+    CompilationUnit unit;                                                  /* The file between the stages */
 
-/** Create the Registers Table
- *
- * This function creates the registers table and stores it in a hash map.
- *
- * @param mp - Pointer to the hash map to store the registers table.
- */
+    sprintf(unit.preProcessedFileName, "%.*s", MAX_LINE_LENGTH - 1, inputFileName);
+    unit.workspace = workspace;
+    unit.tokens = NULL;
+    unit.air = NULL;
+    unit.lines = NULL;
+    unit.inMemory = False;
 
-void createRegistersTable(HashTable* mp){
+    /* Read the input file and index its lines - every pass walks the lines in memory */
+    unit.source = read_source_buffer(inputFileName);
+    unit.hasSource = (unit.source != NULL);
 
-    ht_insert(mp, "r0", "000",  "register", "NULL", "NULL", "NULL");
-    ht_insert(mp, "r1", "001",  "register", "NULL", "NULL", "NULL");
-    ht_insert(mp, "r2", "010",  "register", "NULL", "NULL", "NULL");
-    ht_insert(mp, "r3", "011",  "register", "NULL", "NULL", "NULL");
-    ht_insert(mp, "r4", "100",  "register", "NULL", "NULL", "NULL");
-    ht_insert(mp, "r5", "101",  "register", "NULL", "NULL", "NULL");
-    ht_insert(mp, "r6", "110",  "register", "NULL", "NULL", "NULL");
-    ht_insert(mp, "r7", "111",  "register", "NULL", "NULL", "NULL");
+    assemble_compilation_unit(&unit);
+    write_compilation_unit(&unit);
 }
 
 /** print directives by order
@@ -1,37 +1,171 @@
 #include "utility_functions.h"
 
+/* Defined in token_file.h */
+struct TokenProgram;
+
+/* Defines the options of the files of a run. The command line takes them from its environment, assembler_client
+ * sends its own to the daemon, the library callers set them */
+typedef struct CompileOptions
+{
+    bool air;                               /* Read the up to date ".air" files and write new ones (see AIR_VARIABLE) */
+    int jobs;                               /* The jobs outside of make (see JOBS_VARIABLE), 0 for the number of processors */
+
+} CompileOptions;
+
+/* Defines the tables and buffers of a file that are reused by the next file, so a run assembling
+ * many files allocates them once instead of once per file */
+typedef struct Workspace
+{
+    HashTable *symbolsLabelsValuesHash;     /* The labels and the constants */
+    HashTable *entriesExternsHash;          /* The entries and the externs */
+    OutputBuffer *entryRecords;             /* The .ent records of the last file */
+    OutputBuffer *externRecords;            /* The .ext records of the last file */
+    CompileOptions options;                 /* The options of the files assembled in it */
+
+} Workspace;
+
+/* Defines a file on its way through the stages of compile(), so the stages of different files can overlap */
+typedef struct CompilationUnit
+{
+    char preProcessedFileName[MAX_LINE_LENGTH];     /* The ".am" file, the errors are reported with its name */
+    SourceBuffer *source;                           /* The expanded source, until it is assembled */
+    bool hasSource;                                 /* False when the file could not be read, the next stages skip it */
+    bool inMemory;                                  /* The source was handed over in memory, it gets no ".air" file since no ".as" file dates it */
+    char *tokens;                                   /* The mapped ".asb" file (see token_file.h), read instead of the source */
+    size_t tokensLength;
+    char *air;                                      /* The mapped ".air" file (see air.h) when it is up to date, NULL otherwise */
+    size_t airLength;
+    struct LineTable *lines;                        /* The assembled file, NULL when it has errors */
+    Workspace *workspace;                           /* Set by the caller, receives the .ent and .ext records */
+
+} CompilationUnit;
+
+/**
+ * @brief Sets the options to their defaults, as when no environment variable is set.
+ * 
+ * @param options The options.
+ */
+
+void init_compile_options(CompileOptions *options);
+
+/**
+ * @brief Sets an option from the value of its environment variable (AIR_VARIABLE, JOBS_VARIABLE).
+ * 
+ * @param options The options.
+ * @param name The name of the variable.
+ * @param value The value of the variable, NULL when it is not set.
+ * @return True if the variable is an option, False otherwise.
+ */
+
+bool set_compile_option(CompileOptions *options, const char *name, const char *value);
+
+/**
+ * @brief Creates an empty workspace.
+ * 
+ * @param options The options of the files assembled in it, NULL for the defaults.
+ * @return The workspace.
+ */
+
+Workspace *create_workspace(const CompileOptions *options);
+
+/**
+ * @brief Frees a workspace.
+ * 
+ * @param workspace The workspace to free.
+ */
+
+void free_workspace(Workspace *workspace);
+
 /**
  * @brief Compiles the given file.
  * 
  * @param fileName The name of the file to compile.
+ * @param workspace The workspace the file is assembled in, left to the next file.
+ * @return int 0 if the compilation was successful, 1 otherwise.
+ */
+
+int compile(char * fileName, Workspace *workspace);
+
+/**
+ * @brief Compiles a source held in memory as compile() compiles a file, without reading or writing its ".as" and ".am" files.
+ * 
+ * @param programName The name of the program, the output files are named after it.
+ * @param data The source, allocated with malloc() with room for a terminator after it. Freed.
+ * @param length The length of the source.
+ * @param workspace The workspace the program is assembled in, left to the next file.
  * @return int 0 if the compilation was successful, 1 otherwise.
  */
 
-int compile(char * fileName);
+int compile_source(char *programName, char *data, int length, Workspace *workspace);
+
+/**
+ * @brief The first stage of compile(), pre-processes the given file, or maps its ".air" file when it is up to date.
+ * 
+ * @param fileName The name of the file to compile.
+ * @param unit Receives the pre-processed file, its workspace is set by the caller.
+ * @return True if the file was read, False if it does not exist.
+ */
+
+bool read_compilation_unit(char * fileName, CompilationUnit *unit);
+
+/**
+ * @brief The second stage of compile(), checks the pre-processed file for errors and generates its code.
+ * 
+ * @param unit The pre-processed file.
+ */
+
+void assemble_compilation_unit(CompilationUnit *unit);
+
+/**
+ * @brief The last stage of compile(), writes the output files or reports the errors.
+ * 
+ * @param unit The assembled file.
+ */
+
+void write_compilation_unit(CompilationUnit *unit);
 
 /**
  * @brief Processes the given file.
  * 
  * @param inputFileName The name of the file to process.
+ * @param workspace The workspace the file is assembled in.
  */
 
-void processFile(char *inputFileName);
+void processFile(char *inputFileName, Workspace *workspace);
 
-/** createInstructionTable
- * @brief Creates the instruction table.
+/**
+ * @brief Checks a pre-processed source for errors and generates its code, without writing anything.
  * 
- * @param mp The hash table to create.
+ * @param source The pre-processed source.
+ * @param inputFileName The name of the source, for the error messages.
+ * @param workspace The workspace, its previous contents are dropped. Receives the .ent and .ext records.
+ * @return The classified lines holding the code and the data segments (see identification.h), NULL if errors were found.
  */
 
-void createInstructionTable(HashTable* mp);
+struct LineTable *assemble_source(SourceBuffer *source, char *inputFileName, Workspace *workspace);
 
-/** createRegistersTable
- * @brief Creates the registers table.
+/**
+ * @brief Checks a tokenized program (see token_file.h) for errors and generates its code, without writing anything.
+ * 
+ * @param tokens The contents of the ".asb" file.
+ * @param length The length of the contents.
+ * @param inputFileName The name of the file, for the error messages.
+ * @param workspace The workspace, its previous contents are dropped. Receives the .ent and .ext records.
+ * @return The classified lines holding the code and the data segments (see identification.h), NULL if errors were found.
+ */
+
+struct LineTable *assemble_tokens(const char *tokens, size_t length, char *inputFileName, Workspace *workspace);
+
+/**
+ * @brief Checks the parts of a tokenized program (see token_file.h) for errors and generates its code, without writing anything.
  * 
- * @param mp The hash table to create.
+ * @param program The parts of the program, read from a ".asb" file or kept by a builder (see assembler_api.h).
+ * @param inputFileName The name of the program, for the error messages.
+ * @param workspace The workspace, its previous contents are dropped. Receives the .ent and .ext records.
+ * @return The classified lines holding the code and the data segments (see identification.h), NULL if errors were found.
  */
 
-void createRegistersTable(HashTable* mp);
+struct LineTable *assemble_token_program(const struct TokenProgram *program, char *inputFileName, Workspace *workspace);
 
 /** print_directives_by_order
  * @brief Prints the directives by order.
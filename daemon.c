@@ -0,0 +1,592 @@
+/* Needed for the sockets, signals, threads and O_DIRECTORY when compiling with -ansi */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "global_definitions.h"
+#include "compilation.h"
+#include "diagnostics.h"
+#include "parallel.h"
+#include "file_io.h"
+#include "jobs.h"
+#include "daemon.h"
+
+/* Set by SIGINT and SIGTERM, the daemon stops once the requests being served are done */
+static volatile sig_atomic_t stopRequested = 0;
+
+/* Defines what the threads of the connections share */
+typedef struct DaemonState
+{
+    pthread_mutex_t lock;
+    pthread_cond_t connectionDone;
+    int connections;                                    /* The connections being served */
+    Workspace *workspaces[MAX_DAEMON_CONNECTIONS];      /* The workspaces of the connections that are done, reused by the next ones */
+    int freeWorkspaces;
+
+} DaemonState;
+
+/* Defines a connection served on a thread of its own */
+typedef struct Connection
+{
+    int fd;
+    DaemonState *daemon;
+
+} Connection;
+
+/* Defines a program of a request */
+typedef struct RequestedProgram
+{
+    char *name;
+    char *source;       /* The source sent with the request, NULL to read <name>.as */
+    int sourceLength;
+
+} RequestedProgram;
+
+/* Defines the programs of a request, in the order they are assembled */
+typedef struct ProgramList
+{
+    RequestedProgram *programs;
+    int count;
+    int capacity;
+
+} ProgramList;
+
+/**
+ * Request Stop
+ *
+ * @param signalNumber - The signal, unused.
+ */
+static void requestStop(int signalNumber) {
+    (void)signalNumber;
+    stopRequested = 1;
+}
+
+/**
+ * Write All
+ *
+ * Writes the whole buffer to a socket, retrying short writes.
+ *
+ * @param fd - The socket.
+ * @param data - The buffer.
+ * @param length - The length of the buffer.
+ * @return True if everything was written, False otherwise.
+ */
+static bool writeAll(int fd, const char *data, size_t length) {
+    ssize_t written;
+
+    while (length > 0) {
+        written = write(fd, data, length);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            return False;
+        }
+        data += written;
+        length -= written;
+    }
+
+    return True;
+}
+
+/**
+ * Add Program
+ *
+ * @param programs - The list of programs.
+ * @param name - The name of the program, copied.
+ * @param source - The source sent with the program, taken over by the list, NULL when there is none.
+ * @param sourceLength - The length of the source.
+ */
+static void addProgram(ProgramList *programs, const char *name, char *source, int sourceLength) {
+    RequestedProgram *program;
+
+    if (programs->count == programs->capacity) {
+        programs->capacity = (programs->capacity == 0 ? 8 : programs->capacity * 2);
+        programs->programs = realloc(programs->programs, programs->capacity * sizeof(RequestedProgram));
+        if (programs->programs == NULL) {
+            perror(MEMORY_ALLOCATION_ERROR);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    program = &programs->programs[programs->count];
+    program->name = malloc(strlen(name) + 1);
+    if (program->name == NULL) {
+        perror(MEMORY_ALLOCATION_ERROR);
+        exit(EXIT_FAILURE);
+    }
+
+    strcpy(program->name, name);
+    program->source = source;
+    program->sourceLength = sourceLength;
+    programs->count++;
+}
+
+/**
+ * Free Programs
+ *
+ * @param programs - The list of programs to free, with the sources that were not assembled.
+ */
+static void freePrograms(ProgramList *programs) {
+    int i;
+
+    for (i = 0; i < programs->count; i++) {
+        free(programs->programs[i].name);
+        free(programs->programs[i].source);
+    }
+    free(programs->programs);
+}
+
+/**
+ * Is Valid Program Name
+ *
+ * compile() builds the file names in buffers of MAX_LINE_LENGTH, a longer name would overflow them.
+ *
+ * @param name - The name of the program.
+ * @return True if compile() can take the name, False otherwise.
+ */
+static bool isValidProgramName(const char *name) {
+    size_t length = strlen(name);
+
+    return length > 0 && length + strlen(".as") < MAX_LINE_LENGTH;
+}
+
+/**
+ * Receive Source
+ *
+ * Reads the source bytes that follow a "source" line into memory.
+ *
+ * @param request - The request stream, positioned after the "source" line.
+ * @param length - The number of source bytes.
+ * @return The source, with room for a terminator after it, NULL if it was not received whole or does not fit in memory.
+ */
+static char *receiveSource(FILE *request, long length) {
+    char *source;
+
+    /* A client cannot make the daemon exit by announcing more than it could ever hold */
+    if (length >= INT_MAX) {
+        return NULL;
+    }
+
+    source = malloc(length + 1);
+    if (source == NULL) {
+        return NULL;
+    }
+
+    if (fread(source, 1, length, request) != (size_t)length) {
+        free(source);
+        return NULL;
+    }
+
+    return source;
+}
+
+/**
+ * Read Request
+ *
+ * Reads a whole request before anything is assembled, so a client still sending sources never blocks
+ * a daemon writing diagnostics. Opens the directory of the request, the working directory of the daemon
+ * is never changed since other requests are served at the same time.
+ *
+ * @param request - The request stream.
+ * @param programs - Receives the programs to assemble.
+ * @param options - Receives the options sent with the request, the defaults for the variables it does not send.
+ * @param directory - Receives a descriptor of the directory of the request, -1 until it is opened. Closed by the caller.
+ * @return True if the request is valid, False otherwise.
+ */
+static bool readRequest(FILE *request, ProgramList *programs, CompileOptions *options, int *directory) {
+    char line[MAX_REQUEST_LINE_LENGTH];
+    char *separator;
+    char *end;
+    char *source;
+    long length;
+    size_t lineLength;
+    bool hasDirectory = False;
+
+    init_compile_options(options);
+
+    while (fgets(line, sizeof(line), request) != NULL) {
+
+        /* A line without its '\n' is too long, or the client stopped in the middle of it */
+        lineLength = strlen(line);
+        if (lineLength == 0 || line[lineLength - 1] != '\n') {
+            return False;
+        }
+        line[lineLength - 1] = '\0';
+
+        /* An empty line ends the request */
+        if (line[0] == '\0') {
+            return hasDirectory;
+        }
+
+        if (strncmp(line, REQUEST_DIRECTORY, strlen(REQUEST_DIRECTORY)) == 0) {
+            if (*directory >= 0) {
+                close(*directory);
+            }
+            *directory = open(line + strlen(REQUEST_DIRECTORY), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+            if (*directory < 0) {
+                return False;
+            }
+            hasDirectory = True;
+
+        } else if (hasDirectory == False) {
+            return False;
+
+        } else if (strncmp(line, REQUEST_ENVIRONMENT, strlen(REQUEST_ENVIRONMENT)) == 0) {
+            separator = strchr(line + strlen(REQUEST_ENVIRONMENT), '=');
+            if (separator == NULL) {
+                return False;
+            }
+            *separator = '\0';
+            set_compile_option(options, line + strlen(REQUEST_ENVIRONMENT), separator + 1);
+
+        } else if (strncmp(line, REQUEST_FILE, strlen(REQUEST_FILE)) == 0) {
+            if (!isValidProgramName(line + strlen(REQUEST_FILE))) {
+                return False;
+            }
+            addProgram(programs, line + strlen(REQUEST_FILE), NULL, 0);
+
+        } else if (strncmp(line, REQUEST_SOURCE, strlen(REQUEST_SOURCE)) == 0) {
+
+            /* The length follows the last space, the name may hold spaces of its own */
+            separator = strrchr(line, ' ');
+            length = strtol(separator + 1, &end, 10);
+            *separator = '\0';
+
+            if (separator < line + strlen(REQUEST_SOURCE) || *end != '\0' || end == separator + 1 || length < 0 ||
+                !isValidProgramName(line + strlen(REQUEST_SOURCE)) || (source = receiveSource(request, length)) == NULL) {
+                return False;
+            }
+            addProgram(programs, line + strlen(REQUEST_SOURCE), source, (int)length);
+
+        } else {
+            return False;
+        }
+    }
+
+    /* The client closed the connection before the empty line */
+    return False;
+}
+
+/**
+ * Send a Segment
+ *
+ * Sends a segment of what the assembler printed, tagged with its stream.
+ *
+ * @param stream - The stream the segment was printed to.
+ * @param text - The text of the segment.
+ * @param length - The length of the text.
+ * @param context - The connection (an int).
+ */
+static void sendSegment(ConsoleStream stream, const char *text, size_t length, void *context) {
+    int connection = *(int *)context;
+    char header[MAX_LINE_LENGTH];
+
+    sprintf(header, "%s%lu\n", stream == CONSOLE_ERROR ? RESPONSE_ERROR : RESPONSE_OUTPUT, (unsigned long)length);
+
+    /* A client that went away is noticed by the next accept(), nothing else to do here */
+    if (writeAll(connection, header, strlen(header))) {
+        writeAll(connection, text, length);
+    }
+}
+
+/**
+ * Serve Connection
+ *
+ * Assembles the programs of a single request with the options it sent, in its directory. Everything compile()
+ * prints is captured and then sent to the client, each segment tagged with the stream it was printed to.
+ *
+ * @param connection - The accepted connection.
+ * @param workspace - The workspace of the connection.
+ */
+static void serveConnection(int connection, Workspace *workspace) {
+    ProgramList programs = {NULL, 0, 0};
+    CompileOptions options;
+    int directory = -1;
+    const int *previousDirectory;
+    ThreadTokens tokens;
+    ThreadTokens *previousTokens;
+    int freeSlots;
+    ConsoleCapture capture;
+    ConsoleCapture *previousCapture;
+    char status[MAX_LINE_LENGTH];
+    struct timeval timeout;
+    int requestFd;
+    FILE *request;
+    int exitStatus = EXIT_SUCCESS;
+    int i;
+
+    /* A client that stops in the middle of its request must not keep a thread of the daemon forever */
+    timeout.tv_sec = DAEMON_RECEIVE_TIMEOUT;
+    timeout.tv_usec = 0;
+    setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    requestFd = dup(connection);
+    request = (requestFd < 0 ? NULL : fdopen(requestFd, "r"));
+
+    if (request == NULL) {
+        if (requestFd >= 0) {
+            close(requestFd);
+        }
+        return;
+    }
+
+    if (!readRequest(request, &programs, &options, &directory)) {
+        sendSegment(CONSOLE_ERROR, DAEMON_REQUEST_ERROR "\n", strlen(DAEMON_REQUEST_ERROR "\n"), &connection);
+        exitStatus = EXIT_FAILURE;
+
+    } else if (!open_console_capture(&capture)) {
+        sendSegment(CONSOLE_ERROR, MEMORY_ALLOCATION_ERROR "\n", strlen(MEMORY_ALLOCATION_ERROR "\n"), &connection);
+        exitStatus = EXIT_FAILURE;
+
+    } else {
+        previousCapture = set_console_capture(&capture);
+
+        /* The files of the request are compiled one after another, the threads that split them stay within its jobs */
+        workspace->options = options;
+        limit_thread_tokens(&options, &tokens, &freeSlots);
+        previousTokens = set_thread_tokens(&tokens);
+        previousDirectory = set_file_directory(&directory);
+
+        /* The same loop as main(), a source is handed over to compile_source() */
+        for (i = 0; i < programs.count; i++) {
+            if (programs.programs[i].source != NULL) {
+                compile_source(programs.programs[i].name, programs.programs[i].source, programs.programs[i].sourceLength, workspace);
+                programs.programs[i].source = NULL;
+            } else {
+                compile(programs.programs[i].name, workspace);
+            }
+        }
+
+        set_file_directory(previousDirectory);
+        set_thread_tokens(previousTokens);
+        set_console_capture(previousCapture);
+        drain_console_capture(&capture, sendSegment, &connection);
+    }
+
+    sprintf(status, RESPONSE_STATUS "%d\n", exitStatus);
+    writeAll(connection, status, strlen(status));
+
+    fclose(request);
+    freePrograms(&programs);
+
+    if (directory >= 0) {
+        close(directory);
+    }
+}
+
+/**
+ * Run a Connection
+ *
+ * The thread entry point, serves a connection with a workspace of the daemon and closes it.
+ *
+ * @param argument - The connection, freed.
+ * @return NULL.
+ */
+static void *runConnection(void *argument) {
+    Connection *connection = (Connection *)argument;
+    DaemonState *daemon = connection->daemon;
+    Workspace *workspace = NULL;
+
+    pthread_mutex_lock(&daemon->lock);
+    if (daemon->freeWorkspaces > 0) {
+        workspace = daemon->workspaces[--daemon->freeWorkspaces];
+    }
+    pthread_mutex_unlock(&daemon->lock);
+
+    if (workspace == NULL) {
+        workspace = create_workspace(NULL);
+    }
+
+    serveConnection(connection->fd, workspace);
+    close(connection->fd);
+    free(connection);
+
+    pthread_mutex_lock(&daemon->lock);
+    daemon->workspaces[daemon->freeWorkspaces++] = workspace;
+    daemon->connections--;
+    pthread_cond_signal(&daemon->connectionDone);
+    pthread_mutex_unlock(&daemon->lock);
+
+    return NULL;
+}
+
+/**
+ * Start a Connection
+ *
+ * Serves an accepted connection on a thread of its own, or on the calling thread when no thread can be started.
+ * Waits first while MAX_DAEMON_CONNECTIONS connections are served.
+ *
+ * @param daemon - The state of the daemon.
+ * @param fd - The accepted connection.
+ */
+static void startConnection(DaemonState *daemon, int fd) {
+    Connection *connection = malloc(sizeof(Connection));
+    sigset_t stopSignals;
+    sigset_t previousSignals;
+    pthread_t thread;
+    bool threaded;
+
+    if (connection == NULL) {
+        perror(MEMORY_ALLOCATION_ERROR);
+        close(fd);
+        return;
+    }
+
+    connection->fd = fd;
+    connection->daemon = daemon;
+
+    pthread_mutex_lock(&daemon->lock);
+    while (daemon->connections == MAX_DAEMON_CONNECTIONS) {
+        pthread_cond_wait(&daemon->connectionDone, &daemon->lock);
+    }
+    daemon->connections++;
+    pthread_mutex_unlock(&daemon->lock);
+
+    /* The signals stay with the thread in accept(), so they interrupt it */
+    sigemptyset(&stopSignals);
+    sigaddset(&stopSignals, SIGINT);
+    sigaddset(&stopSignals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &stopSignals, &previousSignals);
+    threaded = (pthread_create(&thread, NULL, runConnection, connection) == 0);
+    pthread_sigmask(SIG_SETMASK, &previousSignals, NULL);
+
+    if (threaded) {
+        pthread_detach(thread);
+    } else {
+        runConnection(connection);
+    }
+}
+
+/**
+ * Open Listener
+ *
+ * Binds the socket of the daemon. A socket left behind by a daemon that was killed is replaced,
+ * but a live daemon or a file that is not a socket is never touched.
+ *
+ * @param socketPath - The path of the socket.
+ * @return The listening socket, -1 on failure.
+ */
+static int openListener(const char *socketPath) {
+    struct sockaddr_un address;
+    struct stat status;
+    int listener;
+    int probe;
+
+    if (strlen(socketPath) >= sizeof(address.sun_path)) {
+        errno = ENAMETOOLONG;
+        return -1;
+    }
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, socketPath);
+
+    if (stat(socketPath, &status) == 0) {
+        if (!S_ISSOCK(status.st_mode)) {
+            errno = EEXIST;
+            return -1;
+        }
+
+        /* Only a socket nobody accepts on is stale */
+        probe = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (probe < 0) {
+            return -1;
+        }
+        if (connect(probe, (struct sockaddr *)&address, sizeof(address)) == 0) {
+            close(probe);
+            errno = EADDRINUSE;
+            return -1;
+        }
+        close(probe);
+        unlink(socketPath);
+    }
+
+    listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0) {
+        return -1;
+    }
+
+    if (bind(listener, (struct sockaddr *)&address, sizeof(address)) != 0 || listen(listener, SOMAXCONN) != 0) {
+        close(listener);
+        return -1;
+    }
+
+    return listener;
+}
+
+int run_daemon(const char *socketPath) {
+    struct sigaction stopAction;
+    DaemonState daemon;
+    int listener;
+    int connection;
+    int i;
+
+    listener = openListener(socketPath);
+    if (listener < 0) {
+        perror(DAEMON_SOCKET_ERROR);
+        return EXIT_FAILURE;
+    }
+
+    /* No SA_RESTART, so a signal interrupts accept() and the loop sees the stop request */
+    memset(&stopAction, 0, sizeof(stopAction));
+    stopAction.sa_handler = requestStop;
+    sigemptyset(&stopAction.sa_mask);
+    sigaction(SIGINT, &stopAction, NULL);
+    sigaction(SIGTERM, &stopAction, NULL);
+
+    /* A client that disconnects early must not kill the daemon */
+    signal(SIGPIPE, SIG_IGN);
+
+    /* The connections reuse the tables of the connections before them, each request sets its options */
+    pthread_mutex_init(&daemon.lock, NULL);
+    pthread_cond_init(&daemon.connectionDone, NULL);
+    daemon.connections = 0;
+    daemon.freeWorkspaces = 0;
+
+    printf("Assembler daemon listening on %s\n", socketPath);
+    fflush(stdout);
+
+    while (!stopRequested) {
+        connection = accept(listener, NULL, NULL);
+        if (connection < 0) {
+            if (errno != EINTR) {
+                perror(DAEMON_SOCKET_ERROR);
+            }
+            continue;
+        }
+
+        startConnection(&daemon, connection);
+    }
+
+    /* The requests being served are finished, their clients get their whole responses */
+    pthread_mutex_lock(&daemon.lock);
+    while (daemon.connections > 0) {
+        pthread_cond_wait(&daemon.connectionDone, &daemon.lock);
+    }
+    pthread_mutex_unlock(&daemon.lock);
+
+    for (i = 0; i < daemon.freeWorkspaces; i++) {
+        free_workspace(daemon.workspaces[i]);
+    }
+
+    pthread_cond_destroy(&daemon.connectionDone);
+    pthread_mutex_destroy(&daemon.lock);
+    close(listener);
+    unlink(socketPath);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,80 @@
+#ifndef _DAEMON_H
+#define _DAEMON_H
+
+#include <stddef.h>
+
+/* Expects global_definitions.h to be included first */
+
+/* ------------------------------------ Static Definitions ------------------------------------ */
+
+/* The environment variable holding the socket of the daemon. When it is not set, every user has a socket of their own:
+ * DAEMON_SOCKET_NAME in $XDG_RUNTIME_DIR, or FALLBACK_DAEMON_SOCKET (with the user id) when there is no such directory */
+#define DAEMON_SOCKET_VARIABLE "ASSEMBLER_SOCKET"
+#define RUNTIME_DIRECTORY_VARIABLE "XDG_RUNTIME_DIR"
+#define DAEMON_SOCKET_NAME "assembler.socket"
+#define FALLBACK_DAEMON_SOCKET "/tmp/assembler-%lu.socket"
+
+/* "./assembler --daemon" serves on the socket above, "./assembler --daemon=<socket>" on the given one */
+#define DAEMON_OPTION "--daemon"
+
+/* The environment variables assembler_client sends with its requests, the options of the compilation
+ * (AIR_VARIABLE and JOBS_VARIABLE). The daemon never takes them from its own environment */
+#define FORWARDED_VARIABLES {"ASSEMBLER_AIR", "ASSEMBLER_JOBS"}
+#define FORWARDED_VARIABLE_COUNT 2
+
+/* The longest line of a request (a directory or a program name with its keyword) */
+#define MAX_REQUEST_LINE_LENGTH 4096
+
+/* The seconds the daemon waits for the next bytes of a request, a client that stops sending is dropped so its thread is freed */
+#define DAEMON_RECEIVE_TIMEOUT 10
+
+/* The requests served at the same time, each on a thread of its own. The next clients wait until one is done */
+#ifndef MAX_DAEMON_CONNECTIONS
+#define MAX_DAEMON_CONNECTIONS 16
+#endif
+
+/* The protocol, a request is a few text lines ended by an empty line:
+ *
+ *     cwd <directory>                 The directory the programs are relative to, must come first
+ *     env <name>=<value>              An environment variable of the client, the options of the programs are taken
+ *                                     from them as "./assembler" takes them from its environment (other names are ignored)
+ *     file <program>                  Assembles <program>.as, as "./assembler <program>" would
+ *     source <program> <length>       Followed by <length> bytes of source, assembled in memory as <program>.as would be
+ *                                     (<program>.as and <program>.am are neither read nor written)
+ *
+ * The response is everything the assembler printed, in the order it was printed, then the status:
+ *
+ *     output <length>                 Followed by <length> bytes the assembler printed to stdout
+ *     error <length>                  Followed by <length> bytes the assembler printed to stderr
+ *     status <n>                      The exit status of the equivalent command line, or EXIT_FAILURE for a malformed request */
+#define REQUEST_DIRECTORY "cwd "
+#define REQUEST_ENVIRONMENT "env "
+#define REQUEST_FILE "file "
+#define REQUEST_SOURCE "source "
+#define RESPONSE_OUTPUT "output "
+#define RESPONSE_ERROR "error "
+#define RESPONSE_STATUS "status "
+
+#define DAEMON_SOCKET_ERROR "Error while opening the assembler daemon socket."
+#define DAEMON_REQUEST_ERROR "Invalid assembler daemon request."
+
+
+/* ------------------------------------ Functions ------------------------------------ */
+
+/** daemon_socket_path
+ *  @brief Finds the socket of the daemon, see DAEMON_SOCKET_VARIABLE.
+ *  @param path Receives the path of the socket.
+ *  @param size The size of path.
+ *  @return True if the path fits in path, False otherwise.
+ */
+bool daemon_socket_path(char *path, size_t size);
+
+/** run_daemon
+ *  @brief Serves assemble requests on a Unix domain socket until SIGINT or SIGTERM. Every connection is served on
+ *         a thread of its own, with the files of the request relative to its directory (see set_file_directory).
+ *  @param socketPath The path of the socket, a stale socket at this path is replaced.
+ *  @return EXIT_SUCCESS once stopped by a signal, EXIT_FAILURE if the socket could not be opened.
+ */
+int run_daemon(const char *socketPath);
+
+#endif
@@ -0,0 +1,37 @@
+/* Needed for getuid() when compiling with -ansi */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+
+#include "global_definitions.h"
+#include "daemon.h"
+
+bool daemon_socket_path(char *path, size_t size) {
+    const char *socketPath = getenv(DAEMON_SOCKET_VARIABLE);
+    const char *runtimeDirectory = getenv(RUNTIME_DIRECTORY_VARIABLE);
+    char fallback[MAX_LINE_LENGTH];
+
+    if (socketPath == NULL) {
+
+        /* Every user has a socket of their own, so nobody else can serve (or see) their requests */
+        if (runtimeDirectory != NULL && runtimeDirectory[0] != '\0' &&
+            strlen(runtimeDirectory) + strlen("/" DAEMON_SOCKET_NAME) < sizeof(fallback)) {
+            sprintf(fallback, "%s/%s", runtimeDirectory, DAEMON_SOCKET_NAME);
+        } else {
+            sprintf(fallback, FALLBACK_DAEMON_SOCKET, (unsigned long)getuid());
+        }
+        socketPath = fallback;
+    }
+
+    if (strlen(socketPath) >= size) {
+        return False;
+    }
+
+    strcpy(path, socketPath);
+
+    return True;
+}
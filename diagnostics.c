@@ -0,0 +1,257 @@
+/* Needed for the thread specific data and open_memstream() when compiling with -ansi */
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include "global_definitions.h"
+#include "assembler_api.h"
+#include "diagnostics.h"
+
+/* Every thread has its own sink, so threads assembling at the same time never share one */
+static pthread_key_t sinkKey;
+static pthread_key_t captureKey;
+static pthread_once_t sinkKeyOnce = PTHREAD_ONCE_INIT;
+
+/**
+ * Create the Sink Key
+ *
+ * Creates the keys of both the sink and the console capture.
+ */
+static void createSinkKey(void) {
+    pthread_key_create(&sinkKey, NULL);
+    pthread_key_create(&captureKey, NULL);
+}
+
+/**
+ * Current Sink
+ *
+ * @return The sink of the calling thread, NULL when its errors go to the console.
+ */
+static DiagnosticSink *currentSink(void) {
+    pthread_once(&sinkKeyOnce, createSinkKey);
+    return (DiagnosticSink *)pthread_getspecific(sinkKey);
+}
+
+/**
+ * Current Capture
+ *
+ * @return The console capture of the calling thread, NULL when it prints to stdout and stderr.
+ */
+static ConsoleCapture *currentCapture(void) {
+    pthread_once(&sinkKeyOnce, createSinkKey);
+    return (ConsoleCapture *)pthread_getspecific(captureKey);
+}
+
+/**
+ * Copy a Text Without its Newline
+ *
+ * @param text - The text, NULL is copied as an empty text.
+ * @return An allocated copy of the text without its trailing newline.
+ */
+static char *copyWithoutNewline(const char *text) {
+    size_t length = (text == NULL ? 0 : strlen(text));
+    char *copy;
+
+    while (length > 0 && text[length - 1] == '\n') {
+        length--;
+    }
+
+    copy = malloc(length + 1);
+    if (copy == NULL) {
+        memory_allocation_failed();
+    }
+
+    if (length > 0) {
+        memcpy(copy, text, length);
+    }
+    copy[length] = '\0';
+
+    return copy;
+}
+
+DiagnosticSink *set_diagnostic_sink(DiagnosticSink *sink) {
+    DiagnosticSink *previous = currentSink();
+
+    pthread_setspecific(sinkKey, sink);
+
+    return previous;
+}
+
+DiagnosticSink *current_diagnostic_sink(void) {
+    return currentSink();
+}
+
+bool collect_diagnostic(const char *message, const char *line, int lineNumber) {
+    DiagnosticSink *sink = currentSink();
+    AssemblerDiagnostic *diagnostics;
+    AssemblerDiagnostic *diagnostic;
+
+    if (sink == NULL) {
+        return False;
+    }
+
+    /* The array is replaced only once the larger one exists, a failed allocation leaves the sink intact */
+    if (sink->count == sink->capacity) {
+        diagnostics = realloc(sink->diagnostics, (sink->capacity == 0 ? 16 : sink->capacity * 2) * sizeof(AssemblerDiagnostic));
+        if (diagnostics == NULL) {
+            memory_allocation_failed();
+        }
+        sink->diagnostics = diagnostics;
+        sink->capacity = (sink->capacity == 0 ? 16 : sink->capacity * 2);
+    }
+
+    diagnostic = &sink->diagnostics[sink->count];
+    diagnostic->lineNumber = lineNumber;
+    diagnostic->message = copyWithoutNewline(message);
+    diagnostic->line = NULL;
+    sink->count++;
+
+    diagnostic->line = copyWithoutNewline(line);
+
+    return True;
+}
+
+void memory_allocation_failed(void) {
+    DiagnosticSink *sink = currentSink();
+
+    if (sink != NULL && sink->outOfMemory != NULL) {
+        longjmp(*sink->outOfMemory, 1);
+    }
+
+    perror(MEMORY_ALLOCATION_ERROR);
+    exit(EXIT_FAILURE);
+}
+
+bool open_console_capture(ConsoleCapture *capture) {
+
+    capture->buffer = NULL;
+    capture->size = 0;
+    capture->segmentStarts = NULL;
+    capture->segmentStreams = NULL;
+    capture->segments = 0;
+    capture->capacity = 0;
+    capture->text = open_memstream(&capture->buffer, &capture->size);
+
+    return capture->text != NULL;
+}
+
+ConsoleCapture *set_console_capture(ConsoleCapture *capture) {
+    ConsoleCapture *previous = currentCapture();
+
+    pthread_setspecific(captureKey, capture);
+
+    return previous;
+}
+
+/**
+ * Start a Segment
+ *
+ * Starts a new segment of a capture whenever the stream changes.
+ *
+ * @param capture - The capture.
+ * @param stream - The stream of the text that follows.
+ */
+static void startSegment(ConsoleCapture *capture, ConsoleStream stream) {
+
+    if (capture->segments > 0 && capture->segmentStreams[capture->segments - 1] == stream) {
+        return;
+    }
+
+    if (capture->segments == capture->capacity) {
+        capture->capacity = (capture->capacity == 0 ? 8 : capture->capacity * 2);
+        capture->segmentStarts = realloc(capture->segmentStarts, capture->capacity * sizeof(long));
+        capture->segmentStreams = realloc(capture->segmentStreams, capture->capacity * sizeof(ConsoleStream));
+
+        if (capture->segmentStarts == NULL || capture->segmentStreams == NULL) {
+            memory_allocation_failed();
+        }
+    }
+
+    capture->segmentStarts[capture->segments] = ftell(capture->text);
+    capture->segmentStreams[capture->segments] = stream;
+    capture->segments++;
+}
+
+/**
+ * Write a Segment to the Console
+ *
+ * @param stream - The stream of the segment.
+ * @param text - The text of the segment.
+ * @param length - The length of the text.
+ * @param context - Unused.
+ */
+static void writeConsoleSegment(ConsoleStream stream, const char *text, size_t length, void *context) {
+    (void)context;
+
+    fwrite(text, 1, length, stream == CONSOLE_ERROR ? stderr : stdout);
+
+    /* stderr is unbuffered, stdout is flushed before it so the streams keep their order on a terminal */
+    if (stream == CONSOLE_OUTPUT) {
+        fflush(stdout);
+    }
+}
+
+/**
+ * Write a Segment to a Capture
+ *
+ * @param stream - The stream of the segment.
+ * @param text - The text of the segment.
+ * @param length - The length of the text.
+ * @param context - The capture.
+ */
+static void writeCapturedSegment(ConsoleStream stream, const char *text, size_t length, void *context) {
+    ConsoleCapture *capture = (ConsoleCapture *)context;
+
+    startSegment(capture, stream);
+    fwrite(text, 1, length, capture->text);
+}
+
+void replay_console_capture(ConsoleCapture *capture) {
+    ConsoleCapture *enclosing = currentCapture();
+
+    /* A thread that is captured itself keeps the messages in its own capture, at the place they are replayed */
+    if (enclosing != NULL) {
+        drain_console_capture(capture, writeCapturedSegment, enclosing);
+    } else {
+        drain_console_capture(capture, writeConsoleSegment, NULL);
+    }
+}
+
+void drain_console_capture(ConsoleCapture *capture, ConsoleSegmentWriter writer, void *context) {
+    long end;
+    int i;
+
+    fclose(capture->text);
+
+    for (i = 0; i < capture->segments; i++) {
+        end = (i + 1 < capture->segments ? capture->segmentStarts[i + 1] : (long)capture->size);
+        writer(capture->segmentStreams[i], capture->buffer + capture->segmentStarts[i], end - capture->segmentStarts[i], context);
+    }
+
+    free(capture->buffer);
+    free(capture->segmentStarts);
+    free(capture->segmentStreams);
+}
+
+void console_printf(ConsoleStream stream, const char *format, ...) {
+    ConsoleCapture *capture = currentCapture();
+    va_list arguments;
+
+    if (capture != NULL) {
+        startSegment(capture, stream);
+    }
+
+    va_start(arguments, format);
+    vfprintf(capture != NULL ? capture->text : (stream == CONSOLE_ERROR ? stderr : stdout), format, arguments);
+    va_end(arguments);
+}
+
+void console_perror(const char *message) {
+    console_printf(CONSOLE_ERROR, "%s: %s\n", message, strerror(errno));
+}
@@ -0,0 +1,119 @@
+#ifndef _DIAGNOSTICS_H
+#define _DIAGNOSTICS_H
+
+#include <setjmp.h>
+#include <stdio.h>
+
+/* Expects global_definitions.h to be included first */
+
+/* ------------------------------------ Data Types ------------------------------------ */
+
+/* Defines where the errors of the current thread go instead of the console */
+typedef struct DiagnosticSink
+{
+    struct AssemblerDiagnostic *diagnostics;        /* See assembler_api.h */
+    int count;
+    int capacity;
+    jmp_buf *outOfMemory;       /* Jumped to when an allocation fails, NULL to exit the process instead */
+
+} DiagnosticSink;
+
+/* The streams of the console */
+typedef enum ConsoleStream
+{
+    CONSOLE_OUTPUT = 0,         /* stdout */
+    CONSOLE_ERROR = 1           /* stderr */
+
+} ConsoleStream;
+
+/* Defines where the console output of the current thread goes instead of stdout and stderr, so the messages of files
+ * assembled on parallel threads can be printed afterwards in the order the files were given */
+typedef struct ConsoleCapture
+{
+    FILE *text;                 /* Everything printed, in a memory stream */
+    char *buffer;               /* The contents of the memory stream */
+    size_t size;
+    long *segmentStarts;        /* The text is split into segments of the same stream, in the order they were printed */
+    ConsoleStream *segmentStreams;
+    int segments;
+    int capacity;
+
+} ConsoleCapture;
+
+/* Receives a segment of a capture, the text is not null terminated */
+typedef void (*ConsoleSegmentWriter)(ConsoleStream stream, const char *text, size_t length, void *context);
+
+
+/* ------------------------------------ Functions ------------------------------------ */
+
+/** set_diagnostic_sink
+ *  @brief Sends the errors of the calling thread to a sink, or back to the console.
+ *  @param sink The sink, NULL for the console.
+ *  @return The previous sink of the thread, to be restored when done.
+ */
+DiagnosticSink *set_diagnostic_sink(DiagnosticSink *sink);
+
+/** current_diagnostic_sink
+ *  @brief Returns the sink of the calling thread.
+ *  @return The sink, NULL when the errors of the thread go to the console.
+ */
+DiagnosticSink *current_diagnostic_sink(void);
+
+/** collect_diagnostic
+ *  @brief Adds an error to the sink of the calling thread, if it has one.
+ *  @param message The error message, its trailing newline is dropped.
+ *  @param line The line of the error, its trailing newline is dropped.
+ *  @param lineNumber The number of the line.
+ *  @return True if the error was collected, False if it should be printed.
+ */
+bool collect_diagnostic(const char *message, const char *line, int lineNumber);
+
+/** memory_allocation_failed
+ *  @brief Handles a failed allocation: jumps out of assemble_buffer() when the calling thread is inside one,
+ *         prints the error and exits the process otherwise. Never returns.
+ */
+void memory_allocation_failed(void);
+
+/** open_console_capture
+ *  @brief Prepares an empty capture.
+ *  @param capture The capture.
+ *  @return True if the capture is ready, False if its memory stream could not be opened.
+ */
+bool open_console_capture(ConsoleCapture *capture);
+
+/** set_console_capture
+ *  @brief Sends the console output of the calling thread to a capture, or back to stdout and stderr.
+ *  @param capture The capture, NULL for stdout and stderr.
+ *  @return The previous capture of the thread, to be restored when done.
+ */
+ConsoleCapture *set_console_capture(ConsoleCapture *capture);
+
+/** replay_console_capture
+ *  @brief Prints everything a capture holds to stdout and stderr, in the order it was printed, and frees the capture.
+ *         A calling thread that has a capture of its own receives the text in its capture instead.
+ *  @param capture The capture.
+ */
+void replay_console_capture(ConsoleCapture *capture);
+
+/** drain_console_capture
+ *  @brief Hands every segment of a capture to a writer, in the order it was printed, and frees the capture.
+ *  @param capture The capture.
+ *  @param writer Called once per segment.
+ *  @param context Passed to the writer.
+ */
+void drain_console_capture(ConsoleCapture *capture, ConsoleSegmentWriter writer, void *context);
+
+/** console_printf
+ *  @brief Prints to stdout or stderr, or to the capture of the calling thread if it has one.
+ *  @param stream The stream.
+ *  @param format The format, as for printf().
+ */
+void console_printf(ConsoleStream stream, const char *format, ...);
+
+/** console_perror
+ *  @brief Prints a message followed by the description of errno to stderr, as perror() does, through console_printf().
+ *  @param message The message.
+ */
+void console_perror(const char *message);
+
+#endif
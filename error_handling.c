@@ -6,7 +6,16 @@
 #include "global_definitions.h"
 #include "utility_functions.h"
 #include "identification.h"
+#include "instruction_set.h"
+#include "keywords.h"
+#include "line_scanner.h"
 #include "error_handling.h"
+#include "diagnostics.h"
+#include "include_file.h"
+#include "token_file.h"
+
+#define DATA_VALUE_ERROR "Invalid data definition - One of the numbers is not a valid integer or a defined variable\n"
+#define DATA_RANGE_ERROR "Invalid data definition - One of the numbers does not fit in 14 bits\n"
 
 /** check_errors - Check for syntax errors in the input assembly file.
  * @param commandType - The type of the command to be checked.
@@ -16,9 +25,11 @@
  * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
  * @param directiveOrder - The order of the directive in the file.
  * @param entriesExternsHash - The hash table to store the entries and externs.
+ * @param lines - The classified lines, keeps the files the include lines map and the data segment.
+ * @param lineIndex - The index of the line in the classified lines.
  * @param foundError - A flag to indicate if an error was found.
  */
-void check_errors(CommandType commandType, char *line, int lineNumber, char * fileName, HashTable *symbolsLabelsValuesHash, int * directiveOrder, HashTable *entriesExternsHash, bool * foundError) {
+void check_errors(CommandType commandType, char *line, int lineNumber, char * fileName, HashTable *symbolsLabelsValuesHash, int * directiveOrder, HashTable *entriesExternsHash, LineTable *lines, int lineIndex, bool * foundError) {
     
     switch (commandType) {
         case EMPTY:
@@ -26,10 +37,13 @@ void check_errors(CommandType commandType, char *line, int lineNumber, char * fi
         case COMMENT:
             break;
         case DATA_DIRECTIVE:
-            check_data_directive_error(line, lineNumber, fileName, symbolsLabelsValuesHash, directiveOrder, foundError);
+            check_data_directive_error(line, lineNumber, fileName, symbolsLabelsValuesHash, directiveOrder, lines, &lines->records[lineIndex], &lines->wordCounts[lineIndex], foundError);
             break;
         case STRING_DIRECTIVE:
-            check_string_directive_error(line, lineNumber, fileName, symbolsLabelsValuesHash, directiveOrder, foundError);
+            check_string_directive_error(line, lineNumber, fileName, symbolsLabelsValuesHash, directiveOrder, lines, &lines->records[lineIndex], &lines->wordCounts[lineIndex], foundError);
+            break;
+        case INCLUDE_DIRECTIVE:
+            check_include_directive_error(line, lineNumber, fileName, symbolsLabelsValuesHash, directiveOrder, lines, &lines->records[lineIndex], &lines->wordCounts[lineIndex], foundError);
             break;
         case ENTRY_DIRECTIVE:
             break;
@@ -65,11 +79,11 @@ void check_entries_externs_errors(CommandType commandType, char *line, int lineN
     }
 }
 
-void check_instruction_errors(CommandType commandType, char *line, int lineNumber, char * fileName, HashTable *entriesExternsHash, HashTable *symbolsLabelsValuesHash, bool * foundError){
+void check_instruction_errors(CommandType commandType, char *line, int lineNumber, char * fileName, HashTable *entriesExternsHash, HashTable *symbolsLabelsValuesHash, LineTable *lines, int lineIndex, bool * foundError){
     
         switch (commandType) {
             case INSTRUCTION:
-                check_instruction_error(line, lineNumber, fileName, entriesExternsHash, symbolsLabelsValuesHash, foundError);
+                check_instruction_error(line, lineNumber, fileName, entriesExternsHash, symbolsLabelsValuesHash, lines, &lines->records[lineIndex], foundError);
                 break;
             case UNDEFINED:
                 *foundError = True;
@@ -88,58 +102,36 @@ void check_instruction_errors(CommandType commandType, char *line, int lineNumbe
  */
 void print_error(char *error, const char *line, int lineNumber, char *fileName) {
 
+    /* Inside assemble_buffer() the errors are collected instead of printed */
+    if (collect_diagnostic(error, line, lineNumber)) {
+        return;
+    }
+
     /* Red color*/
-    fprintf(stderr, "\033[1;31m"); 
-    fprintf(stderr, "ERROR: ");
+    console_printf(CONSOLE_ERROR, "\033[1;31m"); 
+    console_printf(CONSOLE_ERROR, "ERROR: ");
 
     /* Reset the color*/
-    fprintf(stderr, "\033[0m"); 
-    fprintf(stderr, "%s", error);
+    console_printf(CONSOLE_ERROR, "\033[0m"); 
+    console_printf(CONSOLE_ERROR, "%s", error);
 
     /* Yellow color*/
-    fprintf(stderr, "\033[0;33m");
-    fprintf(stderr, "In File: ");
+    console_printf(CONSOLE_ERROR, "\033[0;33m");
+    console_printf(CONSOLE_ERROR, "In File: ");
 
     /* Reset the color*/
-    fprintf(stderr, "\033[0m"); 
-    fprintf(stderr, "%s", fileName);
+    console_printf(CONSOLE_ERROR, "\033[0m"); 
+    console_printf(CONSOLE_ERROR, "%s", fileName);
 
     /* Purple */
-    fprintf(stderr, "\033[1;35m");
-    fprintf(stderr, "\nOn Line %d: ", lineNumber);
+    console_printf(CONSOLE_ERROR, "\033[1;35m");
+    console_printf(CONSOLE_ERROR, "\nOn Line %d: ", lineNumber);
 
     /* Reset the color*/
-    fprintf(stderr, "\033[0m"); 
-    fprintf(stderr, "%s\n\n", line);
-
-
-}
+    console_printf(CONSOLE_ERROR, "\033[0m"); 
+    console_printf(CONSOLE_ERROR, "%s\n\n", line);
 
 
-/**
- * hasSomethingAfterSection - Check if a string contains additional characters after a section.
- * @param input - The input string to be checked.
- * @param section - The section to be checked for additional characters.
- * @return 1 if the string contains additional characters after the section, 0 otherwise.
- */
-
-bool hasSomethingAfterSection(const char *input, const char *section) {
-    /* Find the position of the section in the string */
-    const char *sectionPos = strstr(input, section);
-
-    if (sectionPos != NULL) {
-        /* Calculate the length of the substring after the section */
-        size_t sectionLength = strlen(section);
-        size_t remainingLength = strlen(sectionPos + sectionLength);
-
-        /* Check if there are additional characters after the section */
-        if(remainingLength > 0) {
-            return True;
-        }
-    }
-
-    /* Section not found in the string */
-    return False;
 }
 
 
@@ -238,74 +230,216 @@ bool checkLabelLength(const char* label) {
  */
 bool checkLabelName(const char* label) {
 
-    /* Compare the label with each reserved word / instruction */
-    if (strcmp(label, "mov")   == 0 || strcmp(label, "cmp")    == 0 || strcmp(label, "add")    == 0 ||
-        strcmp(label, "sub")   == 0 || strcmp(label, "lea")    == 0 || strcmp(label, "not")    == 0 ||
-        strcmp(label, "clr")   == 0 || strcmp(label, "inc")    == 0 || strcmp(label, "dec")    == 0 ||
-        strcmp(label, "jmp")   == 0 || strcmp(label, "bne")    == 0 || strcmp(label, "red")    == 0 ||
-        strcmp(label, "prn")   == 0 || strcmp(label, "jsr")    == 0 || strcmp(label, "rts")    == 0 ||
-        strcmp(label, "hlt")   == 0 || strcmp(label, "data")   == 0 || strcmp(label, "string") == 0 ||
-        strcmp(label, "entry") == 0 || strcmp(label, "extern") == 0 || strcmp(label, "define") == 0 ||
-        strcmp(label, "r0")    == 0 || strcmp(label, "r1")     == 0 || strcmp(label, "r2")     == 0 ||
-        strcmp(label, "r3")    == 0 || strcmp(label, "r4")     == 0 || strcmp(label, "r5")     == 0 ||
-        strcmp(label, "r6")    == 0 || strcmp(label, "r7")     == 0) {
+    /* A single comparison against the only reserved word / instruction of the label's length and first characters */
+    return find_keyword(label, strlen(label)).kind == NOT_A_KEYWORD ? True : False;
+}
+
+/**
+ * Check a Directive Label
+ *
+ * @param labelName - The label of a data, string or include directive.
+ * @param line - The line, for the error messages.
+ * @param lineNumber - The line number where the error occurred.
+ * @param fileName - The name of the file where the error occurred.
+ * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
+ * @return True if the label is valid, False otherwise (the error is reported).
+ */
+static bool checkDirectiveLabel(char *labelName, const char *line, int lineNumber, char *fileName, HashTable *symbolsLabelsValuesHash) {
+
+    if(ht_search(symbolsLabelsValuesHash, labelName) != NULL){
+        print_error("Directive is already defined\n", line, lineNumber, fileName);
+        return False;
+    }
+
+    if(checkLabelLength(labelName) == False){
+        print_error("Label name is too long\n", line, lineNumber, fileName);
+        return False;
+    }
+
+    if(checkLabelName(labelName) == False){
+        print_error("Label name is a reserved word\n", line, lineNumber, fileName);
+        return False;
+    }
+
+    return True;
+}
+
+/**
+ * Add a Directive Label
+ *
+ * @param labelName - The label of a data, string or include directive.
+ * @param type - "dataDirective" or "stringDirective".
+ * @param memorySize - The number of words of the directive (the characters of a string, without the null terminator).
+ * @param directiveOrder - The order of the directive in the file.
+ * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
+ */
+static void addDirectiveLabel(char *labelName, char *type, int memorySize, int *directiveOrder, HashTable *symbolsLabelsValuesHash) {
+
+    char *directiveOrderString = intToString(*directiveOrder);
+    char *memorySizeString = intToString(memorySize);
 
-            return False; /* Label is a reserved word / instruction */
+    ht_insert(symbolsLabelsValuesHash, labelName, "NULL", type, "0", memorySizeString, directiveOrderString);
+    (*directiveOrder)++;
 
-    } else {
+    free(directiveOrderString);
+    free(memorySizeString);
+}
+
+/**
+ * Keep the Values of a Data Directive
+ *
+ * The values were written at the end of the data segment, only a labelled directive keeps them.
+ *
+ * @param labelName - The label of the directive, empty when there is none.
+ * @param count - The number of values.
+ * @param directiveOrder - The order of the directive in the file.
+ * @param lines - The classified lines.
+ * @param record - The record of the line, receives the offset of its values.
+ * @param wordCount - Receives the number of values.
+ * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
+ */
+static void keepDataValues(char *labelName, int count, int *directiveOrder, LineTable *lines, LineRecord *record, int *wordCount, HashTable *symbolsLabelsValuesHash) {
 
-            return True; /* Label is valid */
+    if(labelName[0] == '\0'){
+        return;
     }
+
+    record->dataOffset = lines->data.length;
+    *wordCount = count;
+    lines->data.length += count;
+
+    addDirectiveLabel(labelName, "dataDirective", count, directiveOrder, symbolsLabelsValuesHash);
 }
 
+/**
+ * Keep the Characters of a String Directive
+ *
+ * Only a labelled directive takes memory, its characters and the null terminator go straight to the data segment.
+ *
+ * @param characters - The characters of the string.
+ * @param length - The number of characters.
+ * @param labelName - The label of the directive, empty when there is none.
+ * @param directiveOrder - The order of the directive in the file.
+ * @param lines - The classified lines.
+ * @param record - The record of the line, receives the offset of its characters.
+ * @param wordCount - Receives the number of characters, with the null terminator.
+ * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
+ */
+static void keepString(const char *characters, int length, char *labelName, int *directiveOrder, LineTable *lines, LineRecord *record, int *wordCount, HashTable *symbolsLabelsValuesHash) {
 
-void check_constant_error(char *line, int lineNumber, char * fileName, HashTable *symbolsLabelsValuesHash, bool * foundError) {
+    int *words;
+    int i;
 
-    char **constantSplitedLine;                    /* Array to store the constat splited line */
-    int constantNumberOfElements = 0;              /* Reset the elemnts number - for the constat string spliter counter */
+    if(labelName[0] == '\0'){
+        return;
+    }
+
+    record->dataOffset = lines->data.length;
+    *wordCount = length + 1;
+
+    words = reserve_segment_words(&lines->data, *wordCount);
+    for (i = 0; i < length; i++) {
+        words[i] = (int)characters[i];
+    }
+    words[length] = 0;
+    lines->data.length += *wordCount;
+
+    addDirectiveLabel(labelName, "stringDirective", length, directiveOrder, symbolsLabelsValuesHash);
+}
+
+/**
+ * Include a File
+ *
+ * Maps the file an include directive names, and keeps the room of its words in the data segment.
+ *
+ * @param name - The name of the file, relative to the directory of the source.
+ * @param nameLength - The length of the name.
+ * @param line - The line, for the error messages.
+ * @param lineNumber - The line number where the error occurred.
+ * @param fileName - The name of the source.
+ * @param labelName - The label of the directive, empty when there is none.
+ * @param directiveOrder - The order of the directive in the file.
+ * @param lines - The classified lines, keep the file when it is valid.
+ * @param record - The record of the line, receives the index of the file and the offset of its words.
+ * @param wordCount - Receives the number of words in the file.
+ * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
+ * @param foundError - A flag to indicate if an error was found.
+ */
+static void includeFile(const char *name, int nameLength, const char *line, int lineNumber, char *fileName, char *labelName, int *directiveOrder, LineTable *lines, LineRecord *record, int *wordCount, HashTable *symbolsLabelsValuesHash, bool *foundError) {
 
-    /* copy line to side variable */
-    char* originalLine = malloc(strlen(line) + 1);
+    IncludedFile file;                     /* The included file, mapped */
+    const char * fileError = NULL;         /* Why the file cannot be included */
+    char path[MAX_LINE_LENGTH * 2];        /* The file name, relative to the working directory */
 
-    if (originalLine == NULL) {
-        perror(MEMORY_ALLOCATION_ERROR);
-        exit(EXIT_FAILURE);
+    if(include_path(fileName, name, nameLength, path, sizeof(path)) == False){
+        fileError = INCLUDE_PATH_ERROR;
     }
+    else {
+        fileError = map_included_file(path, &file);
+    }
+
+    if(fileError != NULL){
+        print_error((char *)fileError, line, lineNumber, fileName);
+        *foundError = True;
+        return;
+    }
+
+    /* The words are decoded by the code generation, at the place kept for them here */
+    record->include = keep_included_file(lines, &file);
+    *wordCount = file.wordCount;
+
+    if(labelName[0] != '\0'){
+        record->dataOffset = lines->data.length;
+        reserve_segment_words(&lines->data, file.wordCount);
+        lines->data.length += file.wordCount;
+
+        addDirectiveLabel(labelName, "dataDirective", file.wordCount, directiveOrder, symbolsLabelsValuesHash);
+    }
+}
+
+
+void check_constant_error(char *line, int lineNumber, char * fileName, HashTable *symbolsLabelsValuesHash, bool * foundError) {
+
+    char **constantSplitedLine;                    /* Array to store the constat splited line */
+    int constantNumberOfElements = 0;              /* Reset the elemnts number - for the constat string spliter counter */
+    LineParts parts;                               /* The label, the keyword and the operands of the line */
+    char definition[MAX_LINE_LENGTH * 2];          /* The definition without its whitespaces */
 
-    strcpy(originalLine, line);
+    splitLine(line, &parts);
 
-    if (hasSomethingAfterSection(line, ".define") == False) {
-        print_error(".define didn't get any definition (the part after the define is empty)\n", originalLine, lineNumber, fileName);
+    if (parts.operands.length == 0) {
+        print_error(".define didn't get any definition (the part after the define is empty)\n", line, lineNumber, fileName);
         *foundError = True;
         return;
     }
 
-    if (hasLabel(line)) {
-        print_error(".define instruction cannot have a lablel before it\n", originalLine, lineNumber, fileName);
+    if (parts.label.length > 0) {
+        print_error(".define instruction cannot have a lablel before it\n", line, lineNumber, fileName);
         *foundError = True;
         return;
     }
 
-    /* print line */
-    removeSubstring(line, ".define");
+    compactSpan(parts.operands, definition, sizeof(definition));
+    constantSplitedLine = splitString(definition, "=", &constantNumberOfElements);
 
-    removeWhiteSpaces(line);
-    constantSplitedLine = splitString(line, "=", &constantNumberOfElements);
     if(constantNumberOfElements != 2){
-        print_error("Invalid constant definition\n", originalLine, lineNumber, fileName);
+        print_error("Invalid constant definition\n", line, lineNumber, fileName);
         *foundError = True;
+        freeStringArray(constantSplitedLine, constantNumberOfElements);
         return;
     }
 
     if(ht_search(symbolsLabelsValuesHash, constantSplitedLine[0]) != NULL){
-        print_error("Constant is already defined\n", originalLine, lineNumber, fileName);
+        print_error("Constant is already defined\n", line, lineNumber, fileName);
         *foundError = True;
+        freeStringArray(constantSplitedLine, constantNumberOfElements);
         return;
     }
 
     if(isValidInteger(constantSplitedLine[1]) == False){
-        print_error("Invalid constant definition - number is not a valid integer\n", originalLine, lineNumber, fileName);
+        print_error("Invalid constant definition - number is not a valid integer\n", line, lineNumber, fileName);
         *foundError = True;
+        freeStringArray(constantSplitedLine, constantNumberOfElements);
         return;
     }
 
@@ -313,239 +447,192 @@ void check_constant_error(char *line, int lineNumber, char * fileName, HashTable
 
     /* Free the memory allocated for the splitedLines */
     freeStringArray(constantSplitedLine, constantNumberOfElements);
-    free(originalLine);
 
     return;
 }
 
-/**
- * check_data_directive_error - Check for syntax errors in the .data directive.
- * @param line - The input string to be checked.
- * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
- * @return True if the line is valid, False otherwise.
+/** namedDataValue - The value of a constant or a label among the values of a .data directive, a label stands for 0.
+ * @param name - The name of the constant or the label.
+ * @param number - Receives the value.
+ * @param symbolsLabelsValuesHash - The hash table containing the constants and the labels.
+ * @return NULL if the name is defined, the error message otherwise.
  */
+static const char *namedDataValue(char *name, long *number, HashTable *symbolsLabelsValuesHash) {
 
-void check_data_directive_error(char * line, int lineNumber, char * fileName,  HashTable *symbolsLabelsValuesHash, int * directiveOrder, bool * foundError){
-
-    char **splitedLine;                    /* Array to store the splited line */
-    int numberOfElements = 0;              /* Reset the elemnts number - for the string spliter counter */
-    int i = 0;                             /* Loop counter */
-    char * directiveOrderString = NULL;    /* String to store the directive order */
-    int memorySize;                        /* The size of the memory to be allocated */
-    char * memorySizeString = NULL;        /* String to store the memory size */
-
-    /* copy line to side variable */
-    char* originalLine = malloc(strlen(line) + 1);
-
-    char labelName[MAX_LABEL_LENGTH];
-    char value[MAX_LINE_LENGTH];
-    char variableValue[MAX_LINE_LENGTH] = "";
+    char *value = ht_search(symbolsLabelsValuesHash, name);
 
-    if (originalLine == NULL) {
-        perror(MEMORY_ALLOCATION_ERROR);
-        exit(EXIT_FAILURE);
+    if (value == NULL) {
+        return DATA_VALUE_ERROR;
     }
 
-    strcpy(originalLine, line);
+    *number = stringToInt(value);
+    return NULL;
+}
 
-    /* Skip leading whitespaces */
-    while (*line && (*line == ' ' || *line == '\t')) {
-        line++;
-    }
+/** parseDataValues - Check and convert the values of a .data directive, in a single pass over them.
+ * @param values - The values without their whitespaces, separated by single commas.
+ * @param words - Receives the values, room for one word every two characters.
+ * @param count - Receives the number of values.
+ * @param symbolsLabelsValuesHash - The hash table containing the constants and the labels.
+ * @return NULL if every value is valid, the error message otherwise.
+ */
+static const char *parseDataValues(char *values, int *words, int *count, HashTable *symbolsLabelsValuesHash) {
 
-    if (hasSomethingAfterSection(line, ".data") == False) {
-        print_error(".data directive didn't get any arguments\n", line, lineNumber, fileName);
-        *foundError = True;
-        return;
-    }
+    char *value = values;                  /* The value being parsed */
+    char *end;                             /* The character after its digits, or the comma after its name */
+    char *digit;
+    const char *valueError;                /* Why the name is not a value */
+    char separator;
+    long number;
 
-    /* print line */
-    removeSubstring(line, ".data");
+    *count = 0;
 
+    for (;;) {
+        digit = value + (*value == '+' || *value == '-');
+        end = (char *)skipDigits(digit);
 
-    if(hasLabel(line)){
+        /* A number, the magnitude is bounded as it grows so it never overflows */
+        if (*end == ',' || *end == '\0') {
+            for (number = 0; digit < end; digit++) {
+                number = number * 10 + (*digit - '0');
 
-        splitedLine = splitString(line, ":", &numberOfElements);
+                if (number > MAX_WORD_VALUE) {
+                    return DATA_RANGE_ERROR;
+                }
+            }
 
-        if(ht_search(symbolsLabelsValuesHash, splitedLine[0]) != NULL){
-            print_error("Directive is already defined\n", originalLine, lineNumber, fileName);
-            *foundError = True;
-            return;
+            if (*value == '-') {
+                number = -number;
+            }
         }
 
-        strcpy(labelName, splitedLine[0]);
+        /* A constant or a label, a label stands for 0 */
+        else {
+            end = strchr(end, ',');
+            if (end == NULL) {
+                end = value + strlen(value);
+            }
 
-        if(checkLabelLength(labelName) == False){
-            print_error("Label name is too long\n", originalLine, lineNumber, fileName);
-            *foundError = True;
-            return;
-        }
+            separator = *end;
+            *end = '\0';
+            valueError = namedDataValue(value, &number, symbolsLabelsValuesHash);
+            *end = separator;
 
-        if(checkLabelName(labelName) == False){
-            print_error("Label name is a reserved word\n", originalLine, lineNumber, fileName);
-            *foundError = True;
-            return;
+            if (valueError != NULL) {
+                return valueError;
+            }
         }
 
-        strcpy(value, splitedLine[1]);
-    }
-
-    numberOfElements = 0;
-
-    strcat(labelName, ":");
-    removeSubstring(line, labelName);
-    removeSubstring(labelName, ":");
-
-    removeWhiteSpaces(line);
-    if(checkCommas(line, originalLine, lineNumber, fileName) == False){
-        return;
-    }
-
-    splitedLine = splitString(line, ",", &numberOfElements);
-
-    for (i = 0; i < numberOfElements; i++) {
-
-        if(isValidInteger(splitedLine[i]) == False && ht_search(symbolsLabelsValuesHash, splitedLine[i]) == NULL){
-            print_error("Invalid data definition - One of the numbers is not a valid integer or a defined variable\n", originalLine, lineNumber, fileName);
-            *foundError = True;
-            return;
+        if (number < MIN_WORD_VALUE || number > MAX_WORD_VALUE) {
+            return DATA_RANGE_ERROR;
         }
 
-        else{
-            /* Add the string to value */
-            if(ht_search(symbolsLabelsValuesHash, splitedLine[i]) != NULL){
-                strcat(variableValue, ht_search(symbolsLabelsValuesHash, splitedLine[i]));
-                strcat(variableValue, ",");
-            }
-            else{
-                strcat(variableValue, splitedLine[i]);
-                strcat(variableValue, ",");
-            }
+        words[(*count)++] = (int)number;
 
+        if (*end == '\0') {
+            return NULL;
         }
 
+        value = end + 1;
     }
-    removeLastCharacter(variableValue);
-
-    
-    if(hasLabel(originalLine)){
-        directiveOrderString = intToString(*directiveOrder);
-        memorySize = numberOfElements;
-        memorySizeString = intToString(memorySize);
-        ht_insert(symbolsLabelsValuesHash, labelName, variableValue, "dataDirective", "0", memorySizeString, directiveOrderString);
-        (*directiveOrder)++;
-        free(directiveOrderString);
-        free(memorySizeString);
-    }
-    
-
-    freeStringArray(splitedLine, numberOfElements);
-    free(originalLine);
-
-    return;
-
-
 }
 
-
 /**
- * check_string_directive_error - Check for syntax errors in the .string directive.
+ * check_data_directive_error - Check for syntax errors in the .data directive, and write its values into the data segment.
  * @param line - The input string to be checked.
  * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
- * @return True if the line is valid, False otherwise.
+ * @param lines - The classified lines, receive the values in their data segment.
+ * @param record - The record of the line, receives the offset of its values.
+ * @param wordCount - Receives the number of values.
  */
 
-void check_string_directive_error(char * line, int lineNumber, char * fileName, HashTable *symbolsLabelsValuesHash, int * directiveOrder, bool * foundError){
-
-    char **splitedLine;                    /* Array to store the splited line */
-    int numberOfElements = 0;              /* Reset the elemnts number - for the string spliter counter */
-    char * directiveOrderString = NULL;    /* String to store the directive order */
-    int memorySize;                        /* The size of the memory to be allocated */
-    char * memorySizeString = NULL;        /* String to store the memory size */
+void check_data_directive_error(char * line, int lineNumber, char * fileName,  HashTable *symbolsLabelsValuesHash, int * directiveOrder, LineTable *lines, LineRecord *record, int * wordCount, bool * foundError){
 
+    int numberOfElements = 0;              /* The number of values */
+    const char * valueError = NULL;        /* Why one of the values is invalid */
+    LineParts parts;                       /* The label, the keyword and the operands of the line */
+    int * words;                           /* The room for the values at the end of the data segment */
 
-    /* copy line to side variable */
-    char* originalLine = malloc(strlen(line) + 1);
+    char labelName[MAX_LINE_LENGTH];
+    char values[MAX_LINE_LENGTH * 2];      /* The values without their whitespaces */
 
-    char labelName[MAX_LABEL_LENGTH];
-    char value[MAX_LINE_LENGTH];
+    splitLine(line, &parts);
 
-    if (originalLine == NULL) {
-        perror(MEMORY_ALLOCATION_ERROR);
-        exit(EXIT_FAILURE);
+    if (parts.operands.length == 0) {
+        print_error(".data directive didn't get any arguments\n", line, lineNumber, fileName);
+        *foundError = True;
+        return;
     }
 
-    strcpy(originalLine, line);
+    copySpan(parts.label, labelName, sizeof(labelName));
 
-    /* Skip leading whitespaces */
-    while (*line && (*line == ' ' || *line == '\t')) {
-        line++;
+    if(parts.label.length > 0 && checkDirectiveLabel(labelName, line, lineNumber, fileName, symbolsLabelsValuesHash) == False){
+        *foundError = True;
+        return;
     }
 
-    if (hasSomethingAfterSection(line, ".string") == False) {
-        print_error(".string directive didn't get any arguments\n", line, lineNumber, fileName);
+    compactSpan(parts.operands, values, sizeof(values));
+    if(checkCommas(values, line, lineNumber, fileName) == False){
         *foundError = True;
         return;
     }
 
-    /* print line */
-    removeSubstring(line, ".string");
+    /* The values go straight to the end of the data segment, the code generation does not read them again */
+    words = reserve_segment_words(&lines->data, (int)strlen(values) / 2 + 1);
+    valueError = parseDataValues(values, words, &numberOfElements, symbolsLabelsValuesHash);
+
+    if(valueError != NULL){
+        print_error((char *)valueError, line, lineNumber, fileName);
+        *foundError = True;
+        return;
+    }
 
+    keepDataValues(labelName, numberOfElements, directiveOrder, lines, record, wordCount, symbolsLabelsValuesHash);
 
-    if(hasLabel(line)){
+    return;
 
-        splitedLine = splitString(line, ":", &numberOfElements);
 
-        if(ht_search(symbolsLabelsValuesHash, splitedLine[0]) != NULL){
-            print_error("Directive is already defined\n", originalLine, lineNumber, fileName);
-            *foundError = True;
-            return;
-        }
+}
 
-        strcpy(labelName, splitedLine[0]);
 
-        if(checkLabelLength(labelName) == False){
-            print_error("Label name is too long\n", originalLine, lineNumber, fileName);
-            *foundError = True;
-            return;
-        }
+/**
+ * check_string_directive_error - Check for syntax errors in the .string directive, and write its characters into the data segment.
+ * @param line - The input string to be checked.
+ * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
+ * @param lines - The classified lines, receive the characters in their data segment.
+ * @param record - The record of the line, receives the offset of its characters.
+ * @param wordCount - Receives the number of characters, with the null terminator.
+ */
 
-        if(checkLabelName(labelName) == False){
-            print_error("Label name is a reserved word\n", originalLine, lineNumber, fileName);
-            *foundError = True;
-            return;
-        }
+void check_string_directive_error(char * line, int lineNumber, char * fileName, HashTable *symbolsLabelsValuesHash, int * directiveOrder, LineTable *lines, LineRecord *record, int * wordCount, bool * foundError){
 
-        strcpy(value, splitedLine[1]);
-    }
+    LineParts parts;                       /* The label, the keyword and the operands of the line */
 
-    numberOfElements = 0;
+    char labelName[MAX_LINE_LENGTH];
+    char value[MAX_LINE_LENGTH * 2];       /* The string without its whitespaces */
 
-    strcat(labelName, ":");
-    removeSubstring(line, labelName);
-    removeSubstring(labelName, ":");
+    splitLine(line, &parts);
 
-    removeWhiteSpaces(line);
-    if(checkQuotes(line, originalLine, lineNumber, fileName) == False){
+    if (parts.operands.length == 0) {
+        print_error(".string directive didn't get any arguments\n", line, lineNumber, fileName);
+        *foundError = True;
         return;
     }
 
-    if(hasLabel(originalLine)){
-        removeLeadingSpaces(value);
-        directiveOrderString = intToString(*directiveOrder);
-        /* Calculate the string size - both of the quotes */
-        memorySize = countCharacters(value) - 2;
+    copySpan(parts.label, labelName, sizeof(labelName));
 
-        memorySizeString = intToString(memorySize);
-        ht_insert(symbolsLabelsValuesHash, labelName, value, "stringDirective", "0", memorySizeString, directiveOrderString);
-        (*directiveOrder)++;
-        free(directiveOrderString);
-        free(memorySizeString);
+    if(parts.label.length > 0 && checkDirectiveLabel(labelName, line, lineNumber, fileName, symbolsLabelsValuesHash) == False){
+        *foundError = True;
+        return;
+    }
 
+    if(checkQuotes(compactSpan(parts.operands, value, sizeof(value)), line, lineNumber, fileName) == False){
+        *foundError = True;
+        return;
     }
 
-    freeStringArray(splitedLine, numberOfElements);
-    free(originalLine);
+    /* The characters between the quotes */
+    keepString(parts.operands.start + 1, parts.operands.length - 2, labelName, directiveOrder, lines, record, wordCount, symbolsLabelsValuesHash);
 
     return;
 
@@ -553,67 +640,76 @@ void check_string_directive_error(char * line, int lineNumber, char * fileName,
 }
 
 
-void check_entry_directive_error(char * line, int lineNumber, char * fileName, HashTable *entriesExternsHash, HashTable *symbolsLabelsValuesHash, bool * foundError){
+/**
+ * check_include_directive_error - Check for syntax errors in the .include directive, and map the file it includes.
+ * @param line - The input string to be checked.
+ * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
+ * @param lines - The classified lines, keep the file when it is valid and its room in their data segment.
+ * @param record - The record of the line, receives the index of the file and the offset of its words.
+ * @param wordCount - Receives the number of words in the file.
+ */
 
-    char **splitedLine;                    /* Array to store the splited line */
-    int numberOfElements = 0;              /* Reset the elemnts number - for the string spliter counter */
+void check_include_directive_error(char * line, int lineNumber, char * fileName, HashTable *symbolsLabelsValuesHash, int * directiveOrder, LineTable *lines, LineRecord *record, int * wordCount, bool * foundError){
+
+    LineParts parts;                       /* The label, the keyword and the operands of the line */
 
-    /* copy line to side variable */
-    char* originalLine = malloc(strlen(line) + 1);
+    char labelName[MAX_LINE_LENGTH];
+    char value[MAX_LINE_LENGTH * 2];       /* The file name without its whitespaces */
 
-    char value[MAX_LINE_LENGTH];
+    splitLine(line, &parts);
 
-    if (originalLine == NULL) {
-        perror(MEMORY_ALLOCATION_ERROR);
-        exit(EXIT_FAILURE);
+    if (parts.operands.length == 0) {
+        print_error(".include directive didn't get any arguments\n", line, lineNumber, fileName);
+        *foundError = True;
+        return;
     }
 
-    strcpy(originalLine, line);
+    copySpan(parts.label, labelName, sizeof(labelName));
 
-    /* Skip leading whitespaces */
-    while (*line && (*line == ' ' || *line == '\t')) {
-        line++;
+    if(parts.label.length > 0 && checkDirectiveLabel(labelName, line, lineNumber, fileName, symbolsLabelsValuesHash) == False){
+        *foundError = True;
+        return;
     }
 
-    if (hasSomethingAfterSection(line, ".entry") == False) {
-        print_error(".entry directive didn't get any arguments\n", originalLine, lineNumber, fileName);
+    if(checkQuotes(compactSpan(parts.operands, value, sizeof(value)), line, lineNumber, fileName) == False){
         *foundError = True;
         return;
     }
 
-    /* print line */
-    removeSubstring(line, ".entry");
-
-    if(hasLabel(line)){
-
-        splitedLine = splitString(line, ":", &numberOfElements);
-
-        /* A warning can be inserted here */
-
-        strcpy(value, splitedLine[1]);
-        freeStringArray(splitedLine, numberOfElements);
+    /* The name between the quotes */
+    includeFile(value + 1, (int)(strchr(value + 1, '"') - (value + 1)), line, lineNumber, fileName, labelName, directiveOrder, lines, record, wordCount, symbolsLabelsValuesHash, foundError);
 
-    }
+    return;
+}
 
-    else {
 
-        strcpy(value, line);
-    }
+/**
+ * Check an Entry
+ *
+ * @param value - The label the entry points on.
+ * @param line - The line, for the error messages.
+ * @param lineNumber - The line number where the error occurred.
+ * @param fileName - The name of the file where the error occurred.
+ * @param entriesExternsHash - The hash table to store the entries and externs.
+ * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
+ * @param foundError - A flag to indicate if an error was found.
+ */
+static void checkEntry(char *value, const char *line, int lineNumber, char *fileName, HashTable *entriesExternsHash, HashTable *symbolsLabelsValuesHash, bool *foundError) {
 
-    if(hasLabel(originalLine)){
-        removeLeadingSpaces(value);
+    if (value[0] == '\0') {
+        print_error(".entry directive didn't get any arguments\n", line, lineNumber, fileName);
+        *foundError = True;
+        return;
     }
 
-    removeWhiteSpaces(value);
-
     if(ht_search(entriesExternsHash, value) != NULL && strcmp(ht_get_type(entriesExternsHash, value), "externDirective") == 0){
-        print_error("Entry is already defined as extern directive\n", originalLine, lineNumber, fileName);
+        print_error("Entry is already defined as extern directive\n", line, lineNumber, fileName);
         *foundError = True;
         return;
     }
 
     if(ht_search(symbolsLabelsValuesHash, value) == NULL){
-        print_error("The label the entry is pointing on is not defined in the file\n", originalLine, lineNumber, fileName);
+        print_error("The label the entry is pointing on is not defined in the file\n", line, lineNumber, fileName);
         *foundError = True;
         return;
     }
@@ -621,67 +717,28 @@ void check_entry_directive_error(char * line, int lineNumber, char * fileName, H
     if(ht_search(entriesExternsHash, value) == NULL){
         ht_insert(entriesExternsHash, value, "0", "entryDirective", "0", "0", "0");
     }
-
-    free(originalLine);
-
-    return;
 }
 
-void check_extern_directive_error(char * line, int lineNumber, char * fileName, HashTable *entriesExternsHash, bool * foundError){
-
-    char **splitedLine;                    /* Array to store the splited line */
-    int numberOfElements = 0;              /* Reset the elemnts number - for the string spliter counter */
-
-    /* copy line to side variable */
-    char* originalLine = malloc(strlen(line) + 1);
-
-    char value[MAX_LINE_LENGTH];
-
-    if (originalLine == NULL) {
-        perror(MEMORY_ALLOCATION_ERROR);
-        exit(EXIT_FAILURE);
-    }
-
-    strcpy(originalLine, line);
-
-    /* Skip leading whitespaces */
-    while (*line && (*line == ' ' || *line == '\t')) {
-        line++;
-    }
+/**
+ * Check an Extern
+ *
+ * @param value - The name of the extern.
+ * @param line - The line, for the error messages.
+ * @param lineNumber - The line number where the error occurred.
+ * @param fileName - The name of the file where the error occurred.
+ * @param entriesExternsHash - The hash table to store the entries and externs.
+ * @param foundError - A flag to indicate if an error was found.
+ */
+static void checkExtern(char *value, const char *line, int lineNumber, char *fileName, HashTable *entriesExternsHash, bool *foundError) {
 
-    if (hasSomethingAfterSection(line, ".extern") == False) {
-        print_error(".extern directive didn't get any arguments\n", originalLine, lineNumber, fileName);
+    if (value[0] == '\0') {
+        print_error(".extern directive didn't get any arguments\n", line, lineNumber, fileName);
         *foundError = True;
         return;
     }
 
-    /* print line */
-    removeSubstring(line, ".extern");
-
-    if(hasLabel(line)){
-
-        splitedLine = splitString(line, ":", &numberOfElements);
-
-        /* A warning can be inserted here */
-
-        strcpy(value, splitedLine[1]);
-        freeStringArray(splitedLine, numberOfElements);
-
-    }
-
-    else{
-
-        strcpy(value, line);
-    }
-
-    removeWhiteSpaces(value);
-
-    if(hasLabel(originalLine)){
-        removeLeadingSpaces(value);
-    }
-
     if(ht_search(entriesExternsHash, value) != NULL && strcmp(ht_get_type(entriesExternsHash, value), "entryDirective") == 0){
-        print_error("Extern is already defined as entry directive\n", originalLine, lineNumber, fileName);
+        print_error("Extern is already defined as entry directive\n", line, lineNumber, fileName);
         *foundError = True;
         return;
     }
@@ -689,464 +746,263 @@ void check_extern_directive_error(char * line, int lineNumber, char * fileName,
     if(ht_search(entriesExternsHash, value) == NULL){
         ht_insert(entriesExternsHash, value, "0", "externDirective", "0", "0", "0");
     }
+}
 
-    free(originalLine);
+void check_entry_directive_error(char * line, int lineNumber, char * fileName, HashTable *entriesExternsHash, HashTable *symbolsLabelsValuesHash, bool * foundError){
 
-    return;
+    LineParts parts;                       /* The label, the keyword and the operands of the line */
+    char value[MAX_LINE_LENGTH * 2];       /* The label the entry points on, without whitespaces */
 
+    splitLine(line, &parts);
 
-}
+    /* A label before the directive is ignored - a warning can be inserted here */
+    compactSpan(parts.operands, value, sizeof(value));
 
-void temp_instruction_addition(char * line, int lineNumber, char * fileName, HashTable *entriesExternsHash, HashTable *symbolsLabelsValuesHash, bool * foundError){
-    char **splitedLine;                    /* Array to store the splited line */
-    int numberOfElements = 0;              /* Reset the elemnts number - for the string spliter counter */
-
-    /* copy line to side variable */
-    char* originalLine = malloc(strlen(line) + 1);
-
-    char labelName[MAX_LABEL_LENGTH];
-
-    if (originalLine == NULL) {
-        perror(MEMORY_ALLOCATION_ERROR);
-        exit(EXIT_FAILURE);
-    }
-
-    strcpy(originalLine, line);
-
-    /* Skip leading whitespaces */
-    while (*line && (*line == ' ' || *line == '\t')) {
-        line++;
-    }
-
-    if(hasLabel(line)){
-
-        splitedLine = splitString(line, ":", &numberOfElements);
-
-        if(ht_search(symbolsLabelsValuesHash, splitedLine[0]) != NULL){
-            print_error("Label is already defined\n", originalLine, lineNumber, fileName);
-            *foundError = True;
-            freeStringArray(splitedLine, numberOfElements);
-            return;
-        }
-
-        if(ht_search(entriesExternsHash, splitedLine[0]) != NULL){
-            print_error("Label is already defined as entry or extern directive\n", originalLine, lineNumber, fileName);
-            *foundError = True;
-            freeStringArray(splitedLine, numberOfElements);
-            return;
-        }
-
-        strcpy(labelName, splitedLine[0]);
-
-        if(checkLabelLength(labelName) == False){
-            print_error("Label name is too long\n", originalLine, lineNumber, fileName);
-            *foundError = True;
-            freeStringArray(splitedLine, numberOfElements);
-            return;
-        }
-
-        if(checkLabelName(labelName) == False){
-            print_error("Label name is a reserved word\n", originalLine, lineNumber, fileName);
-            *foundError = True;
-            freeStringArray(splitedLine, numberOfElements);
-            return;
-        }
-
-        freeStringArray(splitedLine, numberOfElements);
-        
-    }
-
-    strcat(labelName, ":");
-    removeSubstring(line, labelName);
-    removeSubstring(labelName, ":");
-
-    if(hasLabel(originalLine)){
-        ht_insert(symbolsLabelsValuesHash, labelName, "NULL", "instruction", "0", "0", "-1");
-    }
-
-    free(originalLine);
+    checkEntry(value, line, lineNumber, fileName, entriesExternsHash, symbolsLabelsValuesHash, foundError);
 
     return;
-
 }
 
-void check_instruction_error(char * line, int lineNumber, char * fileName, HashTable *entriesExternsHash, HashTable *symbolsLabelsValuesHash, bool * foundError){
-
-    char **splitedLine;                    /* Array to store the splited line */
-    int numberOfElements = 0;              /* Reset the elemnts number - for the string spliter counter */
-    AddressingMode operand1AddressingMode;
-    AddressingMode operand2AddressingMode;
-    /* copy line to side variable */
-    char* originalLine = malloc(strlen(line) + 1);
-
-    char labelName[MAX_LABEL_LENGTH];
-    char instruction[4];
-
-    if (originalLine == NULL) {
-        perror(MEMORY_ALLOCATION_ERROR);
-        exit(EXIT_FAILURE);
-    }
+void check_extern_directive_error(char * line, int lineNumber, char * fileName, HashTable *entriesExternsHash, bool * foundError){
 
-    strcpy(originalLine, line);
+    LineParts parts;                       /* The label, the keyword and the operands of the line */
+    char value[MAX_LINE_LENGTH * 2];       /* The name of the extern, without whitespaces */
 
-    /* Skip leading whitespaces */
-    while (*line && (*line == ' ' || *line == '\t')) {
-        line++;
-    }
+    splitLine(line, &parts);
 
-    if(hasLabel(line)){
+    /* A label before the directive is ignored - a warning can be inserted here */
+    compactSpan(parts.operands, value, sizeof(value));
 
-        splitedLine = splitString(line, ":", &numberOfElements);
+    checkExtern(value, line, lineNumber, fileName, entriesExternsHash, foundError);
 
-        if(ht_search(symbolsLabelsValuesHash, splitedLine[0]) != NULL && strcmp(ht_get_type(symbolsLabelsValuesHash, splitedLine[0]), "instruction") == 0){
-            ht_delete(symbolsLabelsValuesHash, splitedLine[0]);
-        }
-        if(ht_search(symbolsLabelsValuesHash, splitedLine[0]) != NULL){
-            print_error("Label is already defined\n", originalLine, lineNumber, fileName);
-            *foundError = True;
-            freeStringArray(splitedLine, numberOfElements);
-            return;
-        }
-
-        if(ht_search(entriesExternsHash, splitedLine[0]) != NULL && strcmp(ht_get_type(entriesExternsHash, splitedLine[0]), "externDirective") == 0){
-            print_error("Label is already defined as an extern directive\n", originalLine, lineNumber, fileName);
-            *foundError = True;
-            freeStringArray(splitedLine, numberOfElements);
-            return;
-        }
+    return;
 
-        strcpy(labelName, splitedLine[0]);
 
-        if(checkLabelLength(labelName) == False){
-            print_error("Label name is too long\n", originalLine, lineNumber, fileName);
-            *foundError = True;
-            freeStringArray(splitedLine, numberOfElements);
-            return;
-        }
+}
 
-        if(checkLabelName(labelName) == False){
-            print_error("Label name is a reserved word\n", originalLine, lineNumber, fileName);
-            *foundError = True;
-            freeStringArray(splitedLine, numberOfElements);
-            return;
-        }
+/**
+ * Add an Instruction Label
+ *
+ * Defines the label of an instruction for the first pass, the third pass checks it again with the operands.
+ *
+ * @param labelName - The label of the instruction.
+ * @param line - The line, for the error messages.
+ * @param lineNumber - The line number where the error occurred.
+ * @param fileName - The name of the file where the error occurred.
+ * @param entriesExternsHash - The hash table to store the entries and externs.
+ * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
+ * @param foundError - A flag to indicate if an error was found.
+ */
+static void addInstructionLabel(char *labelName, const char *line, int lineNumber, char *fileName, HashTable *entriesExternsHash, HashTable *symbolsLabelsValuesHash, bool *foundError) {
 
-        freeStringArray(splitedLine, numberOfElements);
-        
+    if(ht_search(symbolsLabelsValuesHash, labelName) != NULL){
+        print_error("Label is already defined\n", line, lineNumber, fileName);
+        *foundError = True;
+        return;
     }
 
-    strcat(labelName, ":");
-    removeSubstring(line, labelName);
-    removeSubstring(labelName, ":");
-
-    numberOfElements = 0;
-    removeLeadingSpaces(line);
-
-    splitedLine = splitString(line, " ", &numberOfElements);
-    strcpy(instruction, splitedLine[0]);
-
-    freeStringArray(splitedLine, numberOfElements);
-    removeWhiteSpaces(instruction);
-
-    if (number_of_operands_is_valid(instruction, line) == False) {
-        print_error("Invalid number of operands\n", originalLine, lineNumber, fileName);
+    if(ht_search(entriesExternsHash, labelName) != NULL){
+        print_error("Label is already defined as entry or extern directive\n", line, lineNumber, fileName);
         *foundError = True;
         return;
     }
 
-    if(checkInstructionCommas(line, originalLine, lineNumber, fileName) == False){
-        print_error("Invalid commas\n", originalLine, lineNumber, fileName);
+    if(checkLabelLength(labelName) == False){
+        print_error("Label name is too long\n", line, lineNumber, fileName);
         *foundError = True;
         return;
     }
 
-    if (strcmp(instruction, "mov") == 0 || strcmp(instruction, "cmp") == 0 || strcmp(instruction, "add") == 0 ||
-        strcmp(instruction, "sub") == 0 || strcmp(instruction, "lea") == 0) {
-
-
-            removeLeadingSpaces(line);
-            numberOfElements = 0;
-            splitedLine = splitString(line, ",", &numberOfElements);
-
-            operand1AddressingMode = identifyAddressingMode(splitedLine[0], symbolsLabelsValuesHash, entriesExternsHash);
-            operand2AddressingMode = identifyAddressingMode(splitedLine[1], symbolsLabelsValuesHash, entriesExternsHash);
-
-            freeStringArray(splitedLine, numberOfElements);
-
-            if(operand1AddressingMode == UNDEFINED_ADDRESSING){
-                print_error("Unkown addressing mode for the source operand\n", originalLine, lineNumber, fileName);
-                *foundError = True;
-                return;
-            }
-
-            if(operand2AddressingMode == UNDEFINED_ADDRESSING){
-                print_error("Unkown addressing mode for the destination operand\n", originalLine, lineNumber, fileName);
-                *foundError = True;
-                return;
-            }
-
-            if(operand1AddressingMode == UNDEFINED_CONSTANT){
-                print_error("The constant that has been used for the source operand is undifined\n", originalLine, lineNumber, fileName);
-                *foundError = True;
-                return;
-            }
-
-            if(operand2AddressingMode == UNDEFINED_CONSTANT){
-                print_error("The constant that has been used for the destination operand is undifined\n", originalLine, lineNumber, fileName);
-                *foundError = True;
-                return;
-            }
-
-            if(operand1AddressingMode == UNDEFINED_LABEL){
-                print_error("Label does not exists for the source operand, also make sure it as a data or a string directive\n", originalLine, lineNumber, fileName);
-                *foundError = True;
-                return;
-            }
-
-            if(operand2AddressingMode == UNDEFINED_LABEL){
-                print_error("Label does not exists for the destination operand, also make sure it as a data or a string directive\n", originalLine, lineNumber, fileName);
-                *foundError = True;
-                return;
-            }
-
-            if(operand1AddressingMode == INDEX_OVERFLOW){
-                print_error("Index overflow for the source operand\n", originalLine, lineNumber, fileName);
-                *foundError = True;
-                return;
-            }
-
-            if(operand2AddressingMode == INDEX_OVERFLOW){
-                print_error("Index overflow for the destination operand\n", originalLine, lineNumber, fileName);
-                *foundError = True;
-                return;
-            }
-
-            /* mov command*/
-            if(strcmp(instruction, "mov") == 0){
-                if(operand1AddressingMode != IMMEDIATE && operand1AddressingMode != DIRECT && operand1AddressingMode != INDEX && operand1AddressingMode != REGISTER){
-                    print_error("Invalid addressing mode for the source operand\n", originalLine, lineNumber, fileName);
-                    *foundError = True;
-                    return;
-                }
-
-                if(operand2AddressingMode != DIRECT && operand2AddressingMode != INDEX && operand2AddressingMode != REGISTER){
-                    print_error("Invalid addressing mode for the destination operand\n", originalLine, lineNumber, fileName);
-                    *foundError = True;
-                    return;
-                }
-
-            }
-
-            /* cmp command*/
-            else if(strcmp(instruction, "cmp") == 0){
-                if(operand1AddressingMode != IMMEDIATE && operand1AddressingMode != DIRECT && operand1AddressingMode != INDEX && operand1AddressingMode != REGISTER){
-                    print_error("Invalid addressing mode for the source operand\n", originalLine, lineNumber, fileName);
-                    *foundError = True;
-                    return;
-                }
-
-                if(operand2AddressingMode != IMMEDIATE && operand2AddressingMode != DIRECT && operand2AddressingMode != INDEX && operand2AddressingMode != REGISTER){
-                    print_error("Invalid addressing mode for the destination operand\n", originalLine, lineNumber, fileName);
-                    *foundError = True;
-                    return;
-                }
-
-            }
-
-            /* add command*/
-            else if(strcmp(instruction, "add") == 0){
-                if(operand1AddressingMode != IMMEDIATE && operand1AddressingMode != DIRECT && operand1AddressingMode != INDEX && operand1AddressingMode != REGISTER){
-                    print_error("Invalid addressing mode for the source operand\n", originalLine, lineNumber, fileName);
-                    *foundError = True;
-                    return;
-                }
-
-                if(operand2AddressingMode != DIRECT && operand2AddressingMode != INDEX && operand2AddressingMode != REGISTER){
-                    print_error("Invalid addressing mode for the destination operand\n", originalLine, lineNumber, fileName);
-                    *foundError = True;
-                    return;
-                }
-
-            }
-
-            /* sub command*/
-            else if(strcmp(instruction, "sub") == 0){
-                if(operand1AddressingMode != IMMEDIATE && operand1AddressingMode != DIRECT && operand1AddressingMode != INDEX && operand1AddressingMode != REGISTER){
-                    print_error("Invalid addressing mode for the source operand\n", originalLine, lineNumber, fileName);
-                    *foundError = True;
-                    return;
-                }
-
-                if(operand2AddressingMode != DIRECT && operand2AddressingMode != INDEX && operand2AddressingMode != REGISTER){
-                    print_error("Invalid addressing mode for the destination operand\n", originalLine, lineNumber, fileName);
-                    *foundError = True;
-                    return;
-                }
+    if(checkLabelName(labelName) == False){
+        print_error("Label name is a reserved word\n", line, lineNumber, fileName);
+        *foundError = True;
+        return;
+    }
 
-            }
+    ht_insert(symbolsLabelsValuesHash, labelName, "NULL", "instruction", "0", "0", "-1");
+}
 
-            /* lea command*/
-            else if(strcmp(instruction, "lea") == 0){
-                if(operand1AddressingMode != DIRECT && operand1AddressingMode != INDEX){
-                    print_error("Invalid addressing mode for the source operand\n", originalLine, lineNumber, fileName);
-                    *foundError = True;
-                    return;
-                }
+void temp_instruction_addition(char * line, int lineNumber, char * fileName, HashTable *entriesExternsHash, HashTable *symbolsLabelsValuesHash, bool * foundError){
 
-                if(operand2AddressingMode != DIRECT && operand2AddressingMode != INDEX && operand2AddressingMode != REGISTER){
-                    print_error("Invalid addressing mode for the destination operand\n", originalLine, lineNumber, fileName);
-                    *foundError = True;
-                    return;
-                }
+    LineParts parts;                       /* The label, the keyword and the operands of the line */
+    char labelName[MAX_LINE_LENGTH];
 
-            }
+    splitLine(line, &parts);
 
+    if(parts.label.length == 0){
+        return;
     }
 
-    else if (strcmp(instruction, "not") == 0 || strcmp(instruction, "clr") == 0 || strcmp(instruction, "inc") == 0 ||
-               strcmp(instruction, "dec") == 0 || strcmp(instruction, "jmp") == 0 || strcmp(instruction, "bne") == 0 ||
-               strcmp(instruction, "red") == 0 || strcmp(instruction, "prn") == 0 || strcmp(instruction, "jsr") == 0) {
-
-
-        removeLeadingSpaces(line);
-        numberOfElements = 0;
-        splitedLine = splitString(line, " ", &numberOfElements);
-        operand1AddressingMode = identifyAddressingMode(splitedLine[0], symbolsLabelsValuesHash, entriesExternsHash);
-
-        freeStringArray(splitedLine, numberOfElements);
-
-        if(operand1AddressingMode == UNDEFINED_ADDRESSING){
-            print_error("Unkown addressing mode for the destination operand\n", originalLine, lineNumber, fileName);
-            *foundError = True;
-            return;
-        }
+    copySpan(parts.label, labelName, sizeof(labelName));
+    addInstructionLabel(labelName, line, lineNumber, fileName, entriesExternsHash, symbolsLabelsValuesHash, foundError);
 
-        if(operand1AddressingMode == UNDEFINED_CONSTANT){
-            print_error("The constant that has been used for the destination operand is undifined\n", originalLine, lineNumber, fileName);
-            *foundError = True;
-            return;
-        }
+    return;
 
-        if(operand1AddressingMode == UNDEFINED_LABEL){
-            print_error("Label does not exists for the destination operand, also make sure it as a data or a string directive\n", originalLine, lineNumber, fileName);
-            *foundError = True;
-            return;
-        }
+}
 
-        if(operand1AddressingMode == INDEX_OVERFLOW){
-            print_error("Index overflow for the destination operand\n", originalLine, lineNumber, fileName);
-            *foundError = True;
-            return;
-        }
+/* The operand errors, in the order they are reported */
+static const struct {
+    AddressingMode mode;
+    char *sourceMessage;
+    char *destinationMessage;
+} operandErrors[] = {
+    {UNDEFINED_ADDRESSING, "Unkown addressing mode for the source operand\n", "Unkown addressing mode for the destination operand\n"},
+    {UNDEFINED_CONSTANT, "The constant that has been used for the source operand is undifined\n", "The constant that has been used for the destination operand is undifined\n"},
+    {UNDEFINED_LABEL, "Label does not exists for the source operand, also make sure it as a data or a string directive\n",
+                      "Label does not exists for the destination operand, also make sure it as a data or a string directive\n"},
+    {INDEX_OVERFLOW, "Index overflow for the source operand\n", "Index overflow for the destination operand\n"}
+};
 
-        /* not command*/
-        if(strcmp(instruction, "not") == 0){
-            if(operand1AddressingMode != DIRECT && operand1AddressingMode != INDEX && operand1AddressingMode != REGISTER){
-                print_error("Invalid addressing mode for the destination operand\n", originalLine, lineNumber, fileName);
-                *foundError = True;
-                return;
-            }
+/**
+ * Check an Instruction Label
+ *
+ * @param labelName - The label of the instruction.
+ * @param line - The line, for the error messages.
+ * @param lineNumber - The line number where the error occurred.
+ * @param fileName - The name of the file where the error occurred.
+ * @param entriesExternsHash - The hash table to store the entries and externs.
+ * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
+ * @return True if the label is valid, False otherwise (the error is reported).
+ */
+static bool checkInstructionLabel(char *labelName, const char *line, int lineNumber, char *fileName, HashTable *entriesExternsHash, HashTable *symbolsLabelsValuesHash) {
 
-        }
+    /* The first pass defined the label so the operands could refer to it, it is defined again once the operands are valid */
+    if(ht_search(symbolsLabelsValuesHash, labelName) != NULL && strcmp(ht_get_type(symbolsLabelsValuesHash, labelName), "instruction") == 0){
+        ht_delete(symbolsLabelsValuesHash, labelName);
+    }
+    if(ht_search(symbolsLabelsValuesHash, labelName) != NULL){
+        print_error("Label is already defined\n", line, lineNumber, fileName);
+        return False;
+    }
 
-        /* clr command*/
-        else if(strcmp(instruction, "clr") == 0){
-            if(operand1AddressingMode != DIRECT && operand1AddressingMode != INDEX && operand1AddressingMode != REGISTER){
-                print_error("Invalid addressing mode for the destination operand\n", originalLine, lineNumber, fileName);
-                *foundError = True;
-                return;
-            }
+    if(ht_search(entriesExternsHash, labelName) != NULL && strcmp(ht_get_type(entriesExternsHash, labelName), "externDirective") == 0){
+        print_error("Label is already defined as an extern directive\n", line, lineNumber, fileName);
+        return False;
+    }
 
-        }
+    if(checkLabelLength(labelName) == False){
+        print_error("Label name is too long\n", line, lineNumber, fileName);
+        return False;
+    }
 
-        /* inc command*/
-        else if(strcmp(instruction, "inc") == 0){
-            if(operand1AddressingMode != DIRECT && operand1AddressingMode != INDEX && operand1AddressingMode != REGISTER){
-                print_error("Invalid addressing mode for the destination operand\n", originalLine, lineNumber, fileName);
-                *foundError = True;
-                return;
-            }
+    if(checkLabelName(labelName) == False){
+        print_error("Label name is a reserved word\n", line, lineNumber, fileName);
+        return False;
+    }
 
-        }
+    return True;
+}
 
-        /* dec command*/
-        else if(strcmp(instruction, "dec") == 0){
-            if(operand1AddressingMode != DIRECT && operand1AddressingMode != INDEX && operand1AddressingMode != REGISTER){
-                print_error("Invalid addressing mode for the destination operand\n", originalLine, lineNumber, fileName);
+/**
+ * Store an Instruction
+ *
+ * Checks the identified operands of an instruction, and keeps them with the line when they are valid.
+ *
+ * @param instruction - The instruction.
+ * @param operands - The identified operands, the source operand first.
+ * @param labelName - The label of the instruction, empty when there is none.
+ * @param line - The line, for the error messages.
+ * @param lineNumber - The line number where the error occurred.
+ * @param fileName - The name of the file where the error occurred.
+ * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
+ * @param record - The record of the line, receives the instruction and its operands.
+ * @param foundError - A flag to indicate if an error was found.
+ */
+static void storeInstruction(InstructionType instruction, Operand *operands, char *labelName, const char *line, int lineNumber, char *fileName, HashTable *symbolsLabelsValuesHash, LineRecord *record, bool *foundError) {
+
+    const InstructionDefinition *definition = instruction_definition(instruction);
+    int operandCount = definition->operandCount;
+    bool firstIsDestination;
+    int error;
+    int i;
+
+    /* The only operand of a single operand instruction is a destination operand */
+    firstIsDestination = (operandCount == 1);
+
+    /* Every kind of operand error is reported for the source operand before the destination operand */
+    for (error = 0; error < (int)(sizeof(operandErrors) / sizeof(operandErrors[0])); error++) {
+        for (i = 0; i < operandCount; i++) {
+            if (operands[i].mode == operandErrors[error].mode) {
+                print_error((i == 1 || firstIsDestination) ? operandErrors[error].destinationMessage : operandErrors[error].sourceMessage, line, lineNumber, fileName);
                 *foundError = True;
                 return;
             }
-
         }
+    }
 
-        /* jmp command*/
-        else if(strcmp(instruction, "jmp") == 0){
-            if(operand1AddressingMode != DIRECT && operand1AddressingMode != REGISTER){
-                print_error("Invalid addressing mode for the destination operand\n", originalLine, lineNumber, fileName);
-                *foundError = True;
-                return;
-            }
+    if (operandCount == 2 && (definition->sourceModes & MODE_BIT(operands[0].mode)) == 0) {
+        print_error("Invalid addressing mode for the source operand\n", line, lineNumber, fileName);
+        *foundError = True;
+        return;
+    }
 
-        }
+    if (operandCount > 0 && (definition->destinationModes & MODE_BIT(operands[operandCount - 1].mode)) == 0) {
+        print_error("Invalid addressing mode for the destination operand\n", line, lineNumber, fileName);
+        *foundError = True;
+        return;
+    }
 
-        /* bne command*/
-        else if(strcmp(instruction, "bne") == 0){
-            if(operand1AddressingMode != DIRECT && operand1AddressingMode != REGISTER){
-                print_error("Invalid addressing mode for the destination operand\n", originalLine, lineNumber, fileName);
-                *foundError = True;
-                return;
-            }
+    if(labelName[0] != '\0'){
+        ht_insert(symbolsLabelsValuesHash, labelName, "NULL", "instruction", "0", "0", "-1");
+    }
 
-        }
+    /* The sizing and the encoding use the parsed operands instead of parsing the line again */
+    record->instruction = instruction;
+    record->operandCount = operandCount;
+    memcpy(record->operands, operands, operandCount * sizeof(Operand));
+}
 
-        /* red command*/
-        else if(strcmp(instruction, "red") == 0){
-            if(operand1AddressingMode != DIRECT && operand1AddressingMode != INDEX && operand1AddressingMode != REGISTER){
-                print_error("Invalid addressing mode for the destination operand\n", originalLine, lineNumber, fileName);
-                *foundError = True;
-                return;
-            }
+void check_instruction_error(char * line, int lineNumber, char * fileName, HashTable *entriesExternsHash, HashTable *symbolsLabelsValuesHash, LineTable *lines, LineRecord *record, bool * foundError){
 
-        }
+    char **splitedLine;                    /* Array to store the splited line */
+    int numberOfElements = 0;              /* Reset the elemnts number - for the string spliter counter */
+    int operandCount = 0;                  /* Number of operands of the instruction */
+    Operand operands[2];                   /* The parsed operands (source first), kept with the line once it is valid */
+    InstructionType instructionType;
+    int i;
+    LineParts parts;                       /* The label, the keyword and the operands of the line */
 
-        /* prn command*/
-        else if(strcmp(instruction, "prn") == 0){
-            if(operand1AddressingMode != IMMEDIATE && operand1AddressingMode != DIRECT && operand1AddressingMode != INDEX && operand1AddressingMode != REGISTER){
-                print_error("Invalid addressing mode for the destination operand\n", originalLine, lineNumber, fileName);
-                *foundError = True;
-                return;
-            }
+    char labelName[MAX_LINE_LENGTH];
+    char instruction[MAX_LINE_LENGTH];
+    char operandsText[MAX_LINE_LENGTH * 2];
 
-        }
+    splitLine(line, &parts);
+    copySpan(parts.label, labelName, sizeof(labelName));
 
-        /* jsr command*/
-        else if(strcmp(instruction, "jsr") == 0){
-            if(operand1AddressingMode != DIRECT && operand1AddressingMode != REGISTER){
-                print_error("Invalid addressing mode for the destination operand\n", originalLine, lineNumber, fileName);
-                *foundError = True;
-                return;
-            }
+    if(parts.label.length > 0 && checkInstructionLabel(labelName, line, lineNumber, fileName, entriesExternsHash, symbolsLabelsValuesHash) == False){
+        *foundError = True;
+        return;
+    }
 
-        }
+    copySpan(parts.keyword, instruction, sizeof(instruction));
+    copySpan(parts.operands, operandsText, sizeof(operandsText));
 
+    if (number_of_operands_is_valid(instruction, operandsText) == False) {
+        print_error("Invalid number of operands\n", line, lineNumber, fileName);
+        *foundError = True;
+        return;
     }
 
-    else if (strcmp(instruction, "rts") == 0 || strcmp(instruction, "hlt") == 0) {
-        removeLeadingSpaces(line);
-        if (hasSomethingAfterSection(line, instruction) == True) {
-            print_error("Invalid number of operands\n", originalLine, lineNumber, fileName);
-            *foundError = True;
-            return;
-        }
+    if(checkInstructionCommas(operandsText, line, lineNumber, fileName) == False){
+        print_error("Invalid commas\n", line, lineNumber, fileName);
+        *foundError = True;
+        return;
     }
 
+    instructionType = find_instruction(instruction);
+    operandCount = instruction_definition(instructionType)->operandCount;
 
+    if (operandCount > 0) {
+        splitedLine = splitString(operandsText, (operandCount == 2 ? "," : " "), &numberOfElements);
 
-    if(hasLabel(originalLine)){
-        ht_insert(symbolsLabelsValuesHash, labelName, "NULL", "instruction", "0", "0", "-1");
+        for (i = 0; i < operandCount; i++) {
+            identifyOperand(splitedLine[i], &operands[i], lines, symbolsLabelsValuesHash, entriesExternsHash);
+        }
+
+        freeStringArray(splitedLine, numberOfElements);
     }
 
-    free(originalLine);
+    storeInstruction(instructionType, operands, labelName, line, lineNumber, fileName, symbolsLabelsValuesHash, record, foundError);
 
     return;
 
@@ -1156,55 +1012,31 @@ void check_instruction_error(char * line, int lineNumber, char * fileName, HashT
  * Check if the number of operands is valid for the given instruction.
  *
  * @param instructionName - The name of the instruction.
- * @param instructionContent - The content of the instruction.
+ * @param operands - The operands of the instruction (the text after its name).
  * @return True if the number of operands is valid, False otherwise.
  */
-bool number_of_operands_is_valid(char *instructionName, char *line) {
+bool number_of_operands_is_valid(char *instructionName, char *operands) {
 
     char **splitedLine;                    /* Array to store the split line */
     int numberOfElements = 0;              /* Reset the elements number - for the string splitter counter */
+    InstructionType instruction = find_instruction(instructionName);
+    int operandCount;
 
-    if (strcmp(instructionName, "rts") == 0 || strcmp(instructionName, "hlt") == 0) {
-        if (hasSomethingAfterSection(line, instructionName) == 0) {
-            return True;
-        }
+    if (instruction == UNDEFINED_INSTRUCTION) {
+        return False;
     }
 
-    removeSubstring(line, instructionName);
-
-    if (strcmp(instructionName, "mov") == 0 || strcmp(instructionName, "cmp") == 0 || strcmp(instructionName, "add") == 0 ||
-        strcmp(instructionName, "sub") == 0 || strcmp(instructionName, "lea") == 0) {
-
-        splitedLine = splitString(line, ",", &numberOfElements);
-
-        if (numberOfElements == 2) {
-            freeStringArray(splitedLine, numberOfElements);
-            return True;
-        }
-        else{
-            freeStringArray(splitedLine, numberOfElements);
-            return False;
-        }
-
-    } else if (strcmp(instructionName, "not") == 0 || strcmp(instructionName, "clr") == 0 || strcmp(instructionName, "inc") == 0 ||
-               strcmp(instructionName, "dec") == 0 || strcmp(instructionName, "jmp") == 0 || strcmp(instructionName, "bne") == 0 ||
-               strcmp(instructionName, "red") == 0 || strcmp(instructionName, "prn") == 0 || strcmp(instructionName, "jsr") == 0) {
-
-        splitedLine = splitString(line, " ", &numberOfElements);
-
-        if (numberOfElements == 1) {
-            freeStringArray(splitedLine, numberOfElements);
-            return True;
-        }
-
-        else{
-            freeStringArray(splitedLine, numberOfElements);
-            return False;
-        }
+    operandCount = instruction_definition(instruction)->operandCount;
 
+    if (operandCount == 0) {
+        return (operands[0] == '\0' ? True : False);
     }
 
-    return False;
+    /* Two operands are separated by a comma, a single operand stands alone */
+    splitedLine = splitString(operands, (operandCount == 2 ? "," : " "), &numberOfElements);
+    freeStringArray(splitedLine, numberOfElements);
+
+    return (numberOfElements == operandCount ? True : False);
         
 }
 
@@ -1218,6 +1050,11 @@ bool number_of_operands_is_valid(char *instructionName, char *line) {
 bool checkInstructionCommas(const char* line, const char* originalLine, int lineNumber, char * fileName) {
     int consecutiveCommas = 0;
 
+    /* An instruction without operands has no commas */
+    if (*line == '\0') {
+        return True;
+    }
+
     /* Check if the line begins with a comma */
     if (*line == ',') {
         print_error("Instruction begins with a comma.\n", originalLine, lineNumber, fileName);
@@ -1275,4 +1112,234 @@ bool checkIfLineLengthValid(char * line, int lineNumber, char * fileName) {
 }
 
 
+/**
+ * Token Name
+ *
+ * @param program - The tokenized program.
+ * @param name - The offset of a name, TOKEN_NO_NAME for none.
+ * @return The name, an empty string for none. The hash tables only read it.
+ */
+static char *tokenName(const TokenProgram *program, int name) {
+    static char none[] = "";
+
+    return (name == TOKEN_NO_NAME ? none : (char *)program->names + name);
+}
 
+/**
+ * Check a Data Record
+ *
+ * Checks the values of a .data record as check_data_directive_error checks the values of the line, and writes them into the data segment.
+ *
+ * @param program - The tokenized program.
+ * @param token - The record.
+ * @param labelName - The label of the record, empty when there is none.
+ * @param line - The line the record stands for, for the error messages.
+ * @param lineNumber - The line number where the error occurred.
+ * @param fileName - The name of the file where the error occurred.
+ * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
+ * @param directiveOrder - The order of the directive in the file.
+ * @param lines - The classified lines, receive the values in their data segment.
+ * @param record - The record of the line, receives the offset of its values.
+ * @param wordCount - Receives the number of values.
+ * @param foundError - A flag to indicate if an error was found.
+ */
+static void checkDataRecord(const TokenProgram *program, const TokenRecord *token, char *labelName, const char *line, int lineNumber, char *fileName, HashTable *symbolsLabelsValuesHash, int *directiveOrder, LineTable *lines, LineRecord *record, int *wordCount, bool *foundError) {
+
+    const TokenOperand *operand;
+    const char *valueError = NULL;         /* Why one of the values is invalid */
+    int *words;                            /* The room for the values at the end of the data segment */
+    long number;
+    int i;
+
+    if (token->count == 0) {
+        print_error(".data directive didn't get any arguments\n", line, lineNumber, fileName);
+        *foundError = True;
+        return;
+    }
+
+    if(labelName[0] != '\0' && checkDirectiveLabel(labelName, line, lineNumber, fileName, symbolsLabelsValuesHash) == False){
+        *foundError = True;
+        return;
+    }
+
+    words = reserve_segment_words(&lines->data, token->count);
+
+    for (i = 0; i < token->count && valueError == NULL; i++) {
+        operand = &program->operands[token->first + i];
+        number = operand->value;
+
+        if (operand->flags & TOKEN_VALUE_NAME) {
+            valueError = namedDataValue(tokenName(program, operand->value), &number, symbolsLabelsValuesHash);
+        }
+
+        if (valueError == NULL && (number < MIN_WORD_VALUE || number > MAX_WORD_VALUE)) {
+            valueError = DATA_RANGE_ERROR;
+        }
+
+        words[i] = (int)number;
+    }
+
+    if(valueError != NULL){
+        print_error((char *)valueError, line, lineNumber, fileName);
+        *foundError = True;
+        return;
+    }
+
+    keepDataValues(labelName, token->count, directiveOrder, lines, record, wordCount, symbolsLabelsValuesHash);
+}
+
+/**
+ * Check a Constant Record
+ *
+ * @param program - The tokenized program.
+ * @param token - The record.
+ * @param labelName - The label of the record, empty when there is none.
+ * @param line - The line the record stands for, for the error messages.
+ * @param lineNumber - The line number where the error occurred.
+ * @param fileName - The name of the file where the error occurred.
+ * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
+ * @param foundError - A flag to indicate if an error was found.
+ */
+static void checkConstantRecord(const TokenProgram *program, const TokenRecord *token, char *labelName, const char *line, int lineNumber, char *fileName, HashTable *symbolsLabelsValuesHash, bool *foundError) {
+
+    const TokenOperand *value = &program->operands[token->first];
+    char *name = tokenName(program, token->name);
+    char *number;
+
+    if (labelName[0] != '\0') {
+        print_error(".define instruction cannot have a lablel before it\n", line, lineNumber, fileName);
+        *foundError = True;
+        return;
+    }
+
+    if (name[0] == '\0') {
+        print_error("Invalid constant definition\n", line, lineNumber, fileName);
+        *foundError = True;
+        return;
+    }
+
+    if(ht_search(symbolsLabelsValuesHash, name) != NULL){
+        print_error("Constant is already defined\n", line, lineNumber, fileName);
+        *foundError = True;
+        return;
+    }
+
+    if(value->flags & TOKEN_VALUE_NAME){
+        print_error("Invalid constant definition - number is not a valid integer\n", line, lineNumber, fileName);
+        *foundError = True;
+        return;
+    }
+
+    number = intToString(value->value);
+    ht_insert(symbolsLabelsValuesHash, name, number, "constant", "0", "0", "-1");
+    free(number);
+}
+
+/**
+ * Identify a Token Operand
+ *
+ * @param program - The tokenized program.
+ * @param operand - The operand of an instruction record.
+ * @param parsed - Receives the parsed operand.
+ * @param lines - The classified lines, keep the label names the operands refer to.
+ * @param symbolsLabelsValuesHash - The hash table containing the symbols, labels and values.
+ * @param entriesExternsHash - The hash table containing the entries and externs.
+ */
+static void identifyTokenOperand(const TokenProgram *program, const TokenOperand *operand, Operand *parsed, LineTable *lines, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash) {
+
+    switch (operand->mode) {
+        case TOKEN_IMMEDIATE:
+            identifyOperandParts(IMMEDIATE, ((operand->flags & TOKEN_VALUE_NAME) ? tokenName(program, operand->value) : NULL), NULL, operand->value,
+                                 parsed, lines, symbolsLabelsValuesHash, entriesExternsHash);
+            break;
+        case TOKEN_DIRECT:
+            identifyOperandParts(DIRECT, tokenName(program, operand->value), NULL, 0, parsed, lines, symbolsLabelsValuesHash, entriesExternsHash);
+            break;
+        case TOKEN_INDEX:
+            identifyOperandParts(INDEX, tokenName(program, operand->value), ((operand->flags & TOKEN_INDEX_NAME) ? tokenName(program, operand->index) : NULL), operand->index,
+                                 parsed, lines, symbolsLabelsValuesHash, entriesExternsHash);
+            break;
+        default:
+            identifyOperandParts(REGISTER, NULL, NULL, operand->value, parsed, lines, symbolsLabelsValuesHash, entriesExternsHash);
+            break;
+    }
+}
+
+void check_token_errors(const struct TokenProgram *program, char *line, int lineNumber, char *fileName, HashTable *symbolsLabelsValuesHash, int *directiveOrder, HashTable *entriesExternsHash, LineTable *lines, int lineIndex, bool *foundError) {
+
+    const TokenRecord *token = &program->records[lineIndex];
+    char *labelName = tokenName(program, token->label);
+    char *name;
+
+    switch (token->kind) {
+        case TOKEN_DATA:
+            checkDataRecord(program, token, labelName, line, lineNumber, fileName, symbolsLabelsValuesHash, directiveOrder, lines, &lines->records[lineIndex], &lines->wordCounts[lineIndex], foundError);
+            break;
+        case TOKEN_STRING:
+        case TOKEN_INCLUDE:
+            if (labelName[0] != '\0' && checkDirectiveLabel(labelName, line, lineNumber, fileName, symbolsLabelsValuesHash) == False) {
+                *foundError = True;
+                break;
+            }
+
+            name = tokenName(program, token->name);
+            if (token->kind == TOKEN_STRING) {
+                keepString(name, (int)strlen(name), labelName, directiveOrder, lines, &lines->records[lineIndex], &lines->wordCounts[lineIndex], symbolsLabelsValuesHash);
+            }
+            else {
+                includeFile(name, (int)strlen(name), line, lineNumber, fileName, labelName, directiveOrder, lines, &lines->records[lineIndex], &lines->wordCounts[lineIndex], symbolsLabelsValuesHash, foundError);
+            }
+            break;
+        case TOKEN_INSTRUCTION:
+            if (labelName[0] != '\0') {
+                addInstructionLabel(labelName, line, lineNumber, fileName, entriesExternsHash, symbolsLabelsValuesHash, foundError);
+            }
+            break;
+        case TOKEN_CONSTANT:
+            checkConstantRecord(program, token, labelName, line, lineNumber, fileName, symbolsLabelsValuesHash, foundError);
+            break;
+        default:
+            break;
+    }
+}
+
+void check_token_entries_externs_errors(const struct TokenProgram *program, char *line, int lineNumber, char *fileName, HashTable *entriesExternsHash, HashTable *symbolsLabelsValuesHash, int lineIndex, bool *foundError) {
+
+    const TokenRecord *token = &program->records[lineIndex];
+
+    if (token->kind == TOKEN_ENTRY) {
+        checkEntry(tokenName(program, token->name), line, lineNumber, fileName, entriesExternsHash, symbolsLabelsValuesHash, foundError);
+    }
+    else if (token->kind == TOKEN_EXTERN) {
+        checkExtern(tokenName(program, token->name), line, lineNumber, fileName, entriesExternsHash, foundError);
+    }
+}
+
+void check_token_instruction_errors(const struct TokenProgram *program, char *line, int lineNumber, char *fileName, HashTable *entriesExternsHash, HashTable *symbolsLabelsValuesHash, LineTable *lines, int lineIndex, bool *foundError) {
+
+    const TokenRecord *token = &program->records[lineIndex];
+    char *labelName = tokenName(program, token->label);
+    Operand operands[2];                   /* The parsed operands (source first), kept with the line once it is valid */
+    int i;
+
+    if (token->kind != TOKEN_INSTRUCTION) {
+        return;
+    }
+
+    if(labelName[0] != '\0' && checkInstructionLabel(labelName, line, lineNumber, fileName, entriesExternsHash, symbolsLabelsValuesHash) == False){
+        *foundError = True;
+        return;
+    }
+
+    if (token->count != instruction_definition((InstructionType)token->opcode)->operandCount) {
+        print_error("Invalid number of operands\n", line, lineNumber, fileName);
+        *foundError = True;
+        return;
+    }
+
+    for (i = 0; i < token->count; i++) {
+        identifyTokenOperand(program, &program->operands[token->first + i], &operands[i], lines, symbolsLabelsValuesHash, entriesExternsHash);
+    }
+
+    storeInstruction((InstructionType)token->opcode, operands, labelName, line, lineNumber, fileName, symbolsLabelsValuesHash, &lines->records[lineIndex], foundError);
+}
@@ -1,3 +1,6 @@
+/* Defined in token_file.h */
+struct TokenProgram;
+
 /** check_errors - Check for syntax errors in the input assembly file.
  * @param commandType - The type of the command to be checked.
  * @param line - The input string to be checked.
@@ -6,9 +9,11 @@
  * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
  * @param directiveOrder - The order of the directive in the file.
  * @param entriesExternsHash - The hash table to store the entries and externs.
+ * @param lines - The classified lines, keeps the files the include lines map and the data segment.
+ * @param lineIndex - The index of the line in the classified lines.
  * @param foundError - A flag to indicate if an error was found.
  */
-void check_errors(CommandType commandType, char *line, int lineNumber, char * fileName, HashTable *symbolsLabelsValuesHash, int * directiveOrder, HashTable *entriesExternsHash, bool * foundError);
+void check_errors(CommandType commandType, char *line, int lineNumber, char * fileName, HashTable *symbolsLabelsValuesHash, int * directiveOrder, HashTable *entriesExternsHash, LineTable *lines, int lineIndex, bool * foundError);
 
 /** check_entries_externs_errors - Check for syntax errors in the input assembly file for entries and externs.
  * @param commandType - The type of the command to be checked.
@@ -28,11 +33,52 @@ void check_entries_externs_errors(CommandType commandType, char *line, int lineN
  * @param fileName - The name of the file where the error occurred.
  * @param entriesExternsHash - The hash table to store the entries and externs.
  * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
+ * @param lines - The classified lines, a valid instruction keeps its parsed operands in its record.
+ * @param lineIndex - The index of the line in the classified lines.
+ * @param foundError - A flag to indicate if an error was found.
+ */
+void check_instruction_errors(CommandType commandType, char *line, int lineNumber, char * fileName, HashTable *entriesExternsHash, HashTable *symbolsLabelsValuesHash, LineTable *lines, int lineIndex, bool * foundError);
+
+/** check_token_errors - Check a record of a tokenized program (see token_file.h) for the errors check_errors finds in the line it stands for.
+ * @param program - The tokenized program.
+ * @param line - The line the record stands for, for the error messages.
+ * @param lineNumber - The line number where the error occurred.
+ * @param fileName - The name of the file where the error occurred.
+ * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
+ * @param directiveOrder - The order of the directive in the file.
+ * @param entriesExternsHash - The hash table to store the entries and externs.
+ * @param lines - The classified lines, keeps the files the include records map and the data segment.
+ * @param lineIndex - The index of the record.
+ * @param foundError - A flag to indicate if an error was found.
+ */
+void check_token_errors(const struct TokenProgram *program, char *line, int lineNumber, char *fileName, HashTable *symbolsLabelsValuesHash, int *directiveOrder, HashTable *entriesExternsHash, LineTable *lines, int lineIndex, bool *foundError);
+
+/** check_token_entries_externs_errors - Check a record of a tokenized program for the errors check_entries_externs_errors finds in the line it stands for.
+ * @param program - The tokenized program.
+ * @param line - The line the record stands for, for the error messages.
+ * @param lineNumber - The line number where the error occurred.
+ * @param fileName - The name of the file where the error occurred.
+ * @param entriesExternsHash - The hash table to store the entries and externs.
+ * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
+ * @param lineIndex - The index of the record.
  * @param foundError - A flag to indicate if an error was found.
  */
-void check_instruction_errors(CommandType commandType, char *line, int lineNumber, char * fileName, HashTable *entriesExternsHash, HashTable *symbolsLabelsValuesHash, bool * foundError);
+void check_token_entries_externs_errors(const struct TokenProgram *program, char *line, int lineNumber, char *fileName, HashTable *entriesExternsHash, HashTable *symbolsLabelsValuesHash, int lineIndex, bool *foundError);
 
-/** print_error - Print the error message to the console.
+/** check_token_instruction_errors - Check a record of a tokenized program for the errors check_instruction_errors finds in the line it stands for.
+ * @param program - The tokenized program.
+ * @param line - The line the record stands for, for the error messages.
+ * @param lineNumber - The line number where the error occurred.
+ * @param fileName - The name of the file where the error occurred.
+ * @param entriesExternsHash - The hash table to store the entries and externs.
+ * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
+ * @param lines - The classified lines, a valid instruction keeps its parsed operands in its record.
+ * @param lineIndex - The index of the record.
+ * @param foundError - A flag to indicate if an error was found.
+ */
+void check_token_instruction_errors(const struct TokenProgram *program, char *line, int lineNumber, char *fileName, HashTable *entriesExternsHash, HashTable *symbolsLabelsValuesHash, LineTable *lines, int lineIndex, bool *foundError);
+
+/** print_error - Print the error message to the console, or collect it when the thread has a diagnostic sink (see diagnostics.h).
  * @param error - The error message to be printed.
  * @param line - The input string where the error occurred.
  * @param lineNumber - The line number where the error occurred.
@@ -40,13 +86,6 @@ void check_instruction_errors(CommandType commandType, char *line, int lineNumbe
  */
 void print_error(char *error, const char *line, int lineNumber, char *fileName);
 
-/** hasSomethingAfterSection - Check if there is something after the section.
- * @param input - The input string to be checked.
- * @param section - The section to be checked.
- * @return bool - True if there is something after the section, false otherwise.
- */
-bool hasSomethingAfterSection(const char *input, const char *section);
-
 /** checkCommas - Check for syntax errors in the input assembly file for commas.
  * @param line - The input string to be checked.
  * @param originalLine - The original input string to be checked.
@@ -93,9 +132,12 @@ void check_constant_error(char * line, int lineNumber, char * fileName, HashTabl
  * @param fileName - The name of the file where the error occurred.
  * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
  * @param directiveOrder - The order of the directive in the file.
+ * @param lines - The classified lines, receive the values of a labelled directive in their data segment.
+ * @param record - The record of the line, receives the offset of its values.
+ * @param wordCount - Receives the number of values.
  * @param foundError - A flag to indicate if an error was found.
  */
-void check_data_directive_error(char * line, int lineNumber, char * fileName, HashTable *symbolsLabelsValuesHash, int * directiveOrder, bool * foundError);
+void check_data_directive_error(char * line, int lineNumber, char * fileName, HashTable *symbolsLabelsValuesHash, int * directiveOrder, LineTable *lines, LineRecord *record, int * wordCount, bool * foundError);
 
 /** check_string_directive_error - Check for syntax errors in the input assembly file for string directives.
  * @param line - The input string to be checked.
@@ -103,9 +145,25 @@ void check_data_directive_error(char * line, int lineNumber, char * fileName, Ha
  * @param fileName - The name of the file where the error occurred.
  * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
  * @param directiveOrder - The order of the directive in the file.
+ * @param lines - The classified lines, keep the room of a labelled directive in their data segment.
+ * @param record - The record of the line, receives the offset of its characters.
+ * @param wordCount - Receives the number of characters, with the null terminator.
+ * @param foundError - A flag to indicate if an error was found.
+ */
+void check_string_directive_error(char * line, int lineNumber, char * fileName, HashTable *symbolsLabelsValuesHash, int * directiveOrder, LineTable *lines, LineRecord *record, int * wordCount, bool * foundError);
+
+/** check_include_directive_error - Check for syntax errors in the input assembly file for include directives, and map the included file.
+ * @param line - The input string to be checked.
+ * @param lineNumber - The line number where the error occurred.
+ * @param fileName - The name of the file where the error occurred, the included file is relative to its directory.
+ * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
+ * @param directiveOrder - The order of the directive in the file.
+ * @param lines - The classified lines, keep the included file when it is valid and the room of its words in their data segment.
+ * @param record - The record of the line, receives the index of the included file.
+ * @param wordCount - Receives the number of words in the included file.
  * @param foundError - A flag to indicate if an error was found.
  */
-void check_string_directive_error(char * line, int lineNumber, char * fileName, HashTable *symbolsLabelsValuesHash, int * directiveOrder, bool * foundError);
+void check_include_directive_error(char * line, int lineNumber, char * fileName, HashTable *symbolsLabelsValuesHash, int * directiveOrder, LineTable *lines, LineRecord *record, int * wordCount, bool * foundError);
 
 /** check_entry_directive_error - Check for syntax errors in the input assembly file for entry directives.
  * @param line - The input string to be checked.
@@ -142,16 +200,18 @@ void check_extern_directive_error(char * line, int lineNumber, char * fileName,
  * @param fileName - The name of the file where the error occurred.
  * @param entriesExternsHash - The hash table to store the entries and externs.
  * @param symbolsLabelsValuesHash - The hash table to store the symbols-labels values.
+ * @param lines - The classified lines, keeps the label names the operands refer to.
+ * @param record - The record of the line, receives the instruction and its parsed operands when the line is valid.
  * @param foundError - A flag to indicate if an error was found.
  */
-void check_instruction_error(char * line, int lineNumber, char * fileName, HashTable *entriesExternsHash, HashTable *symbolsLabelsValuesHash, bool * foundError);
+void check_instruction_error(char * line, int lineNumber, char * fileName, HashTable *entriesExternsHash, HashTable *symbolsLabelsValuesHash, LineTable *lines, LineRecord *record, bool * foundError);
 
 /** number_of_operands_is_valid - Check if the number of operands is valid.
  * @param instructionName - The name of the instruction.
- * @param instructionContent - The content of the instruction.
+ * @param operands - The operands of the instruction (the text after its name).
  * @return bool - True if the number of operands is valid, false otherwise.
  */
-bool number_of_operands_is_valid(char *instructionName, char *instructionContent);
+bool number_of_operands_is_valid(char *instructionName, char *operands);
 
 /** check_instruction_commas - Check for syntax errors in the input assembly file for instruction commas.
  * @param line - The input string to be checked.
@@ -0,0 +1,842 @@
+/* Needed for pwrite(), the *at() flags and (with io_uring) syscall() and mmap() when compiling with -ansi */
+#define _DEFAULT_SOURCE
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#ifdef USE_IO_URING
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#include <linux/stat.h>
+#endif
+
+#include "global_definitions.h"
+#include "utility_functions.h"
+#include "diagnostics.h"
+#include "file_io.h"
+
+/* Every thread has its own directory, so threads serving different directories never share one */
+static pthread_key_t directoryKey;
+static pthread_once_t directoryKeyOnce = PTHREAD_ONCE_INIT;
+
+static void createDirectoryKey(void) {
+    pthread_key_create(&directoryKey, NULL);
+}
+
+/**
+ * Current Directory
+ *
+ * @return The directory the relative file names of the calling thread are relative to, AT_FDCWD for the working directory.
+ */
+static int currentDirectory(void) {
+    const int *directory;
+
+    pthread_once(&directoryKeyOnce, createDirectoryKey);
+    directory = (const int *)pthread_getspecific(directoryKey);
+
+    return (directory != NULL ? *directory : AT_FDCWD);
+}
+
+const int *set_file_directory(const int *directory) {
+    const int *previous;
+
+    pthread_once(&directoryKeyOnce, createDirectoryKey);
+    previous = (const int *)pthread_getspecific(directoryKey);
+    pthread_setspecific(directoryKey, directory);
+
+    return previous;
+}
+
+int open_file(const char *fileName, int flags) {
+    return openat(currentDirectory(), fileName, flags, 0666);
+}
+
+int stat_file(const char *fileName, struct stat *status) {
+    return fstatat(currentDirectory(), fileName, status, 0);
+}
+
+int rename_file(const char *oldName, const char *newName) {
+    return renameat(currentDirectory(), oldName, currentDirectory(), newName);
+}
+
+int remove_file(const char *fileName) {
+    return unlinkat(currentDirectory(), fileName, 0);
+}
+
+/**
+ * Read a File with stdio
+ *
+ * @param fileName - The name of the file.
+ * @param length - Receives the length of the file.
+ * @return The contents, NULL if the file cannot be opened.
+ */
+static char *readStream(const char *fileName, size_t *length) {
+
+    FILE *file = NULL;
+    char *data = NULL;
+    size_t capacity = 4096;
+    size_t bytesRead;
+
+    file = openFile(fileName, "r");
+    if (file == NULL) {
+        return NULL;
+    }
+
+    data = (char *)malloc(capacity);
+    if (data == NULL) {
+        memory_allocation_failed();
+    }
+
+    /* Read until the end of the file, keeping room for the terminating '\0' */
+    *length = 0;
+    while ((bytesRead = fread(data + *length, 1, capacity - *length - 1, file)) > 0) {
+        *length += bytesRead;
+
+        if (*length + 1 == capacity) {
+            capacity *= 2;
+            data = (char *)realloc(data, capacity);
+
+            if (data == NULL) {
+                memory_allocation_failed();
+            }
+        }
+    }
+
+    fclose(file);
+
+    return data;
+}
+
+/**
+ * Write an Output File with stdio
+ *
+ * @param output - The output file.
+ */
+static void writeStream(FileWrite *output) {
+
+    FILE *file = openTemporaryFile(output->fileName, output->temporaryFileName);
+
+    if (file == NULL) {
+        return;
+    }
+
+    if (fwrite(output->data, 1, output->length, file) != output->length) {
+        console_perror(FILE_WRITE_ERROR);
+        fclose(file);
+        remove_file(output->temporaryFileName);
+        return;
+    }
+
+    if (fclose(file) != 0) {
+        console_perror(FILE_WRITE_ERROR);
+        remove_file(output->temporaryFileName);
+        return;
+    }
+
+    commitTemporaryFile(output->temporaryFileName, output->fileName);
+}
+
+#ifdef USE_IO_URING
+
+/* Defines an input file read ahead of time */
+typedef struct PrefetchedFile
+{
+    char fileName[MAX_LINE_LENGTH];
+    char *data;
+    size_t length;
+
+} PrefetchedFile;
+
+/* Defines the io_uring of a thread, its queues are shared with the kernel */
+typedef struct IoRing
+{
+    int fd;
+    unsigned *sqTail;
+    unsigned *sqMask;
+    unsigned *sqArray;
+    unsigned *cqHead;
+    unsigned *cqTail;
+    unsigned *cqMask;
+    struct io_uring_sqe *sqes;
+    struct io_uring_cqe *cqes;
+    void *queues;                                   /* The mappings, unmapped when the ring is given up */
+    size_t queuesSize;
+    size_t sqesSize;
+    unsigned pending;                               /* Operations prepared and not submitted yet */
+    PrefetchedFile prefetched[READ_AHEAD_FILES];    /* Read by prefetch_files() and not taken by read_file() yet */
+    int prefetchedCount;
+    struct IoRing *nextFree;
+
+} IoRing;
+
+/* The rings of the threads that ended, taken by the next threads instead of setting up new ones */
+static pthread_mutex_t ringsLock = PTHREAD_MUTEX_INITIALIZER;
+static IoRing *freeRings = NULL;
+static bool ringsUnavailable = False;       /* Set once the kernel turned a ring down, stdio is used from then on */
+
+static pthread_key_t ringKey;
+static pthread_once_t ringKeyOnce = PTHREAD_ONCE_INIT;
+static bool ringKeyCreated = False;
+
+/**
+ * Drop the Prefetched Files
+ *
+ * @param ring - The ring.
+ */
+static void dropPrefetched(IoRing *ring) {
+
+    while (ring->prefetchedCount > 0) {
+        free(ring->prefetched[--ring->prefetchedCount].data);
+    }
+}
+
+/**
+ * Release a Ring
+ *
+ * The destructor of the ring of a thread, hands the ring to the next thread.
+ *
+ * @param argument - The ring.
+ */
+static void releaseRing(void *argument) {
+    IoRing *ring = (IoRing *)argument;
+
+    dropPrefetched(ring);
+
+    pthread_mutex_lock(&ringsLock);
+    ring->nextFree = freeRings;
+    freeRings = ring;
+    pthread_mutex_unlock(&ringsLock);
+}
+
+static void createRingKey(void) {
+    ringKeyCreated = (pthread_key_create(&ringKey, releaseRing) == 0);
+}
+
+/**
+ * Create a Ring
+ *
+ * @return The ring, NULL if the kernel does not support io_uring or one of the operations the assembler uses.
+ */
+static IoRing *createRing(void) {
+
+    /* Came with different kernels, all of them are there since Linux 5.11 */
+    static const int operations[] = {IORING_OP_OPENAT, IORING_OP_STATX, IORING_OP_READ, IORING_OP_WRITE, IORING_OP_CLOSE, IORING_OP_RENAMEAT, IORING_OP_UNLINKAT};
+
+    struct io_uring_params params;
+    struct io_uring_probe *probe = NULL;
+    IoRing *ring = NULL;
+    char *queues = NULL;
+    void *sqes = NULL;
+    size_t queuesSize;
+    bool supported;
+    int fd;
+    int i;
+
+    memset(&params, 0, sizeof(params));
+    fd = (int)syscall(__NR_io_uring_setup, IO_RING_ENTRIES, &params);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    probe = (struct io_uring_probe *)calloc(1, sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op));
+    if (probe == NULL) {
+        memory_allocation_failed();
+    }
+
+    supported = ((params.features & IORING_FEAT_SINGLE_MMAP) && syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE, probe, 256) == 0);
+    for (i = 0; supported && i < (int)(sizeof(operations) / sizeof(operations[0])); i++) {
+        supported = (operations[i] <= probe->last_op && (probe->ops[operations[i]].flags & IO_URING_OP_SUPPORTED));
+    }
+    free(probe);
+
+    /* Both queues are in a single mapping, the entries of the submission queue in another */
+    queuesSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    if (queuesSize < params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe)) {
+        queuesSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    }
+
+    if (supported) {
+        queues = (char *)mmap(NULL, queuesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+        sqes = mmap(NULL, params.sq_entries * sizeof(struct io_uring_sqe), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+        supported = (queues != MAP_FAILED && sqes != MAP_FAILED);
+    }
+
+    if (!supported) {
+        if (queues != NULL && queues != MAP_FAILED) {
+            munmap(queues, queuesSize);
+        }
+        if (sqes != NULL && sqes != MAP_FAILED) {
+            munmap(sqes, params.sq_entries * sizeof(struct io_uring_sqe));
+        }
+        close(fd);
+        return NULL;
+    }
+
+    ring = (IoRing *)malloc(sizeof(IoRing));
+    if (ring == NULL) {
+        memory_allocation_failed();
+    }
+
+    ring->fd = fd;
+    ring->sqTail = (unsigned *)(queues + params.sq_off.tail);
+    ring->sqMask = (unsigned *)(queues + params.sq_off.ring_mask);
+    ring->sqArray = (unsigned *)(queues + params.sq_off.array);
+    ring->cqHead = (unsigned *)(queues + params.cq_off.head);
+    ring->cqTail = (unsigned *)(queues + params.cq_off.tail);
+    ring->cqMask = (unsigned *)(queues + params.cq_off.ring_mask);
+    ring->sqes = (struct io_uring_sqe *)sqes;
+    ring->cqes = (struct io_uring_cqe *)(queues + params.cq_off.cqes);
+    ring->queues = queues;
+    ring->queuesSize = queuesSize;
+    ring->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->pending = 0;
+    ring->prefetchedCount = 0;
+    ring->nextFree = NULL;
+
+    return ring;
+}
+
+/**
+ * The Ring of the Thread
+ *
+ * @return The ring of the calling thread, NULL if io_uring is not available.
+ */
+static IoRing *threadRing(void) {
+    IoRing *ring;
+
+    pthread_once(&ringKeyOnce, createRingKey);
+    if (!ringKeyCreated) {
+        return NULL;
+    }
+
+    ring = (IoRing *)pthread_getspecific(ringKey);
+    if (ring != NULL) {
+        return ring;
+    }
+
+    pthread_mutex_lock(&ringsLock);
+
+    if (freeRings != NULL) {
+        ring = freeRings;
+        freeRings = ring->nextFree;
+    }
+    else if (!ringsUnavailable) {
+        ring = createRing();
+        ringsUnavailable = (ring == NULL);
+    }
+
+    pthread_mutex_unlock(&ringsLock);
+
+    if (ring != NULL && pthread_setspecific(ringKey, ring) != 0) {
+        releaseRing(ring);
+        ring = NULL;
+    }
+
+    return ring;
+}
+
+/**
+ * Prepare an Operation
+ *
+ * @param ring - The ring.
+ * @param opcode - The operation.
+ * @param fd - The file (or directory) descriptor.
+ * @param address - The buffer or path.
+ * @param length - The length of the buffer, the mode or the second directory descriptor.
+ * @param offset - The offset in the file, or the second buffer or path.
+ * @param result - The index of the result of the operation, see completeAll().
+ * @return The operation, for its flags.
+ */
+static struct io_uring_sqe *prepare(IoRing *ring, int opcode, int fd, const void *address, unsigned length, __u64 offset, int result) {
+    unsigned index = (*ring->sqTail + ring->pending) & *ring->sqMask;
+    struct io_uring_sqe *sqe = &ring->sqes[index];
+
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    sqe->opcode = (__u8)opcode;
+    sqe->fd = fd;
+    sqe->addr = (__u64)(unsigned long)address;
+    sqe->len = length;
+    sqe->off = offset;
+    sqe->user_data = (__u64)result;
+
+    ring->sqArray[index] = index;
+    ring->pending++;
+
+    return sqe;
+}
+
+/**
+ * Retire a Ring
+ *
+ * Gives up the ring of the calling thread once the kernel failed it, the files are read and written with stdio from then on.
+ *
+ * @param ring - The ring.
+ */
+static void retireRing(IoRing *ring) {
+
+    dropPrefetched(ring);
+    pthread_setspecific(ringKey, NULL);
+
+    munmap(ring->sqes, ring->sqesSize);
+    munmap(ring->queues, ring->queuesSize);
+    close(ring->fd);
+    free(ring);
+
+    pthread_mutex_lock(&ringsLock);
+    ringsUnavailable = True;
+    pthread_mutex_unlock(&ringsLock);
+}
+
+/**
+ * Reap the Completions
+ *
+ * @param ring - The ring.
+ * @param results - Receives the result of every completed operation.
+ * @return The number of operations completed.
+ */
+static unsigned reapCompletions(IoRing *ring, int *results) {
+    struct io_uring_cqe *cqe;
+    unsigned head = *ring->cqHead;
+    unsigned completed = 0;
+
+    while (head != __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE)) {
+        cqe = &ring->cqes[head & *ring->cqMask];
+        results[cqe->user_data] = cqe->res;
+        head++;
+        completed++;
+    }
+    __atomic_store_n(ring->cqHead, head, __ATOMIC_RELEASE);
+
+    return completed;
+}
+
+/**
+ * Complete All Operations
+ *
+ * Submits the prepared operations and waits for all of them, with a single system call unless interrupted.
+ * When the kernel fails the ring, the operations it took are waited for (they use the buffers of the caller)
+ * and the ring is retired, the operations it did not take are left with -ECANCELED.
+ *
+ * @param ring - The ring.
+ * @param results - Receives the result of every operation (the return value of its system call or -errno).
+ * @return True if all the operations completed, False if the ring was retired.
+ */
+static bool completeAll(IoRing *ring, int *results) {
+    struct pollfd completions;
+    unsigned count = ring->pending;
+    unsigned unsubmitted = ring->pending;
+    unsigned completed = 0;
+    unsigned i;
+    long entered;
+    int ready;
+
+    for (i = 0; i < count; i++) {
+        results[ring->sqes[(*ring->sqTail + i) & *ring->sqMask].user_data] = -ECANCELED;
+    }
+
+    __atomic_store_n(ring->sqTail, *ring->sqTail + count, __ATOMIC_RELEASE);
+    ring->pending = 0;
+
+    while (completed < count) {
+        entered = syscall(__NR_io_uring_enter, ring->fd, unsubmitted, count - completed, IORING_ENTER_GETEVENTS, NULL, 0);
+
+        if (entered >= 0) {
+            unsubmitted -= (unsigned)entered;
+        }
+        else if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            break;
+        }
+
+        completed += reapCompletions(ring, results);
+    }
+
+    if (completed == count) {
+        return True;
+    }
+
+    /* The ring signals completions on its descriptor, a wait that times out leaves the rest to the kernel's cancelling on close */
+    completions.fd = ring->fd;
+    completions.events = POLLIN;
+    while (completed < count - unsubmitted) {
+        ready = poll(&completions, 1, IO_RING_DRAIN_TIMEOUT);
+
+        if (ready == 0 || (ready < 0 && errno != EINTR)) {
+            break;
+        }
+
+        completed += reapCompletions(ring, results);
+    }
+
+    retireRing(ring);
+
+    return False;
+}
+
+/**
+ * Read Files Together
+ *
+ * Opens (and looks up the size of) all the files with one system call, then reads and closes all of them with another.
+ *
+ * @param fileNames - The names of the files.
+ * @param count - The number of files, at most READ_AHEAD_FILES.
+ * @param files - Receives the contents of the files, NULL for a file that could not be read.
+ * @return True if the files were read with io_uring, False if it is not available (the files are left unread).
+ */
+static bool readTogether(const char **fileNames, int count, PrefetchedFile *files) {
+    IoRing *ring = threadRing();
+    struct statx sizes[READ_AHEAD_FILES];
+    int opened[2 * READ_AHEAD_FILES];
+    int results[2 * READ_AHEAD_FILES];
+    struct io_uring_sqe *sqe;
+    bool ringFailed;
+    int i;
+
+    if (ring == NULL) {
+        return False;
+    }
+
+    for (i = 0; i < count; i++) {
+        prepare(ring, IORING_OP_OPENAT, currentDirectory(), fileNames[i], 0, 0, 2 * i)->open_flags = O_RDONLY | O_CLOEXEC;
+        prepare(ring, IORING_OP_STATX, currentDirectory(), fileNames[i], STATX_TYPE | STATX_SIZE, (__u64)(unsigned long)&sizes[i], 2 * i + 1);
+    }
+
+    if (!completeAll(ring, opened)) {
+        for (i = 0; i < count; i++) {
+            if (opened[2 * i] >= 0) {
+                close(opened[2 * i]);
+            }
+        }
+        return False;
+    }
+
+    for (i = 0; i < count; i++) {
+        files[i].data = NULL;
+        files[i].length = 0;
+
+        if (opened[2 * i] < 0) {
+            continue;
+        }
+
+        /* Only a regular file has a size to read at once, the rest are left to stdio */
+        if (opened[2 * i + 1] == 0 && (sizes[i].stx_mode & S_IFMT) == S_IFREG && sizes[i].stx_size < (__u64)INT_MAX) {
+            files[i].length = (size_t)sizes[i].stx_size;
+            files[i].data = (char *)malloc(files[i].length + 1);
+
+            if (files[i].data == NULL) {
+                memory_allocation_failed();
+            }
+
+            sqe = prepare(ring, IORING_OP_READ, opened[2 * i], files[i].data, (unsigned)files[i].length, 0, 2 * i);
+            sqe->flags |= IOSQE_IO_LINK;
+        }
+
+        prepare(ring, IORING_OP_CLOSE, opened[2 * i], NULL, 0, 0, 2 * i + 1);
+    }
+    ringFailed = !completeAll(ring, results);
+
+    for (i = 0; i < count; i++) {
+
+        if (opened[2 * i] < 0) {
+            continue;
+        }
+
+        /* A short read breaks the link, the file is closed here */
+        if (results[2 * i + 1] == -ECANCELED) {
+            close(opened[2 * i]);
+        }
+
+        if (files[i].data != NULL && (ringFailed || results[2 * i] != (int)files[i].length)) {
+            free(files[i].data);
+            files[i].data = NULL;
+        }
+    }
+
+    return !ringFailed;
+}
+
+/**
+ * Write the Rest of a File
+ *
+ * Finishes a write the kernel did not finish, because it was cut short or its link was broken.
+ *
+ * @param fd - The file.
+ * @param output - The output file.
+ * @param written - The result of the write so far.
+ * @return True if the whole file was written.
+ */
+static bool writeRest(int fd, FileWrite *output, int written) {
+    ssize_t result;
+    size_t done;
+
+    if (written < 0 && written != -ECANCELED) {
+        errno = -written;
+        return False;
+    }
+
+    for (done = (written < 0 ? 0 : (size_t)written); done < output->length; done += (size_t)result) {
+        result = pwrite(fd, output->data + done, output->length - done, (off_t)done);
+
+        if (result < 0) {
+            if (errno == EINTR) {
+                result = 0;
+                continue;
+            }
+            return False;
+        }
+    }
+
+    return True;
+}
+
+/**
+ * Write Files Together
+ *
+ * Opens the temporary files (and removes the files to remove) with one system call, then writes, closes and renames
+ * all of them with another. The second call runs as a single chain, so the files are renamed in order.
+ *
+ * @param batch - The batch.
+ * @return True if the files were written with io_uring, False if it is not available (the batch is left to stdio).
+ */
+static bool writeTogether(FileBatch *batch) {
+    IoRing *ring = threadRing();
+    int opened[FILE_BATCH_SIZE];
+    int results[3 * FILE_BATCH_SIZE];
+    struct io_uring_sqe *sqe = NULL;
+    FileWrite *output;
+    int fd;
+    int i;
+
+    if (ring == NULL) {
+        return False;
+    }
+
+    for (i = 0; i < batch->count; i++) {
+        output = &batch->writes[i];
+
+        if (output->data == NULL) {
+            prepare(ring, IORING_OP_UNLINKAT, currentDirectory(), output->fileName, 0, 0, i);
+        }
+        else {
+            temporaryFileNameFor(output->fileName, output->temporaryFileName);
+            prepare(ring, IORING_OP_OPENAT, currentDirectory(), output->temporaryFileName, 0666, 0, i)->open_flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+        }
+    }
+
+    if (!completeAll(ring, opened)) {
+        for (i = 0; i < batch->count; i++) {
+            if (batch->writes[i].data != NULL && opened[i] >= 0) {
+                close(opened[i]);
+                remove_file(batch->writes[i].temporaryFileName);
+            }
+        }
+        return False;
+    }
+
+    for (i = 0; i < batch->count; i++) {
+        output = &batch->writes[i];
+
+        if (output->data == NULL || opened[i] < 0) {
+            continue;
+        }
+
+        prepare(ring, IORING_OP_WRITE, opened[i], output->data, (unsigned)output->length, 0, 3 * i)->flags |= IOSQE_IO_LINK;
+        prepare(ring, IORING_OP_CLOSE, opened[i], NULL, 0, 0, 3 * i + 1)->flags |= IOSQE_IO_LINK;
+        sqe = prepare(ring, IORING_OP_RENAMEAT, currentDirectory(), output->temporaryFileName, (unsigned)currentDirectory(), (__u64)(unsigned long)output->fileName, 3 * i + 2);
+        sqe->flags |= IOSQE_IO_LINK;
+    }
+
+    /* The whole batch is written again with stdio when the ring fails, over the files the chain already renamed */
+    if (sqe != NULL) {
+        sqe->flags &= ~IOSQE_IO_LINK;
+
+        if (!completeAll(ring, results)) {
+            for (i = 0; i < batch->count; i++) {
+                if (batch->writes[i].data == NULL || opened[i] < 0 || results[3 * i + 2] == 0) {
+                    continue;
+                }
+                if (results[3 * i + 1] == -ECANCELED) {
+                    close(opened[i]);
+                }
+                remove_file(batch->writes[i].temporaryFileName);
+            }
+            return False;
+        }
+    }
+
+    /* Whatever the chain left undone after a failure is done here, in the same order */
+    for (i = 0; i < batch->count; i++) {
+        output = &batch->writes[i];
+
+        if (output->data == NULL) {
+            continue;
+        }
+
+        fd = opened[i];
+        if (fd < 0) {
+            errno = -fd;
+            console_perror(FILE_OPEN_ERROR);
+            continue;
+        }
+
+        if (!writeRest(fd, output, results[3 * i])) {
+            console_perror(FILE_WRITE_ERROR);
+            if (results[3 * i + 1] == -ECANCELED) {
+                close(fd);
+            }
+            remove_file(output->temporaryFileName);
+            continue;
+        }
+
+        if (results[3 * i + 1] == -ECANCELED) {
+            results[3 * i + 1] = (close(fd) == 0 ? 0 : -errno);
+        }
+
+        if (results[3 * i + 1] < 0) {
+            errno = -results[3 * i + 1];
+            console_perror(FILE_WRITE_ERROR);
+            remove_file(output->temporaryFileName);
+            continue;
+        }
+
+        if (results[3 * i + 2] == -ECANCELED) {
+            commitTemporaryFile(output->temporaryFileName, output->fileName);
+        }
+        else if (results[3 * i + 2] < 0) {
+            errno = -results[3 * i + 2];
+            console_perror(FILE_RENAME_ERROR);
+            remove_file(output->temporaryFileName);
+        }
+    }
+
+    return True;
+}
+
+#else
+
+static bool writeTogether(FileBatch *batch) {
+    return False;
+}
+
+#endif
+
+char *read_file(const char *fileName, size_t *length) {
+#ifdef USE_IO_URING
+    IoRing *ring = threadRing();
+    PrefetchedFile file;
+    int i;
+
+    if (ring != NULL) {
+        for (i = 0; i < ring->prefetchedCount; i++) {
+            if (strcmp(ring->prefetched[i].fileName, fileName) == 0) {
+                file = ring->prefetched[i];
+                ring->prefetched[i] = ring->prefetched[--ring->prefetchedCount];
+
+                *length = file.length;
+                return file.data;
+            }
+        }
+
+        /* A file that cannot be read is read again with stdio, for its error message */
+        if (readTogether(&fileName, 1, &file) && file.data != NULL) {
+            *length = file.length;
+            return file.data;
+        }
+    }
+#endif
+
+    return readStream(fileName, length);
+}
+
+void prefetch_files(char fileNames[][MAX_LINE_LENGTH], int count) {
+#ifdef USE_IO_URING
+    IoRing *ring = threadRing();
+    PrefetchedFile files[READ_AHEAD_FILES];
+    const char *names[READ_AHEAD_FILES];
+    int i;
+
+    if (ring == NULL) {
+        return;
+    }
+
+    dropPrefetched(ring);
+
+    for (i = 0; i < count; i++) {
+        names[i] = fileNames[i];
+    }
+
+    /* The files are read by read_file() when the ring failed, it may be gone */
+    if (!readTogether(names, count, files)) {
+        return;
+    }
+
+    for (i = 0; i < count; i++) {
+        if (files[i].data != NULL) {
+            strcpy(files[i].fileName, fileNames[i]);
+            ring->prefetched[ring->prefetchedCount++] = files[i];
+        }
+    }
+#endif
+}
+
+void init_file_batch(FileBatch *batch) {
+    batch->count = 0;
+}
+
+/**
+ * Add a File to a Batch
+ *
+ * @param batch - The batch, submitted first when full.
+ * @param fileName - The name of the output file.
+ * @param data - The contents, NULL to remove the file.
+ * @param length - The length of the contents.
+ */
+static void addFile(FileBatch *batch, const char *fileName, char *data, size_t length) {
+    FileWrite *output;
+
+    if (batch->count == FILE_BATCH_SIZE) {
+        submit_file_batch(batch);
+    }
+
+    output = &batch->writes[batch->count++];
+    sprintf(output->fileName, "%.*s", MAX_LINE_LENGTH - 1, fileName);
+    output->data = data;
+    output->length = length;
+}
+
+void batch_write_file(FileBatch *batch, const char *fileName, char *data, size_t length) {
+    addFile(batch, fileName, data, length);
+}
+
+void batch_remove_file(FileBatch *batch, const char *fileName) {
+    addFile(batch, fileName, NULL, 0);
+}
+
+void submit_file_batch(FileBatch *batch) {
+    int i;
+
+    if (!writeTogether(batch)) {
+        for (i = 0; i < batch->count; i++) {
+            if (batch->writes[i].data != NULL) {
+                writeStream(&batch->writes[i]);
+            }
+            else {
+                removeOutputFile(batch->writes[i].fileName);
+            }
+        }
+    }
+
+    for (i = 0; i < batch->count; i++) {
+        free(batch->writes[i].data);
+    }
+    batch->count = 0;
+}
@@ -0,0 +1,139 @@
+#ifndef _FILE_IO_H
+#define _FILE_IO_H
+
+#include <stddef.h>
+
+struct stat;
+
+/* Expects global_definitions.h to be included first */
+
+/* ------------------------------------ Static Definitions ------------------------------------ */
+
+/* Output files written together by one submit_file_batch() call, a full batch is submitted before the next file is added */
+#define FILE_BATCH_SIZE 4
+
+/* Upcoming input files read together by one prefetch_files() call */
+#define READ_AHEAD_FILES 8
+
+/* Operations in flight on an io_uring at the same time, enough for a full batch (3 for every file) or a full read ahead (2 for every file) */
+#define IO_RING_ENTRIES 32
+
+/* Milliseconds to wait for the operations a failed io_uring still runs before giving it up */
+#define IO_RING_DRAIN_TIMEOUT 5000
+
+#define FILE_RENAME_ERROR "Error renaming file"
+
+
+/* ------------------------------------ Data Types ------------------------------------ */
+
+/* Defines an output file of a batch, written to a temporary file and renamed over the output file */
+typedef struct FileWrite
+{
+    char fileName[MAX_LINE_LENGTH];
+    char temporaryFileName[MAX_TEMP_FILE_NAME_LENGTH];
+    char *data;                 /* Owned by the batch, NULL to remove the output file (if exists) instead */
+    size_t length;
+
+} FileWrite;
+
+/* Defines output files written together, in the order they were added */
+typedef struct FileBatch
+{
+    FileWrite writes[FILE_BATCH_SIZE];
+    int count;
+
+} FileBatch;
+
+
+/* ------------------------------------ Functions ------------------------------------ */
+
+/** set_file_directory
+ *  @brief Makes the relative file names of the calling thread relative to a directory instead of the working directory,
+ *         so threads can read and write the files of different directories at the same time (as the daemon does for
+ *         its requests). Every file the assembler reads or writes is opened through the functions below.
+ *  @param directory A descriptor of the directory, kept open while it is set. NULL for the working directory.
+ *  @return The previous directory of the thread.
+ */
+const int *set_file_directory(const int *directory);
+
+/** open_file
+ *  @brief open() relative to the directory of the calling thread, see set_file_directory.
+ *  @param fileName The name of the file.
+ *  @param flags The flags of open(), a created file gets the permissions 0666 (less the umask).
+ *  @return The descriptor, -1 on failure (with errno).
+ */
+int open_file(const char *fileName, int flags);
+
+/** stat_file
+ *  @brief stat() relative to the directory of the calling thread, see set_file_directory.
+ *  @param fileName The name of the file.
+ *  @param status Receives the status of the file.
+ *  @return 0 on success, -1 on failure (with errno).
+ */
+int stat_file(const char *fileName, struct stat *status);
+
+/** rename_file
+ *  @brief rename() relative to the directory of the calling thread, see set_file_directory.
+ *  @param oldName The name of the file.
+ *  @param newName The new name of the file.
+ *  @return 0 on success, -1 on failure (with errno).
+ */
+int rename_file(const char *oldName, const char *newName);
+
+/** remove_file
+ *  @brief remove() of a file relative to the directory of the calling thread, see set_file_directory.
+ *  @param fileName The name of the file.
+ *  @return 0 on success, -1 on failure (with errno).
+ */
+int remove_file(const char *fileName);
+
+/** read_file
+ *  @brief Reads a whole file into memory, taking it from the files prefetched by this thread when it is one of them.
+ *         The errors are reported with console_perror().
+ *  @param fileName The name of the file.
+ *  @param length Receives the length of the file.
+ *  @return The contents, allocated with malloc() with room for a terminating '\0' after them, NULL if the file cannot be read.
+ */
+char *read_file(const char *fileName, size_t *length);
+
+/** prefetch_files
+ *  @brief Reads upcoming input files of this thread together, so the read_file() calls that follow find them in memory.
+ *         Files that cannot be read are left to read_file() (and its error message). Files prefetched before and not
+ *         read yet are dropped. Does nothing without io_uring.
+ *  @param fileNames The names of the files.
+ *  @param count The number of files, at most READ_AHEAD_FILES.
+ */
+void prefetch_files(char fileNames[][MAX_LINE_LENGTH], int count);
+
+/** init_file_batch
+ *  @brief Prepares an empty batch.
+ *  @param batch The batch.
+ */
+void init_file_batch(FileBatch *batch);
+
+/** batch_write_file
+ *  @brief Adds an output file to a batch.
+ *  @param batch The batch.
+ *  @param fileName The name of the output file.
+ *  @param data The contents, allocated with malloc() and owned by the batch from now on.
+ *  @param length The length of the contents.
+ */
+void batch_write_file(FileBatch *batch, const char *fileName, char *data, size_t length);
+
+/** batch_remove_file
+ *  @brief Adds the removal of an output file left over from a previous run (if exists) to a batch.
+ *  @param batch The batch.
+ *  @param fileName The name of the output file.
+ */
+void batch_remove_file(FileBatch *batch, const char *fileName);
+
+/** submit_file_batch
+ *  @brief Writes and removes the files of a batch, with a few io_uring system calls for the whole batch when the
+ *         assembler is built with IO_URING=1 and the kernel supports it, one file after another otherwise.
+ *         Either way the output files are replaced in the order they were added, each one only once it was fully written.
+ *         The errors are reported with console_perror(). The batch is empty again afterwards.
+ *  @param batch The batch.
+ */
+void submit_file_batch(FileBatch *batch);
+
+#endif
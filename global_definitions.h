@@ -10,6 +10,9 @@
 
 #define MAX_LINE_LENGTH 81
 
+/* Room for an output file name plus the temporary file suffix (".<pid>.<sequence>.tmp") used while it is being written */
+#define MAX_TEMP_FILE_NAME_LENGTH (MAX_LINE_LENGTH + 32)
+
 /* The max length in 31 but in order to include /0 we set it to 32*/
 #define MAX_LABEL_LENGTH 32
 
@@ -18,6 +21,16 @@
 
 #define STARTING_MEMORY_LOCATION 100
 
+/* The values a data word holds, as a signed or as an unsigned 14 bit number */
+#define MIN_WORD_VALUE (-8192)
+#define MAX_WORD_VALUE 16383
+
+/* The bits of a memory word, the segments keep the words as ints */
+#define WORD_MASK 0x3FFF
+
+/* The registers r0 ... r7 */
+#define REGISTER_COUNT 8
+
 
 /* ------------------------------------ Data Types ------------------------------------ */
 
@@ -32,6 +45,8 @@ typedef enum booleans {
 
 #define EXECUTION_FORMAT_ERROR "Error while executing the program. Invalid format."
 #define FILE_OPEN_ERROR "Error while opening the file."
+#define FILE_WRITE_ERROR "Error while writing the file."
+#define FILE_NAME_LENGTH_ERROR "Error while opening the file. The file name is too long:"
 #define MEMORY_ALLOCATION_ERROR "Error while allocating memory."
 
 
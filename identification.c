@@ -5,14 +5,26 @@
 #include "global_definitions.h"
 #include "utility_functions.h"
 #include "identification.h"
+#include "line_scanner.h"
+#include "keywords.h"
+#include "parallel.h"
+#include "diagnostics.h"
+#include "include_file.h"
+
+/* Initial capacity of the operands label names, it grows by doubling */
+#define INITIAL_SYMBOLS_CAPACITY 256
+
+/* Initial capacity of a segment (in words), it grows by doubling */
+#define INITIAL_SEGMENT_CAPACITY 256
 
 /**
- * Clean a command by removing leading whitespaces and replacing
- * consecutive spaces or tabs with a single space.
+ * Collapse White Spaces
+ *
+ * Removes leading whitespaces and replaces consecutive spaces or tabs with a single space.
  *
  * @param line - The command string to be cleaned (modified in place).
  */
-void cleanCommand(char *line) {
+static void collapseWhiteSpaces(char *line) {
     int i, j;
     int leadingSpace = 1;  /* Flag to track leading spaces */
     int insideQuotes = 0; /* Flag to track if inside quotes */
@@ -46,6 +58,48 @@ void cleanCommand(char *line) {
     line[j] = '\0';
 }
 
+/**
+ * Clean Scanned Command
+ *
+ * Cleans a line that was already scanned and leaves the scan describing the cleaned line.
+ * Most lines only carry trailing whitespace (at least the newline), those are cut in place without rewriting the line.
+ *
+ * @param line - The command string to be cleaned (modified in place).
+ * @param scan - The scan of the line, updated to match the cleaned line.
+ */
+static void cleanScannedCommand(char *line, LineScan *scan) {
+
+    if (scan->firstNonSpace > 0 || (scan->firstIrregularSpace >= 0 && scan->firstIrregularSpace < scan->lastNonSpace)) {
+        collapseWhiteSpaces(line);
+        scanLine(line, scan);
+        return;
+    }
+
+    /* Only trailing whitespace to drop */
+    scan->length = scan->lastNonSpace + 1;
+    line[scan->length] = '\0';
+
+    if (scan->firstSpace >= scan->length) {
+        scan->firstSpace = -1;
+    }
+    if (scan->firstIrregularSpace >= scan->length) {
+        scan->firstIrregularSpace = -1;
+    }
+}
+
+/**
+ * Clean a command by removing leading whitespaces and replacing
+ * consecutive spaces or tabs with a single space.
+ *
+ * @param line - The command string to be cleaned (modified in place).
+ */
+void cleanCommand(char *line) {
+    LineScan scan;
+
+    scanLine(line, &scan);
+    cleanScannedCommand(line, &scan);
+}
+
 bool isEmpty(char *line) {
     int i;
     for (i = 0; line[i] != '\0'; i++) {
@@ -61,52 +115,14 @@ bool isComment(char *line) {
 }
 
 bool isDirective(char *line) {
-    char directive[MAX_LINE_LENGTH];
-    int i = 0;
-
-    /* Skip leading whitespaces */
-    while (*line && (*line == ' ' || *line == '\t')) {
-        line++;
-    }
-
-    /* Check for a label */
-    while (*line) {
-        if (*line == ':') {
-            line++;  /* Skip the colon */
-            break;
-        } else if (*line == ' ' || *line == '\t' || *line == '.') {
-            break;  /* End of label, no colon found */
-        }
-        line++;
-    }
-
-    /* Skip whitespaces after the label */
-    while (*line && (*line == ' ' || *line == '\t')) {
-        line++;
-    }
-
-    /* Check for directive starting with '.' */
-    if (*line == '.') {
-        /* Extract the directive name */
-        line++;  /* Skip the '.' */
-        while (*line && (*line != ' ' && *line != '\t' && *line != '\n')) {
-            directive[i++] = *line++;
-        }
-        directive[i] = '\0';
-
-        /* Compare directive name */
-        if (strcmp(directive, "data") == 0 || strcmp(directive, "string") == 0 || strcmp(directive, "entry") == 0 || strcmp(directive, "extern") == 0) {
-            return True;
-        }
-    }
-
-    return False;
+    return identifyDirective(line) != UNDEFINED_DIRECTIVE;
 }
 
 CommandType identifyDirective(char *line) {
 
     char directive[MAX_LINE_LENGTH];
     int i = 0;
+    Keyword keyword;
 
     /* Skip leading whitespaces */
     while (*line && (*line == ' ' || *line == '\t')) {
@@ -138,16 +154,10 @@ CommandType identifyDirective(char *line) {
         }
         directive[i] = '\0';
 
-
-        /* Compare directive name */
-        if (strcmp(directive, "data") == 0) {
-            return DATA_DIRECTIVE;
-        } else if (strcmp(directive, "string") == 0) {
-            return STRING_DIRECTIVE;
-        } else if (strcmp(directive, "entry") == 0) {
-            return ENTRY_DIRECTIVE;
-        } else if (strcmp(directive, "extern") == 0) {
-            return EXTERN_DIRECTIVE;
+        /* Recognize the directive name, .define is not a directive */
+        keyword = find_keyword(directive, i);
+        if (keyword.kind == DIRECTIVE_KEYWORD && keyword.value != CONSTANT) {
+            return (CommandType)keyword.value;
         }
     }
 
@@ -176,7 +186,7 @@ void removeLabel(char *line) {
     }
 }
 
-bool isInstruction(char *line, HashTable* instructionsHash) {
+bool isInstruction(char *line) {
 
     char instruction[MAX_LINE_LENGTH];
     char ** splitedLine;                    /* Array to store the splited line */
@@ -202,15 +212,15 @@ bool isInstruction(char *line, HashTable* instructionsHash) {
     freeStringArray(splitedLine, numberOfElements);
 
     /* Compare instruction name */
-    if (existsInHash(instructionsHash, instruction)) {
+    if (find_keyword(instruction, strlen(instruction)).kind == INSTRUCTION_KEYWORD) {
         return True;
     }
 
     return False;
 }
 
-CommandType identifyInstruction(char *line, HashTable* instructionsHash){
-    if (isInstruction(line, instructionsHash)) {
+CommandType identifyInstruction(char *line){
+    if (isInstruction(line)) {
         return INSTRUCTION;
     } else {
         return UNDEFINED;
@@ -222,6 +232,7 @@ bool isConstant(char *line) {
 
     char constant[MAX_LINE_LENGTH];
     int i = 0;
+    Keyword keyword;
 
     /* Skip leading whitespaces */
     while (*line && (*line == ' ' || *line == '\t')) {
@@ -254,7 +265,8 @@ bool isConstant(char *line) {
         constant[i] = '\0';
 
         /* Compare constant name */
-        if (strcmp(constant, "define") == 0) {
+        keyword = find_keyword(constant, i);
+        if (keyword.kind == DIRECTIVE_KEYWORD && keyword.value == CONSTANT) {
             return True;
         }
     }
@@ -263,119 +275,557 @@ bool isConstant(char *line) {
 }
 
 
-CommandType identifyCommandType(char *line, HashTable* instructionsHash) {
+/**
+ * Identify Dot Command
+ *
+ * Identifies the directive or constant definition that follows the optional label of a cleaned line,
+ * the same way isDirective(), identifyDirective() and isConstant() do.
+ *
+ * @param line - The cleaned line.
+ * @param scan - The scan of the cleaned line.
+ * @return The directive type, CONSTANT for .define, or UNDEFINED when the line holds neither.
+ */
+static CommandType identifyDotCommand(char *line, LineScan *scan) {
+    int statement = scan->length;   /* Where the label (if any) ends */
+    int nameLength;
+    char *name;
+    Keyword keyword;
+
+    if (scan->dot < 0) {
+        return UNDEFINED;
+    }
 
-    cleanCommand(line);
+    /* The label ends at the first space, dot or colon (the colon itself is skipped) */
+    if (scan->firstSpace >= 0 && scan->firstSpace < statement) {
+        statement = scan->firstSpace;
+    }
+    if (scan->dot < statement) {
+        statement = scan->dot;
+    }
+    if (scan->colon >= 0 && scan->colon < statement) {
+        statement = scan->colon + 1;
+    }
+
+    /* Skip whitespaces after the label */
+    while (line[statement] == ' ' || line[statement] == '\t') {
+        statement++;
+    }
+
+    if (line[statement] != '.') {
+        return UNDEFINED;
+    }
+
+    name = line + statement + 1;
+    nameLength = strcspn(name, " \t\n");
+
+    /* The value of a directive keyword is its type (CONSTANT for .define) */
+    keyword = find_keyword(name, nameLength);
+    if (keyword.kind == DIRECTIVE_KEYWORD) {
+        return (CommandType)keyword.value;
+    }
+
+    return UNDEFINED;
+}
+
+/**
+ * Is Scanned Instruction
+ *
+ * Checks whether the operation word of a cleaned line (the first word, or the second one after a label) is a known instruction.
+ *
+ * @param line - The cleaned line.
+ * @param scan - The scan of the cleaned line.
+ * @return True if the line holds an instruction, False otherwise.
+ */
+static bool isScannedInstruction(char *line, LineScan *scan) {
+    int start = 0;
+    int length;
+
+    /* A label ends with a colon before the first space, the instruction is the next word */
+    if (scan->colon >= 0 && (scan->firstSpace < 0 || scan->colon < scan->firstSpace)) {
+        if (scan->firstSpace < 0) {
+            return False;
+        }
+        start = scan->firstSpace;
+        while (line[start] == ' ') {
+            start++;
+        }
+    }
 
-    if (isEmpty(line)) {
+    length = strcspn(line + start, " ");
+
+    return find_keyword(line + start, length).kind == INSTRUCTION_KEYWORD;
+}
+
+CommandType identifyCommandType(char *line) {
+    LineScan scan;
+    CommandType dotCommand;
+
+    /* One scan finds everything the classification below looks at */
+    scanLine(line, &scan);
+    cleanScannedCommand(line, &scan);
+
+    if (scan.firstNonSpace < 0) {
         return EMPTY;
-    } else if (isComment(line)) {
+    } else if (scan.comment == 0) {
         return COMMENT;
-    } else if (isDirective(line)) {
-        return identifyDirective(line);
-    }  else if (isConstant(line)) {
-        return CONSTANT;
-    } else if (isInstruction(line, instructionsHash)) {
+    }
+
+    dotCommand = identifyDotCommand(line, &scan);
+    if (dotCommand != UNDEFINED) {
+        return dotCommand;
+    } else if (isScannedInstruction(line, &scan)) {
         return INSTRUCTION;
     } else {
         return UNDEFINED;
     }
 }
 
-AddressingMode identifyAddressingMode(char *operand, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash) {
+/* Defines the work shared by the threads of classify_source_lines */
+typedef struct ClassificationContext {
+    SourceBuffer *source;
+    LineTable *lines;
+} ClassificationContext;
 
-    char **splitedLine;                    /* Array to store the splited line */
-    int numberOfElements = 0;              /* Reset the elemnts number - for the string spliter counter */
-    char * directiveIndex = NULL;
-    char * constantValueString = NULL;
+/**
+ * Classify Line Chunk
+ *
+ * Cleans and classifies the lines [first, last). Every line is written to its own slot of the text buffer,
+ * so chunks never touch each other's memory.
+ *
+ * @param context - The ClassificationContext.
+ * @param first - The first line of the chunk.
+ * @param last - One past the last line of the chunk.
+ */
+static void classifyLineChunk(void *context, int first, int last) {
+    ClassificationContext *classification = (ClassificationContext *)context;
+    SourceBuffer *source = classification->source;
+    LineTable *lines = classification->lines;
+    LineRecord *record;
+    CommandType commandType;
+    char line[MAX_LINE_LENGTH * 2];
+    char *text;
+    int i;
 
-    cleanCommand(operand);
+    for (i = first; i < last; i++) {
+        record = &lines->records[i];
 
-    /* If the operand starts with a '#' suspect immediate addressing mode */
-    if (operand[0] == '#') {
-        splitedLine = splitString(operand, "#", &numberOfElements);
+        /* A line too long for the checks is not classified, the validation reports it and skips it */
+        copy_source_line(source, i, line, sizeof(line));
+        if (strlen(line) > MAX_LINE_LENGTH - 1) {
+            commandType = UNDEFINED;
+        }
+        else {
+            commandType = identifyCommandType(line);
+        }
 
-        if(isValidInteger(splitedLine[0])){
-            freeStringArray(splitedLine, numberOfElements);
-            return IMMEDIATE;
+        /* The cleaned line is never longer than the original one, so line i fits in the slot after its offset */
+        lines->textOffsets[i] = source->lineStarts[i] + i;
+        text = LINE_TEXT(lines, i);
+        strcpy(text, line);
+
+        lines->kinds[i] = (unsigned char)commandType;
+        lines->labelLengths[i] = 0;
+        lines->wordCounts[i] = 0;
+        lines->addresses[i] = 0;
+        lines->firstWords[i] = 0;
+
+        record->dataOffset = 0;
+        record->instruction = UNDEFINED_INSTRUCTION;
+        record->operandCount = 0;
+        record->include = 0;
+
+        /* The lines that give their label an address, the chunks define their labels at the same time */
+        if ((commandType == INSTRUCTION || commandType == DATA_DIRECTIVE || commandType == STRING_DIRECTIVE || commandType == INCLUDE_DIRECTIVE) && hasLabel(text)) {
+            lines->labelLengths[i] = (unsigned short)(strchr(text, ':') - text);
+            define_symbol(&lines->labels, text, lines->labelLengths[i], i);
         }
+    }
+}
+
+/**
+ * Init Segment
+ *
+ * @param segment - The segment to allocate, empty.
+ */
+static void initSegment(Segment *segment) {
+
+    segment->length = 0;
+    segment->capacity = INITIAL_SEGMENT_CAPACITY;
+    segment->words = malloc(segment->capacity * sizeof(int));
+
+    if (segment->words == NULL) {
+        memory_allocation_failed();
+    }
+}
+
+LineTable *create_line_table(int lineCount, int textLength) {
+    LineTable *lines = malloc(sizeof(LineTable));
+
+    if (lines == NULL) {
+        memory_allocation_failed();
+    }
+
+    lines->count = lineCount;
+    lines->kinds = malloc(lineCount + 1);
+    lines->labelLengths = malloc((lineCount + 1) * sizeof(unsigned short));
+    lines->wordCounts = malloc((lineCount + 1) * sizeof(int));
+    lines->addresses = malloc((lineCount + 1) * sizeof(int));
+    lines->firstWords = malloc((lineCount + 1) * sizeof(unsigned short));
+    lines->textOffsets = malloc((lineCount + 1) * sizeof(int));
+    lines->records = malloc((lineCount + 1) * sizeof(LineRecord));
+    lines->text = malloc(textLength + 1);
+
+    /* Filled by the validation of the instructions */
+    lines->symbolsLength = 0;
+    lines->symbolsCapacity = INITIAL_SYMBOLS_CAPACITY;
+    lines->symbols = malloc(lines->symbolsCapacity);
+
+    /* Filled by the classification */
+    init_symbol_table(&lines->labels, lineCount);
+
+    /* Filled by the validation of the include lines */
+    lines->includes = NULL;
+    lines->includeCount = 0;
+    lines->includeCapacity = 0;
+
+    /* Filled by the code generation */
+    initSegment(&lines->code);
+    initSegment(&lines->data);
+
+    if (lines->kinds == NULL || lines->labelLengths == NULL || lines->wordCounts == NULL || lines->addresses == NULL ||
+        lines->firstWords == NULL || lines->textOffsets == NULL || lines->records == NULL || lines->text == NULL || lines->symbols == NULL) {
+        memory_allocation_failed();
+    }
 
-        else if(ht_search(symbolsLabelsValuesHash, splitedLine[0]) != NULL && strcmp(ht_get_type(symbolsLabelsValuesHash, splitedLine[0]), "constant") == 0){
-            freeStringArray(splitedLine, numberOfElements);
-            return IMMEDIATE;
+    return lines;
+}
+
+LineTable *classify_source_lines(SourceBuffer *source) {
+    ClassificationContext context;
+
+    /* Room for every line plus its terminating '\0' */
+    LineTable *lines = create_line_table(source->lineCount, source->length + source->lineCount);
+
+    context.source = source;
+    context.lines = lines;
+
+    run_chunks(source->lineCount, MIN_LINES_PER_THREAD, classifyLineChunk, &context);
+
+    return lines;
+}
+
+void free_line_table(LineTable *lines) {
+    unmap_included_files(lines);
+    free_symbol_table(&lines->labels);
+    free(lines->kinds);
+    free(lines->labelLengths);
+    free(lines->wordCounts);
+    free(lines->addresses);
+    free(lines->firstWords);
+    free(lines->textOffsets);
+    free(lines->records);
+    free(lines->text);
+    free(lines->symbols);
+    free(lines->code.words);
+    free(lines->data.words);
+    free(lines);
+}
+
+int *reserve_segment_words(Segment *segment, int count) {
+
+    while (segment->length + count > segment->capacity) {
+        segment->capacity *= 2;
+        segment->words = realloc(segment->words, segment->capacity * sizeof(int));
+
+        if (segment->words == NULL) {
+            memory_allocation_failed();
         }
-        else{
-            freeStringArray(splitedLine, numberOfElements);
+    }
+
+    return segment->words + segment->length;
+}
+
+void append_word(Segment *segment, int word) {
+
+    if (segment->length == segment->capacity) {
+        segment->capacity *= 2;
+        segment->words = realloc(segment->words, segment->capacity * sizeof(int));
+
+        if (segment->words == NULL) {
+            memory_allocation_failed();
+        }
+    }
+
+    segment->words[segment->length++] = word;
+}
+
+/**
+ * Store Symbol
+ *
+ * Keeps the name of a label an operand refers to.
+ *
+ * @param lines - The table that keeps the names.
+ * @param name - The name of the label.
+ * @param length - The length of the name.
+ * @return The offset of the kept name.
+ */
+static int storeSymbol(LineTable *lines, const char *name, int length) {
+    int offset = lines->symbolsLength;
+
+    while (lines->symbolsLength + length + 1 > lines->symbolsCapacity) {
+        lines->symbolsCapacity *= 2;
+        lines->symbols = realloc(lines->symbols, lines->symbolsCapacity);
+
+        if (lines->symbols == NULL) {
+            memory_allocation_failed();
+        }
+    }
+
+    memcpy(lines->symbols + offset, name, length);
+    lines->symbols[offset + length] = '\0';
+    lines->symbolsLength += length + 1;
+
+    return offset;
+}
+
+/**
+ * Has Type
+ *
+ * @param table - The hash table.
+ * @param key - The key to look for.
+ * @param type - The type the key should have.
+ * @return True if the key is in the table with the given type, False otherwise.
+ */
+static bool hasType(HashTable *table, char *key, const char *type) {
+    return ht_search(table, key) != NULL && strcmp(ht_get_type(table, key), type) == 0;
+}
+
+/**
+ * Resolve a Constant
+ *
+ * @param name - The name of the constant.
+ * @param symbolsLabelsValuesHash - The hash table containing the constants.
+ * @param value - Receives the value.
+ * @return True if the name is a constant, False otherwise.
+ */
+static bool resolveConstant(char *name, HashTable *symbolsLabelsValuesHash, int *value) {
+
+    if (hasType(symbolsLabelsValuesHash, name, "constant")) {
+        *value = stringToInt(ht_search(symbolsLabelsValuesHash, name));
+        return True;
+    }
+
+    return False;
+}
+
+/**
+ * Resolve Value
+ *
+ * Reads a number, or the value of a constant.
+ *
+ * @param text - The number or the name of the constant.
+ * @param symbolsLabelsValuesHash - The hash table containing the constants.
+ * @param value - Receives the value.
+ * @return True if the text is a number or a constant, False otherwise.
+ */
+static bool resolveValue(char *text, HashTable *symbolsLabelsValuesHash, int *value) {
+
+    if (isValidInteger(text)) {
+        *value = stringToInt(text);
+        return True;
+    }
+
+    return resolveConstant(text, symbolsLabelsValuesHash, value);
+}
+
+/**
+ * Is a Direct Label
+ *
+ * @param label - The name of the label.
+ * @param symbolsLabelsValuesHash - The hash table containing the labels.
+ * @param entriesExternsHash - The hash table containing the entries and externs.
+ * @return True if an operand made of the name alone is in direct addressing mode.
+ */
+static bool isDirectLabel(char *label, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash) {
+
+    return hasType(symbolsLabelsValuesHash, label, "dataDirective") || hasType(symbolsLabelsValuesHash, label, "stringDirective") || hasType(symbolsLabelsValuesHash, label, "instruction")
+        || hasType(entriesExternsHash, label, "entryDirective") || hasType(entriesExternsHash, label, "externDirective");
+}
+
+/**
+ * Index Mode
+ *
+ * @param label - The name of the label that is indexed.
+ * @param resolved - True if the index is a number or a constant.
+ * @param parsed - The operand, its value is the index.
+ * @param symbolsLabelsValuesHash - The hash table containing the labels.
+ * @param entriesExternsHash - The hash table containing the entries and externs.
+ * @return The addressing mode of the operand.
+ */
+static AddressingMode indexMode(char *label, bool resolved, Operand *parsed, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash) {
+
+    if (hasType(symbolsLabelsValuesHash, label, "dataDirective") || hasType(symbolsLabelsValuesHash, label, "stringDirective")) {
+        if (resolved == False) {
             return UNDEFINED_CONSTANT;
         }
-    /* If there is a use of existing data directive or string directive return direct addressing mode*/
-    } else if ((ht_search(symbolsLabelsValuesHash, operand) != NULL && (strcmp(ht_get_type(symbolsLabelsValuesHash, operand), "dataDirective") == 0 || strcmp(ht_get_type(symbolsLabelsValuesHash, operand), "stringDirective") == 0 || strcmp(ht_get_type(symbolsLabelsValuesHash, operand), "instruction") == 0))
-     || (ht_search(entriesExternsHash, operand) != NULL && ((strcmp(ht_get_type(entriesExternsHash, operand), "entryDirective") == 0) || (strcmp(ht_get_type(entriesExternsHash, operand), "externDirective") == 0)))) {
-        return DIRECT;
+        if (parsed->value < 0 || parsed->value > stringToInt(ht_get_memory_size(symbolsLabelsValuesHash, label)) - 1) {
+            return INDEX_OVERFLOW;
+        }
+        return INDEX;
+    }
 
-    /* If the opernad contains a '[' and a ']' and a valid integer in between suspect index addressing mode */
-    } else if (strchr(operand, '[') != NULL && strchr(operand, ']') != NULL) {
-        splitedLine = splitString(operand, "[", &numberOfElements);
-        removeSubstring(splitedLine[1], "]");
-        
-        if(ht_search(symbolsLabelsValuesHash,splitedLine[0]) != NULL && (strcmp(ht_get_type(symbolsLabelsValuesHash, splitedLine[0]), "dataDirective") == 0 || strcmp(ht_get_type(symbolsLabelsValuesHash, splitedLine[0]), "stringDirective") == 0)){
-            if(isValidInteger(splitedLine[1])){
-                directiveIndex = malloc(14);
-                strcpy(directiveIndex, ht_get_memory_size(symbolsLabelsValuesHash, splitedLine[0]));
-                if(stringToInt(splitedLine[1]) < 0 || stringToInt(splitedLine[1]) > (stringToInt(directiveIndex) -1)){
-                    freeStringArray(splitedLine, numberOfElements);
-                    free(directiveIndex);
-                    return INDEX_OVERFLOW;
-                }
-                freeStringArray(splitedLine, numberOfElements);
-                free(directiveIndex);
-                return INDEX;
-            }
+    if (hasType(entriesExternsHash, label, "externDirective")) {
+        return INDEX;
+    }
 
-            else if (ht_search(symbolsLabelsValuesHash, splitedLine[1]) != NULL && strcmp(ht_get_type(symbolsLabelsValuesHash, splitedLine[1]), "constant") == 0){
+    return UNDEFINED_LABEL;
+}
 
-                directiveIndex = malloc(14);
-                constantValueString = malloc(14);
-                strcpy(directiveIndex, ht_get_memory_size(symbolsLabelsValuesHash, splitedLine[0]));
-                strcpy(constantValueString, ht_search(symbolsLabelsValuesHash, splitedLine[1]));
+/**
+ * Clear an Operand
+ *
+ * @param parsed - The operand.
+ */
+static void clearOperand(Operand *parsed) {
+    parsed->mode = UNDEFINED_ADDRESSING;
+    parsed->registerNumber = 0;
+    parsed->value = 0;
+    parsed->symbol = -1;
+    parsed->isExtern = False;
+}
 
-                if(stringToInt(constantValueString) < 0 || stringToInt(constantValueString) > (stringToInt(directiveIndex) -1)){
-                    freeStringArray(splitedLine, numberOfElements);
-                    free(directiveIndex);
-                    free(constantValueString);
-                    return INDEX_OVERFLOW;
-                }
+/**
+ * Keep the Label of an Operand
+ *
+ * @param parsed - The operand, in direct or index addressing mode.
+ * @param label - The name of the label.
+ * @param length - The length of the name.
+ * @param lines - The table that keeps the label names, NULL to keep none.
+ * @param entriesExternsHash - The hash table containing the entries and externs.
+ */
+static void keepOperandLabel(Operand *parsed, char *label, int length, LineTable *lines, HashTable *entriesExternsHash) {
 
-                freeStringArray(splitedLine, numberOfElements);
-                free(directiveIndex);
-                free(constantValueString);
-                return INDEX;
-            }
+    parsed->isExtern = hasType(entriesExternsHash, label, "externDirective");
 
-            else{
-                freeStringArray(splitedLine, numberOfElements);
-                return UNDEFINED_CONSTANT;
-            }
+    if (lines != NULL) {
+        parsed->symbol = storeSymbol(lines, label, length);
+    }
+}
+
+AddressingMode identifyAddressingMode(char *operand, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash) {
+
+    Operand parsed;
+
+    return identifyOperand(operand, &parsed, NULL, symbolsLabelsValuesHash, entriesExternsHash);
+}
+
+AddressingMode identifyOperand(char *operand, Operand *parsed, LineTable *lines, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash) {
+
+    char label[MAX_LINE_LENGTH * 2];
+    char index[MAX_LINE_LENGTH * 2];
+    char *start;
+    int labelLength = 0;
+    int indexLength = 0;
+    Keyword keyword;
+
+    cleanCommand(operand);
+    keyword = find_keyword(operand, strlen(operand));
 
-        } else if(ht_search(entriesExternsHash, splitedLine[0]) != NULL && (strcmp(ht_get_type(entriesExternsHash, splitedLine[0]), "externDirective") == 0)){
-            freeStringArray(splitedLine, numberOfElements);
-            return INDEX;
+    clearOperand(parsed);
+
+    /* If the operand starts with a '#' suspect immediate addressing mode, the value runs up to the next '#' */
+    if (operand[0] == '#') {
+        for (start = operand; *start == '#'; start++);
+        while (start[indexLength] != '\0' && start[indexLength] != '#') {
+            index[indexLength] = start[indexLength];
+            indexLength++;
         }
+        index[indexLength] = '\0';
+
+        parsed->mode = (resolveValue(index, symbolsLabelsValuesHash, &parsed->value) ? IMMEDIATE : UNDEFINED_CONSTANT);
+
+    /* If there is a use of existing data directive or string directive return direct addressing mode*/
+    } else if (isDirectLabel(operand, symbolsLabelsValuesHash, entriesExternsHash)) {
+        parsed->mode = DIRECT;
+        labelLength = strlen(operand);
+        strcpy(label, operand);
 
+    /* If the opernad contains a '[' and a ']' and a valid integer in between suspect index addressing mode */
+    } else if (strchr(operand, '[') != NULL && strchr(operand, ']') != NULL) {
 
-        else{
-            freeStringArray(splitedLine, numberOfElements);
-            return UNDEFINED_LABEL;
+        /* The label runs up to the first '[', the index up to the next one (without the ']') */
+        for (start = operand; *start == '['; start++);
+        for (; *start != '\0' && *start != '['; start++) {
+            label[labelLength++] = *start;
+        }
+        for (; *start == '['; start++);
+        for (; *start != '\0' && *start != '['; start++) {
+            if (*start != ']') {
+                index[indexLength++] = *start;
+            }
         }
+        label[labelLength] = '\0';
+        index[indexLength] = '\0';
 
+        parsed->mode = indexMode(label, resolveValue(index, symbolsLabelsValuesHash, &parsed->value), parsed, symbolsLabelsValuesHash, entriesExternsHash);
 
     /* If the operand is a register return register addressing mode */
-    } else if (strcmp(operand, "r0") == 0 || strcmp(operand, "r1") == 0 || strcmp(operand, "r2") == 0 || strcmp(operand, "r3") == 0 || strcmp(operand, "r4") == 0 || strcmp(operand, "r5") == 0 || strcmp(operand, "r6") == 0 || strcmp(operand, "r7") == 0) {
-        return REGISTER;
+    } else if (keyword.kind == REGISTER_KEYWORD) {
+        parsed->mode = REGISTER;
+        parsed->registerNumber = keyword.value;
+    }
 
-    } else {
-        return UNDEFINED_ADDRESSING;
+    if (parsed->mode == DIRECT || parsed->mode == INDEX) {
+        keepOperandLabel(parsed, label, labelLength, lines, entriesExternsHash);
+    }
+
+    return parsed->mode;
+}
+
+AddressingMode identifyOperandParts(AddressingMode mode, char *name, char *indexName, int value, Operand *parsed, LineTable *lines, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash) {
+
+    clearOperand(parsed);
+
+    switch (mode) {
+        case IMMEDIATE:
+            if (name == NULL) {
+                parsed->value = value;
+                parsed->mode = IMMEDIATE;
+            }
+            else {
+                parsed->mode = (resolveConstant(name, symbolsLabelsValuesHash, &parsed->value) ? IMMEDIATE : UNDEFINED_CONSTANT);
+            }
+            break;
+        case DIRECT:
+            parsed->mode = (isDirectLabel(name, symbolsLabelsValuesHash, entriesExternsHash) ? DIRECT : UNDEFINED_ADDRESSING);
+            break;
+        case INDEX:
+            if (indexName == NULL) {
+                parsed->value = value;
+            }
+            parsed->mode = indexMode(name, (indexName == NULL || resolveConstant(indexName, symbolsLabelsValuesHash, &parsed->value)), parsed, symbolsLabelsValuesHash, entriesExternsHash);
+            break;
+        case REGISTER:
+            if (value >= 0 && value < REGISTER_COUNT) {
+                parsed->mode = REGISTER;
+                parsed->registerNumber = value;
+            }
+            break;
+        default:
+            break;
+    }
+
+    if (parsed->mode == DIRECT || parsed->mode == INDEX) {
+        keepOperandLabel(parsed, name, (int)strlen(name), lines, entriesExternsHash);
     }
+
+    return parsed->mode;
+}
+
+char *operand_symbol(LineTable *lines, Operand *operand) {
+    static char none[] = "";
+
+    return (operand->symbol < 0 ? none : lines->symbols + operand->symbol);
 }
 
 
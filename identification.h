@@ -1,9 +1,12 @@
+#include "symbol_table.h"
+
 typedef enum CommandType {
     UNDEFINED,
     EMPTY,
     COMMENT,
     DATA_DIRECTIVE,
     STRING_DIRECTIVE,
+    INCLUDE_DIRECTIVE,
     ENTRY_DIRECTIVE,
     EXTERN_DIRECTIVE,
     UNDEFINED_DIRECTIVE,
@@ -45,16 +48,121 @@ typedef enum AddressingMode {
 
 } AddressingMode;
 
+/* Defines an operand of an instruction, parsed once by the validation and reused by the sizing and the encoding. */
+typedef struct Operand {
+
+    AddressingMode mode;
+    int registerNumber;     /* REGISTER - The number of the register */
+    int value;              /* IMMEDIATE - The value (a number or a constant), INDEX - The index (a number or a constant) */
+    int symbol;             /* DIRECT, INDEX - Offset of the label's name in the LineTable symbols, -1 when there is none */
+    bool isExtern;          /* DIRECT, INDEX - The label was declared as an extern */
+
+} Operand;
+
+/* Defines what the passes know about a single line of the pre-processed source, beside the fields the LineTable
+ * keeps in arrays of their own. Only the validation and the encoding of the line itself look at it. */
+typedef struct LineRecord {
+
+    int dataOffset;         /* Data, string and include lines only, offset of the line's words in the LineTable data */
+    int include;            /* Include lines only, index of the included file in the LineTable includes */
+
+    /* Instruction lines only, set once the line passed the validation */
+    InstructionType instruction;
+    int operandCount;
+    Operand operands[2];    /* The source operand comes first */
+
+} LineRecord;
+
+/* Defines a growing array of memory words. */
+typedef struct Segment {
+
+    int *words;
+    int length;
+    int capacity;
+
+} Segment;
+
+/* Defines the classified lines of a source buffer.
+ * The fields the passes read for every line are kept in parallel arrays indexed by the line, so a pass over
+ * millions of lines only brings the fields it uses into the cache. */
+typedef struct LineTable {
+
+    int count;
+
+    unsigned char *kinds;           /* The CommandType of each line */
+    unsigned short *labelLengths;   /* Instruction, data, string and include lines, the length of the label the line defines, 0 when there is none */
+    int *wordCounts;                /* Number of memory words the line occupies */
+    int *addresses;                 /* Memory address of the first word of the line */
+    unsigned short *firstWords;     /* Instruction lines only, the opcode and addressing mode bits (see first_word) */
+    int *textOffsets;               /* Offset of the cleaned line (see cleanCommand) in text */
+
+    LineRecord *records;            /* The rest of what is known about each line */
+    char *text;                     /* Holds the cleaned lines */
+
+    char *symbols;          /* Holds the null terminated label names the operands refer to */
+    int symbolsLength;
+    int symbolsCapacity;
+
+    SymbolTable labels;     /* The labels of the instruction, data, string and include lines, defined as the lines are classified */
+
+    struct IncludedFile *includes;  /* The files of the include lines, mapped by the validation (see include_file.h) */
+    int includeCount;
+    int includeCapacity;
+
+    Segment code;           /* The words of the instructions, one line after the other */
+    Segment data;           /* The words of the data, string and include directives, one line after the other */
+
+} LineTable;
+
+/* The cleaned line of a LineTable */
+#define LINE_TEXT(lines, line) ((lines)->text + (lines)->textOffsets[line])
+
 
 /* ------------------------------------ Functions ------------------------------------ */
 
 /** identifyCommandType
  *  @brief Identifies the type of command in the given line.
  *  @param line The line to be analyzed.
- *  @param instructionsHash The hash table containing the instructions.
  *  @return The type of command in the given line.
  */
-CommandType identifyCommandType(char *line, HashTable* instructionsHash);
+CommandType identifyCommandType(char *line);
+
+/** create_line_table
+ *  @brief Allocates a table for a number of lines, with empty segments. The lines are filled by the caller.
+ *  @param lineCount The number of lines.
+ *  @param textLength The room the cleaned lines take in the table text, their terminators included.
+ *  @return The table, freed with free_line_table.
+ */
+LineTable *create_line_table(int lineCount, int textLength);
+
+/** classify_source_lines
+ *  @brief Cleans and classifies every line of the source once, so the passes don't have to.
+ *         Large sources are split into chunks classified on parallel threads.
+ *  @param source The source whose lines are classified.
+ *  @return The table of the classified lines.
+ */
+LineTable *classify_source_lines(SourceBuffer *source);
+
+/** free_line_table
+ *  @brief Frees a table returned by classify_source_lines or create_line_table.
+ *  @param lines The table to free.
+ */
+void free_line_table(LineTable *lines);
+
+/** reserve_segment_words
+ *  @brief Makes room for words at the end of a segment, the caller adds the words it wrote to the length.
+ *  @param segment The segment.
+ *  @param count The number of words.
+ *  @return The room, right after the last word of the segment.
+ */
+int *reserve_segment_words(Segment *segment, int count);
+
+/** append_word
+ *  @brief Appends a word to a segment.
+ *  @param segment The segment.
+ *  @param word The word.
+ */
+void append_word(Segment *segment, int word);
 
 /** isComment
  *  @brief Checks if the given line is a comment.
@@ -119,3 +227,37 @@ void removeLabel(char *line);
  *  @return The addressing mode of the given operand.
  */
 AddressingMode identifyAddressingMode(char *operand, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash);
+
+/** identifyOperand
+ *  @brief Identifies the addressing mode of the given operand and parses it.
+ *  @param operand The operand to be analyzed.
+ *  @param parsed Receives the parsed operand.
+ *  @param lines The table that keeps the label names the operands refer to, NULL to keep none.
+ *  @param symbolsLabelsValuesHash The hash table containing the symbols, labels and values.
+ *  @param entriesExternsHash The hash table containing the entries and externs.
+ *  @return The addressing mode of the given operand (as identifyAddressingMode).
+ */
+AddressingMode identifyOperand(char *operand, Operand *parsed, LineTable *lines, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash);
+
+/** identifyOperandParts
+ *  @brief Identifies an operand given by its parts instead of its text (see token_file.h) and parses it,
+ *         as identifyOperand identifies the text the parts stand for.
+ *  @param mode The addressing mode the operand is written in: IMMEDIATE, DIRECT, INDEX or REGISTER.
+ *  @param name IMMEDIATE - The constant, NULL for a number. DIRECT, INDEX - The label.
+ *  @param indexName INDEX - The constant of the index, NULL for a number.
+ *  @param value IMMEDIATE, INDEX - The number. REGISTER - The number of the register.
+ *  @param parsed Receives the parsed operand.
+ *  @param lines The table that keeps the label names the operands refer to, NULL to keep none.
+ *  @param symbolsLabelsValuesHash The hash table containing the symbols, labels and values.
+ *  @param entriesExternsHash The hash table containing the entries and externs.
+ *  @return The addressing mode of the operand (as identifyAddressingMode).
+ */
+AddressingMode identifyOperandParts(AddressingMode mode, char *name, char *indexName, int value, Operand *parsed, LineTable *lines, HashTable *symbolsLabelsValuesHash, HashTable *entriesExternsHash);
+
+/** operand_symbol
+ *  @brief Returns the name of the label an operand refers to.
+ *  @param lines The table that keeps the names.
+ *  @param operand The operand.
+ *  @return The name of the label, an empty string when there is none.
+ */
+char *operand_symbol(LineTable *lines, Operand *operand);
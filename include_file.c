@@ -0,0 +1,229 @@
+/* Needed for mmap() when compiling with -ansi */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "global_definitions.h"
+#include "utility_functions.h"
+#include "identification.h"
+#include "diagnostics.h"
+#include "file_io.h"
+#include "include_file.h"
+
+/* The most words a valid file has, so the data segment never overflows */
+#define MAX_INCLUDED_WORDS (1 << 28)
+
+/* The first room of the included files of a table, it doubles when it runs out */
+#define INITIAL_INCLUDES_CAPACITY 4
+
+
+/**
+ * Is a Separator Space
+ *
+ * @param character - A character of a list.
+ * @return True if the character is a whitespace.
+ */
+static bool isSeparatorSpace(char character) {
+    return (character == ' ' || character == '\t' || character == '\n' || character == '\r' || character == '\v' || character == '\f');
+}
+
+/**
+ * Scan a List
+ *
+ * Walks the integers of a list once, checking them, and writes them when asked to.
+ *
+ * @param text - The list, not null terminated.
+ * @param length - The length of the list.
+ * @param words - Receives the values, NULL to only check and count them.
+ * @param count - Receives the number of values.
+ * @return True if every value is an integer that fits in a word, and no value is missing between two commas.
+ */
+static bool scanList(const char *text, size_t length, int *words, int *count) {
+    const char *end = text + length;
+    bool afterComma = False;
+    bool negative;
+    long value;
+    int digits;
+
+    *count = 0;
+
+    for (;;) {
+        while (text < end && isSeparatorSpace(*text)) {
+            text++;
+        }
+
+        if (text == end) {
+            return (afterComma == False);
+        }
+
+        if (*text == ',') {
+            if (afterComma || *count == 0) {
+                return False;
+            }
+
+            afterComma = True;
+            text++;
+            continue;
+        }
+
+        negative = (*text == '-');
+        if (*text == '+' || *text == '-') {
+            text++;
+        }
+
+        /* The magnitude is bounded as it grows, so it never overflows */
+        value = 0;
+        for (digits = 0; text < end && *text >= '0' && *text <= '9'; digits++) {
+            value = value * 10 + (*text++ - '0');
+
+            if (value > MAX_WORD_VALUE) {
+                return False;
+            }
+        }
+
+        if (negative) {
+            value = -value;
+        }
+
+        if (digits == 0 || value < MIN_WORD_VALUE || (text < end && !isSeparatorSpace(*text) && *text != ',') || *count == MAX_INCLUDED_WORDS) {
+            return False;
+        }
+
+        if (words != NULL) {
+            words[*count] = (int)value;
+        }
+
+        (*count)++;
+        afterComma = False;
+    }
+}
+
+bool include_path(const char *sourceFileName, const char *name, int nameLength, char *path, size_t size) {
+    const char *slash = strrchr(sourceFileName, '/');
+    int directoryLength = 0;
+
+    /* An absolute name is taken as is, a relative one is in the directory of the source */
+    if (slash != NULL && name[0] != '/') {
+        directoryLength = (int)(slash - sourceFileName) + 1;
+    }
+
+    if ((size_t)directoryLength + (size_t)nameLength + 1 > size) {
+        return False;
+    }
+
+    memcpy(path, sourceFileName, directoryLength);
+    memcpy(path + directoryLength, name, nameLength);
+    path[directoryLength + nameLength] = '\0';
+
+    return True;
+}
+
+const char *map_included_file(const char *path, IncludedFile *file) {
+    struct stat status;
+    const unsigned char *bytes;
+    size_t extensionLength = strlen(INCLUDE_BINARY_EXTENSION);
+    size_t pathLength = strlen(path);
+    size_t i;
+    int fd;
+
+    fd = open_file(path, O_RDONLY);
+    if (fd < 0) {
+        return INCLUDE_OPEN_ERROR;
+    }
+
+    if (fstat(fd, &status) != 0 || !S_ISREG(status.st_mode)) {
+        close(fd);
+        return INCLUDE_OPEN_ERROR;
+    }
+
+    if (status.st_size == 0) {
+        close(fd);
+        return INCLUDE_EMPTY_ERROR;
+    }
+
+    file->length = (size_t)status.st_size;
+    file->contents = mmap(NULL, file->length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (file->contents == MAP_FAILED) {
+        return INCLUDE_OPEN_ERROR;
+    }
+
+    file->isBinary = (pathLength >= extensionLength && strcmp(path + pathLength - extensionLength, INCLUDE_BINARY_EXTENSION) == 0);
+
+    if (file->isBinary) {
+        if (file->length % 2 != 0 || file->length / 2 > MAX_INCLUDED_WORDS) {
+            munmap(file->contents, file->length);
+            return INCLUDE_LENGTH_ERROR;
+        }
+
+        /* The high byte of a word holds its 6 upper bits */
+        bytes = (const unsigned char *)file->contents;
+        for (i = 1; i < file->length; i += 2) {
+            if (bytes[i] > (MAX_WORD_VALUE >> 8)) {
+                munmap(file->contents, file->length);
+                return INCLUDE_VALUE_ERROR;
+            }
+        }
+
+        file->wordCount = (int)(file->length / 2);
+    }
+    else if (scanList(file->contents, file->length, NULL, &file->wordCount) == False) {
+        munmap(file->contents, file->length);
+        return INCLUDE_VALUE_ERROR;
+    }
+
+    sprintf(file->path, "%.*s", (int)sizeof(file->path) - 1, path);
+
+    return NULL;
+}
+
+void decode_included_file(const IncludedFile *file, int *words) {
+    const unsigned char *bytes = (const unsigned char *)file->contents;
+    int count;
+    int i;
+
+    if (file->isBinary) {
+        for (i = 0; i < file->wordCount; i++) {
+            words[i] = bytes[2 * i] | bytes[2 * i + 1] << 8;
+        }
+        return;
+    }
+
+    scanList(file->contents, file->length, words, &count);
+}
+
+int keep_included_file(LineTable *lines, const IncludedFile *file) {
+
+    if (lines->includeCount == lines->includeCapacity) {
+        lines->includeCapacity = (lines->includeCapacity == 0 ? INITIAL_INCLUDES_CAPACITY : lines->includeCapacity * 2);
+        lines->includes = realloc(lines->includes, lines->includeCapacity * sizeof(IncludedFile));
+
+        if (lines->includes == NULL) {
+            memory_allocation_failed();
+        }
+    }
+
+    lines->includes[lines->includeCount] = *file;
+
+    return lines->includeCount++;
+}
+
+void unmap_included_files(LineTable *lines) {
+    int i;
+
+    for (i = 0; i < lines->includeCount; i++) {
+        munmap(lines->includes[i].contents, lines->includes[i].length);
+    }
+
+    free(lines->includes);
+    lines->includes = NULL;
+    lines->includeCount = 0;
+    lines->includeCapacity = 0;
+}
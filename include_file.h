@@ -0,0 +1,80 @@
+#ifndef _INCLUDE_FILE_H
+#define _INCLUDE_FILE_H
+
+#include <stddef.h>
+
+/* Expects global_definitions.h and identification.h to be included first */
+
+/* ------------------------------------ Static Definitions ------------------------------------ */
+
+/* "<label>: .include "<file>"" takes the words of a data table from a file instead of ".data" lines.
+ * The file name is relative to the directory of the source. The file is mapped into memory and its words are
+ * written straight into the data segment, at the place of the line:
+ *   a ".bin" file holds 16 bit little endian words
+ *   any other file holds a list of integers, separated by commas, whitespaces or both */
+#define INCLUDE_BINARY_EXTENSION ".bin"
+
+#define INCLUDE_PATH_ERROR "The name of the included file is too long\n"
+#define INCLUDE_OPEN_ERROR "The included file cannot be read\n"
+#define INCLUDE_EMPTY_ERROR "The included file is empty\n"
+#define INCLUDE_LENGTH_ERROR "The included binary file does not hold whole 16 bit words\n"
+#define INCLUDE_VALUE_ERROR "Invalid included data - One of the values is not a valid integer or does not fit in 14 bits\n"
+
+
+/* ------------------------------------ Data Types ------------------------------------ */
+
+/* Defines a file included by an ".include" line, mapped by the validation and decoded by the code generation */
+typedef struct IncludedFile
+{
+    char path[MAX_LINE_LENGTH * 2];     /* The name of the file, relative to the working directory */
+    char *contents;                     /* The mapping */
+    size_t length;
+    bool isBinary;
+    int wordCount;
+
+} IncludedFile;
+
+
+/* ------------------------------------ Functions ------------------------------------ */
+
+/** include_path
+ *  @brief Finds an included file, relative to the directory of the source that includes it.
+ *  @param sourceFileName The name of the source.
+ *  @param name The name of the file, as written in the source (not null terminated).
+ *  @param nameLength The length of the name.
+ *  @param path Receives the name of the file, relative to the working directory.
+ *  @param size The size of path.
+ *  @return True if the name fits in path, False otherwise.
+ */
+bool include_path(const char *sourceFileName, const char *name, int nameLength, char *path, size_t size);
+
+/** map_included_file
+ *  @brief Maps an included file into memory and checks its words, in a single pass over the file.
+ *  @param path The name of the file.
+ *  @param file Receives the mapping and the number of words, kept only when the file is valid.
+ *  @return NULL if the file is valid, the error message otherwise.
+ */
+const char *map_included_file(const char *path, IncludedFile *file);
+
+/** decode_included_file
+ *  @brief Writes the words of a file checked by map_included_file.
+ *  @param file The file.
+ *  @param words Receives the words, file->wordCount of them.
+ */
+void decode_included_file(const IncludedFile *file, int *words);
+
+/** keep_included_file
+ *  @brief Keeps a mapped file with the lines that include it, until free_line_table.
+ *  @param lines The lines.
+ *  @param file The file.
+ *  @return The index of the file in lines->includes.
+ */
+int keep_included_file(LineTable *lines, const IncludedFile *file);
+
+/** unmap_included_files
+ *  @brief Unmaps the files kept with a table of lines.
+ *  @param lines The lines.
+ */
+void unmap_included_files(LineTable *lines);
+
+#endif
@@ -0,0 +1,78 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "global_definitions.h"
+#include "utility_functions.h"
+#include "identification.h"
+#include "instruction_set.h"
+#include "keywords.h"
+
+/* Bits 6-9 hold the opcode, bits 4-5 the source addressing mode and bits 2-3 the destination addressing mode */
+#define FIRST_WORD(opcode, source, destination) (((opcode) << 6) | ((source) << 4) | ((destination) << 2))
+
+/* Expands to the first words of an opcode for every source and destination addressing mode */
+#define DESTINATION_WORDS(opcode, source) {FIRST_WORD(opcode, source, 0), FIRST_WORD(opcode, source, 1), FIRST_WORD(opcode, source, 2), FIRST_WORD(opcode, source, 3)}
+#define OPCODE_WORDS(opcode) {DESTINATION_WORDS(opcode, 0), DESTINATION_WORDS(opcode, 1), DESTINATION_WORDS(opcode, 2), DESTINATION_WORDS(opcode, 3)}
+
+/* The instructions, in the order of InstructionType */
+static const InstructionDefinition instructionSet[] = {
+    {"mov", 0,  2, ALL_MODES,                            MODE_BIT(DIRECT) | MODE_BIT(INDEX) | MODE_BIT(REGISTER)},
+    {"cmp", 1,  2, ALL_MODES,                            ALL_MODES},
+    {"add", 2,  2, ALL_MODES,                            MODE_BIT(DIRECT) | MODE_BIT(INDEX) | MODE_BIT(REGISTER)},
+    {"sub", 3,  2, ALL_MODES,                            MODE_BIT(DIRECT) | MODE_BIT(INDEX) | MODE_BIT(REGISTER)},
+    {"not", 4,  1, NO_MODES,                             MODE_BIT(DIRECT) | MODE_BIT(INDEX) | MODE_BIT(REGISTER)},
+    {"clr", 5,  1, NO_MODES,                             MODE_BIT(DIRECT) | MODE_BIT(INDEX) | MODE_BIT(REGISTER)},
+    {"lea", 6,  2, MODE_BIT(DIRECT) | MODE_BIT(INDEX),   MODE_BIT(DIRECT) | MODE_BIT(INDEX) | MODE_BIT(REGISTER)},
+    {"inc", 7,  1, NO_MODES,                             MODE_BIT(DIRECT) | MODE_BIT(INDEX) | MODE_BIT(REGISTER)},
+    {"dec", 8,  1, NO_MODES,                             MODE_BIT(DIRECT) | MODE_BIT(INDEX) | MODE_BIT(REGISTER)},
+    {"jmp", 9,  1, NO_MODES,                             MODE_BIT(DIRECT) | MODE_BIT(REGISTER)},
+    {"bne", 10, 1, NO_MODES,                             MODE_BIT(DIRECT) | MODE_BIT(REGISTER)},
+    {"red", 11, 1, NO_MODES,                             MODE_BIT(DIRECT) | MODE_BIT(INDEX) | MODE_BIT(REGISTER)},
+    {"prn", 12, 1, NO_MODES,                             ALL_MODES},
+    {"jsr", 13, 1, NO_MODES,                             MODE_BIT(DIRECT) | MODE_BIT(REGISTER)},
+    {"rts", 14, 0, NO_MODES,                             NO_MODES},
+    {"hlt", 15, 0, NO_MODES,                             NO_MODES}
+};
+
+/* The first word of every opcode and addressing modes pair, computed by the compiler */
+static const int firstWords[16][4][4] = {
+    OPCODE_WORDS(0),  OPCODE_WORDS(1),  OPCODE_WORDS(2),  OPCODE_WORDS(3),
+    OPCODE_WORDS(4),  OPCODE_WORDS(5),  OPCODE_WORDS(6),  OPCODE_WORDS(7),
+    OPCODE_WORDS(8),  OPCODE_WORDS(9),  OPCODE_WORDS(10), OPCODE_WORDS(11),
+    OPCODE_WORDS(12), OPCODE_WORDS(13), OPCODE_WORDS(14), OPCODE_WORDS(15)
+};
+
+/* The words an operand adds after the first word, by addressing mode (an index takes a word of its own) */
+static const int operandWords[] = {1, 1, 2, 1};
+
+InstructionType find_instruction(const char *name) {
+    Keyword keyword = find_keyword(name, strlen(name));
+
+    return keyword.kind == INSTRUCTION_KEYWORD ? (InstructionType)keyword.value : UNDEFINED_INSTRUCTION;
+}
+
+const InstructionDefinition *instruction_definition(InstructionType instruction) {
+    return &instructionSet[instruction];
+}
+
+int operand_words(AddressingMode mode) {
+    return operandWords[mode];
+}
+
+int instruction_words(InstructionType instruction, AddressingMode source, AddressingMode destination) {
+    int operandCount = instructionSet[instruction].operandCount;
+
+    /* Two registers share a single word */
+    if (operandCount == 2 && source == REGISTER && destination == REGISTER) {
+        return 2;
+    }
+
+    return 1 + (operandCount == 2 ? operandWords[source] : 0) + (operandCount >= 1 ? operandWords[destination] : 0);
+}
+
+int first_word(InstructionType instruction, AddressingMode source, AddressingMode destination) {
+    const InstructionDefinition *definition = &instructionSet[instruction];
+
+    /* The mode bits of a missing operand are 0 */
+    return firstWords[definition->opcode][definition->operandCount == 2 ? source : 0][definition->operandCount >= 1 ? destination : 0];
+}
@@ -0,0 +1,79 @@
+#ifndef _INSTRUCTION_SET_H
+#define _INSTRUCTION_SET_H
+
+/* Expects identification.h (InstructionType, AddressingMode) to be included first */
+
+/* ------------------------------------ Static Definitions ------------------------------------ */
+
+/* The A,R,E field (bits 0-1) of a word */
+#define ARE_ABSOLUTE 0
+#define ARE_EXTERNAL 1
+#define ARE_RELOCATABLE 2
+
+/* Bit of an addressing mode in the legal modes masks of an InstructionDefinition */
+#define MODE_BIT(mode) (1 << (mode))
+
+/* The most words an instruction takes, two indexed operands after the first word */
+#define MAX_INSTRUCTION_WORDS 5
+
+#define NO_MODES 0
+#define ALL_MODES (MODE_BIT(IMMEDIATE) | MODE_BIT(DIRECT) | MODE_BIT(INDEX) | MODE_BIT(REGISTER))
+
+
+/* ------------------------------------ Data Types ------------------------------------ */
+
+/* Defines an instruction of the machine */
+typedef struct InstructionDefinition
+{
+    const char *name;
+    int opcode;
+    int operandCount;
+    int sourceModes;            /* MODE_BIT mask of the legal source addressing modes */
+    int destinationModes;       /* MODE_BIT mask of the legal destination addressing modes */
+
+} InstructionDefinition;
+
+
+/* ------------------------------------ Functions ------------------------------------ */
+
+/** find_instruction
+ *  @brief Finds the instruction of the given name.
+ *  @param name The name of the instruction.
+ *  @return The instruction, UNDEFINED_INSTRUCTION when the name is not one.
+ */
+InstructionType find_instruction(const char *name);
+
+/** instruction_definition
+ *  @brief Returns the definition of an instruction.
+ *  @param instruction The instruction, not UNDEFINED_INSTRUCTION.
+ *  @return The definition of the instruction.
+ */
+const InstructionDefinition *instruction_definition(InstructionType instruction);
+
+/** instruction_words
+ *  @brief Returns the number of memory words an instruction takes.
+ *         The operands that the instruction does not have are ignored.
+ *  @param instruction The instruction, not UNDEFINED_INSTRUCTION.
+ *  @param source The addressing mode of the source operand.
+ *  @param destination The addressing mode of the destination operand (the only operand of a single operand instruction).
+ *  @return The number of words, including the first word.
+ */
+int instruction_words(InstructionType instruction, AddressingMode source, AddressingMode destination);
+
+/** operand_words
+ *  @brief Returns the number of memory words an operand adds after the first word.
+ *  @param mode The addressing mode of the operand.
+ *  @return The number of words.
+ */
+int operand_words(AddressingMode mode);
+
+/** first_word
+ *  @brief Returns the first word of an instruction.
+ *  @param instruction The instruction, not UNDEFINED_INSTRUCTION.
+ *  @param source The addressing mode of the source operand.
+ *  @param destination The addressing mode of the destination operand (the only operand of a single operand instruction).
+ *  @return The first word.
+ */
+int first_word(InstructionType instruction, AddressingMode source, AddressingMode destination);
+
+#endif
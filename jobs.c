@@ -0,0 +1,769 @@
+/* Needed for the pipes, poll() and fcntl() when compiling with -ansi */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "global_definitions.h"
+#include "compilation.h"
+#include "diagnostics.h"
+#include "parallel.h"
+#include "file_io.h"
+#include "jobs.h"
+
+/* Defines the jobserver of make, a pipe holding a token (a byte) for every job make allows besides the running ones */
+typedef struct Jobserver
+{
+    int readFd;             /* A non blocking descriptor of our own, -1 when there is no jobserver */
+    int writeFd;
+    bool ownsWriteFd;       /* True when the write descriptor was opened here (a fifo) rather than inherited */
+
+} Jobserver;
+
+/* Defines a file in flight */
+typedef struct Job
+{
+    char *program;
+    Workspace *workspace;
+    ConsoleCapture capture;     /* The messages of the file, printed once the files before it are done */
+    int index;                  /* The index of the job in the ring, sent through the completion pipe when done */
+    int completionFd;
+    bool holdsToken;            /* False for the job running on the token make gave the assembler itself */
+    char token;
+    ThreadTokens *tokens;       /* Where the chunk threads of the job take their tokens */
+    bool threaded;              /* False when no thread could be started and the file was compiled on the calling thread */
+    bool done;
+    pthread_t thread;
+
+} Job;
+
+/* Defines the state of compile_programs() */
+typedef struct Scheduler
+{
+    Jobserver jobserver;
+    int limit;                  /* The most jobs running at the same time */
+    ThreadTokens tokens;        /* The tokens of the jobs besides the first and of their chunk threads */
+    int freeSlots;              /* Without a jobserver, the tokens left within the limit */
+    Job *jobs;                  /* The ring of the files in flight, the file of sequence s is at s % window */
+    int window;
+    long firstSequence;         /* The oldest file in flight, the next one to print its messages */
+    long nextSequence;
+    int running;
+    Workspace **workspaces;     /* The workspaces of the jobs that are done, reused by the next jobs */
+    const CompileOptions *options;
+    int freeWorkspaces;
+    int completionPipe[2];      /* The jobs write their index here when done */
+
+} Scheduler;
+
+/* Defines a file in the pipeline of a single job */
+typedef struct StagedFile
+{
+    CompilationUnit unit;
+    ConsoleCapture capture;     /* The messages of the file, printed by the last stage */
+    bool last;                  /* Follows the last program down the stages to stop them */
+
+} StagedFile;
+
+/* Defines the pipeline of a single job, reading file N + 1, assembling file N and writing file N - 1 at the same time */
+typedef struct Pipeline
+{
+    StagedFile files[PIPELINE_DEPTH];
+    BoundedQueue freeFiles;         /* From the writing stage back to the reading stage */
+    BoundedQueue readFiles;         /* From the reading stage to the assembling stage */
+    BoundedQueue assembledFiles;    /* From the assembling stage to the writing stage */
+
+} Pipeline;
+
+/**
+ * Fixed Job Count
+ *
+ * @param options - The options of the run.
+ * @return The number of jobs when not run by make, JOBS_VARIABLE or else the number of processors.
+ */
+static int fixedJobCount(const CompileOptions *options) {
+    int jobs = (options->jobs > 0 ? options->jobs : online_processors());
+
+    return (jobs > MAX_JOBS ? MAX_JOBS : jobs);
+}
+
+/**
+ * Option Value
+ *
+ * @param flags - The make flags.
+ * @param option - The option, with its '='.
+ * @return An allocated copy of the value of the last occurrence of the option, NULL if it does not occur.
+ */
+static char *optionValue(const char *flags, const char *option) {
+    const char *found = NULL;
+    const char *next = flags;
+    size_t length;
+    char *value;
+
+    /* make appends the options of a recursive make, the last one is the jobserver of the closest make */
+    while ((next = strstr(next, option)) != NULL) {
+        found = next + strlen(option);
+        next = found;
+    }
+
+    if (found == NULL) {
+        return NULL;
+    }
+
+    length = strcspn(found, " ");
+    value = malloc(length + 1);
+    if (value == NULL) {
+        memory_allocation_failed();
+    }
+
+    memcpy(value, found, length);
+    value[length] = '\0';
+
+    return value;
+}
+
+/**
+ * Connect to the Jobserver
+ *
+ * Opens a non blocking read descriptor of our own, so waiting for a token never blocks the scheduler
+ * and never changes the descriptor make and the other jobs share.
+ *
+ * @param jobserver - Receives the jobserver.
+ * @param underMake - Receives True when the assembler was run by make, with or without a jobserver.
+ * @return True if the jobserver can be used, False otherwise.
+ */
+static bool connectJobserver(Jobserver *jobserver, bool *underMake) {
+    const char *flags = getenv(MAKE_FLAGS_VARIABLE);
+    char procPath[64];
+    char *value;
+    int readFd, writeFd;
+
+    jobserver->readFd = -1;
+    jobserver->writeFd = -1;
+    jobserver->ownsWriteFd = False;
+    *underMake = (flags != NULL);
+
+    if (flags == NULL) {
+        return False;
+    }
+
+    value = optionValue(flags, JOBSERVER_AUTH_OPTION);
+    if (value == NULL) {
+        value = optionValue(flags, JOBSERVER_FDS_OPTION);
+    }
+    if (value == NULL) {
+        return False;
+    }
+
+    if (strncmp(value, JOBSERVER_FIFO_PREFIX, strlen(JOBSERVER_FIFO_PREFIX)) == 0) {
+        jobserver->readFd = open(value + strlen(JOBSERVER_FIFO_PREFIX), O_RDONLY | O_NONBLOCK);
+        jobserver->writeFd = (jobserver->readFd < 0 ? -1 : open(value + strlen(JOBSERVER_FIFO_PREFIX), O_WRONLY));
+        jobserver->ownsWriteFd = True;
+
+    /* make closes the descriptors for the commands it does not consider recursive ("+" or $(MAKE)) */
+    } else if (sscanf(value, "%d,%d", &readFd, &writeFd) == 2 && fcntl(readFd, F_GETFD) != -1 && fcntl(writeFd, F_GETFD) != -1) {
+        sprintf(procPath, "/proc/self/fd/%d", readFd);
+        jobserver->readFd = open(procPath, O_RDONLY | O_NONBLOCK);
+        jobserver->writeFd = writeFd;
+    }
+
+    free(value);
+
+    if (jobserver->readFd < 0 || jobserver->writeFd < 0) {
+        if (jobserver->readFd >= 0) {
+            close(jobserver->readFd);
+        }
+        if (jobserver->ownsWriteFd && jobserver->writeFd >= 0) {
+            close(jobserver->writeFd);
+        }
+        jobserver->readFd = -1;
+        return False;
+    }
+
+    return True;
+}
+
+/**
+ * Disconnect from the Jobserver
+ *
+ * @param jobserver - The jobserver.
+ */
+static void disconnectJobserver(Jobserver *jobserver) {
+
+    if (jobserver->readFd >= 0) {
+        close(jobserver->readFd);
+    }
+    if (jobserver->ownsWriteFd && jobserver->writeFd >= 0) {
+        close(jobserver->writeFd);
+    }
+}
+
+/**
+ * Acquire a Token
+ *
+ * @param source - The jobserver.
+ * @param token - Receives the token.
+ * @return True if a token was taken, False if there is none at the moment.
+ */
+static bool acquireToken(void *source, char *token) {
+    Jobserver *jobserver = (Jobserver *)source;
+    ssize_t received;
+
+    do {
+        received = read(jobserver->readFd, token, 1);
+    } while (received < 0 && errno == EINTR);
+
+    return received == 1;
+}
+
+/**
+ * Release a Token
+ *
+ * @param source - The jobserver.
+ * @param token - The token, make may give the tokens meanings of their own so the same byte is returned.
+ */
+static void releaseToken(void *source, char token) {
+    Jobserver *jobserver = (Jobserver *)source;
+
+    while (write(jobserver->writeFd, &token, 1) < 0 && errno == EINTR)
+        ;
+}
+
+/**
+ * Acquire a Slot
+ *
+ * Takes a token within the fixed limit of the jobs, used when there is no jobserver.
+ *
+ * @param source - The number of free slots (an int shared by the threads).
+ * @param token - Receives the token.
+ * @return True if a slot was taken, False if there is none at the moment.
+ */
+static bool acquireSlot(void *source, char *token) {
+    int *freeSlots = (int *)source;
+    int slots = __atomic_load_n(freeSlots, __ATOMIC_RELAXED);
+
+    while (slots > 0) {
+        if (__atomic_compare_exchange_n(freeSlots, &slots, slots - 1, False, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+            *token = 0;
+            return True;
+        }
+    }
+
+    return False;
+}
+
+/**
+ * Release a Slot
+ *
+ * @param source - The number of free slots.
+ * @param token - The token, unused.
+ */
+static void releaseSlot(void *source, char token) {
+    (void)token;
+    __atomic_add_fetch((int *)source, 1, __ATOMIC_ACQ_REL);
+}
+
+/**
+ * Acquire No Token
+ *
+ * Keeps a single job on a single thread.
+ *
+ * @param source - Unused.
+ * @param token - Unused.
+ * @return False.
+ */
+static bool acquireNoToken(void *source, char *token) {
+    (void)source;
+    (void)token;
+    return False;
+}
+
+/**
+ * Release No Token
+ *
+ * @param source - Unused.
+ * @param token - Unused.
+ */
+static void releaseNoToken(void *source, char token) {
+    (void)source;
+    (void)token;
+}
+
+/* The tokens of a run that allows a single job, its chunks run on the thread of the job */
+static ThreadTokens singleJobTokens = {acquireNoToken, releaseNoToken, NULL};
+
+/**
+ * Run a Job
+ *
+ * The thread entry point, compiles a file and reports it done through the completion pipe.
+ *
+ * @param argument - The job.
+ * @return NULL.
+ */
+static void *runJob(void *argument) {
+    Job *job = (Job *)argument;
+    ConsoleCapture *previousCapture = set_console_capture(&job->capture);
+    ThreadTokens *previousTokens = set_thread_tokens(job->tokens);
+
+    compile(job->program, job->workspace);
+
+    set_thread_tokens(previousTokens);
+    set_console_capture(previousCapture);
+
+    while (write(job->completionFd, &job->index, sizeof(job->index)) < 0 && errno == EINTR)
+        ;
+
+    return NULL;
+}
+
+/**
+ * Take a Program
+ *
+ * Takes the next program, capturing what next prints (the errors of a manifest) so it is printed
+ * in its place among the messages of the files.
+ *
+ * @param next - Returns the programs.
+ * @param context - Passed to next as is.
+ * @param messages - Receives what next printed, replayed by the caller.
+ * @return The next program, NULL when there are no more.
+ */
+static char *takeProgram(NextProgram next, void *context, ConsoleCapture *messages) {
+    ConsoleCapture *previousCapture;
+    char *program;
+
+    if (!open_console_capture(messages)) {
+        memory_allocation_failed();
+    }
+
+    previousCapture = set_console_capture(messages);
+    program = next(context);
+    set_console_capture(previousCapture);
+
+    return program;
+}
+
+/**
+ * Start a Job
+ *
+ * @param scheduler - The scheduler.
+ * @param program - The program to compile.
+ * @param messages - What was printed while the program was taken, it comes first in the messages of the job.
+ * @param holdsToken - True if the job runs on a token of the jobserver.
+ * @param token - The token.
+ */
+static void startJob(Scheduler *scheduler, const char *program, ConsoleCapture *messages, bool holdsToken, char token) {
+    Job *job = &scheduler->jobs[scheduler->nextSequence % scheduler->window];
+    ConsoleCapture *previousCapture;
+
+    job->program = malloc(strlen(program) + 1);
+    if (job->program == NULL || !open_console_capture(&job->capture)) {
+        memory_allocation_failed();
+    }
+    strcpy(job->program, program);
+
+    previousCapture = set_console_capture(&job->capture);
+    replay_console_capture(messages);
+    set_console_capture(previousCapture);
+
+    job->workspace = (scheduler->freeWorkspaces > 0 ? scheduler->workspaces[--scheduler->freeWorkspaces] : create_workspace(scheduler->options));
+    job->index = (int)(scheduler->nextSequence % scheduler->window);
+    job->completionFd = scheduler->completionPipe[1];
+    job->holdsToken = holdsToken;
+    job->token = token;
+    job->tokens = &scheduler->tokens;
+    job->done = False;
+
+    scheduler->nextSequence++;
+    scheduler->running++;
+
+    /* A file whose thread could not be started is compiled here */
+    job->threaded = (pthread_create(&job->thread, NULL, runJob, job) == 0);
+    if (!job->threaded) {
+        runJob(job);
+    }
+}
+
+/**
+ * Finish a Job
+ *
+ * Waits for a job to be done, returns its token and workspace and prints the messages of the files
+ * that no longer wait for an earlier file.
+ *
+ * @param scheduler - The scheduler.
+ */
+static void finishJob(Scheduler *scheduler) {
+    Job *job;
+    int index;
+
+    while (read(scheduler->completionPipe[0], &index, sizeof(index)) < 0) {
+        if (errno != EINTR) {
+            perror(JOBS_ERROR);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    job = &scheduler->jobs[index];
+    if (job->threaded) {
+        pthread_join(job->thread, NULL);
+    }
+
+    if (job->holdsToken) {
+        scheduler->tokens.release(scheduler->tokens.source, job->token);
+    }
+
+    scheduler->workspaces[scheduler->freeWorkspaces++] = job->workspace;
+    scheduler->running--;
+    job->done = True;
+
+    while (scheduler->firstSequence < scheduler->nextSequence && scheduler->jobs[scheduler->firstSequence % scheduler->window].done) {
+        job = &scheduler->jobs[scheduler->firstSequence % scheduler->window];
+
+        replay_console_capture(&job->capture);
+        free(job->program);
+        scheduler->firstSequence++;
+    }
+}
+
+/**
+ * Compile One After Another
+ *
+ * @param next - Returns the programs.
+ * @param context - Passed to next as is.
+ * @param options - The options of the files.
+ */
+static void compileSequentially(NextProgram next, void *context, const CompileOptions *options) {
+    Workspace *workspace = create_workspace(options);
+    ThreadTokens *previousTokens = set_thread_tokens(&singleJobTokens);
+    char *program;
+
+    while ((program = next(context)) != NULL) {
+        compile(program, workspace);
+    }
+
+    set_thread_tokens(previousTokens);
+    free_workspace(workspace);
+}
+
+/**
+ * Assembling Stage
+ *
+ * The thread entry point of the second stage of the pipeline.
+ *
+ * @param argument - The pipeline.
+ * @return NULL.
+ */
+static void *assemblingStage(void *argument) {
+    Pipeline *pipeline = (Pipeline *)argument;
+    ConsoleCapture *previousCapture;
+    StagedFile *file;
+    bool last;
+
+    /* The pipeline is a single job, its chunks stay on this thread */
+    set_thread_tokens(&singleJobTokens);
+
+    do {
+        file = (StagedFile *)queue_pop(&pipeline->readFiles);
+
+        /* Once pushed the file belongs to the next stage, which may already hand it back to the reading stage */
+        last = file->last;
+
+        if (!last) {
+            previousCapture = set_console_capture(&file->capture);
+            assemble_compilation_unit(&file->unit);
+            set_console_capture(previousCapture);
+        }
+
+        queue_push(&pipeline->assembledFiles, file);
+
+    } while (!last);
+
+    return NULL;
+}
+
+/**
+ * Writing Stage
+ *
+ * The thread entry point of the last stage of the pipeline, the files arrive in order so their messages are printed in order.
+ *
+ * @param argument - The pipeline.
+ * @return NULL.
+ */
+static void *writingStage(void *argument) {
+    Pipeline *pipeline = (Pipeline *)argument;
+    ConsoleCapture *previousCapture;
+    StagedFile *file;
+
+    while (!(file = (StagedFile *)queue_pop(&pipeline->assembledFiles))->last) {
+        previousCapture = set_console_capture(&file->capture);
+        write_compilation_unit(&file->unit);
+        set_console_capture(previousCapture);
+
+        replay_console_capture(&file->capture);
+        queue_push(&pipeline->freeFiles, file);
+    }
+
+    return NULL;
+}
+
+/**
+ * Read Ahead
+ *
+ * Takes the next programs and prefetches their input files, which are then read together.
+ *
+ * @param next - Returns the programs.
+ * @param context - Passed to next as is.
+ * @param programs - Receives copies of the programs, allocated with malloc().
+ * @param messages - Receives what next printed while taking each program, and then while finding there are no more
+ *                   (READ_AHEAD_FILES + 1 captures, the ones up to the returned count are opened).
+ * @return The number of programs, at most READ_AHEAD_FILES, 0 when there are no more.
+ */
+static int readAhead(NextProgram next, void *context, char **programs, ConsoleCapture *messages) {
+    char inputFileNames[READ_AHEAD_FILES][MAX_LINE_LENGTH];
+    int inputFiles = 0;
+    int count;
+    char *program;
+
+    for (count = 0; count < READ_AHEAD_FILES && (program = takeProgram(next, context, &messages[count])) != NULL; count++) {
+        programs[count] = malloc(strlen(program) + 1);
+        if (programs[count] == NULL) {
+            memory_allocation_failed();
+        }
+        strcpy(programs[count], program);
+
+        /* A name that is too long is reported by read_compilation_unit() */
+        if (strlen(program) + strlen(".as") < MAX_LINE_LENGTH) {
+            sprintf(inputFileNames[inputFiles++], "%s.as", program);
+        }
+    }
+
+    prefetch_files(inputFileNames, inputFiles);
+
+    return count;
+}
+
+/**
+ * Compile in a Pipeline
+ *
+ * Compiles the programs one at a time but overlaps the stages of consecutive files, so reading a file
+ * (and waiting for the disk) hides behind assembling the file before it.
+ * The calling thread reads, two threads assemble and write.
+ *
+ * @param next - Returns the programs.
+ * @param context - Passed to next as is.
+ * @param options - The options of the files.
+ * @return True if the programs were compiled, False if the pipeline could not be started (before any program was taken).
+ */
+static bool compilePipelined(NextProgram next, void *context, const CompileOptions *options) {
+    Pipeline pipeline;
+    ConsoleCapture *previousCapture;
+    pthread_t assemblingThread, writingThread;
+    StagedFile *file;
+    char *programs[READ_AHEAD_FILES];
+    ConsoleCapture messages[READ_AHEAD_FILES + 1];
+    bool started = False;
+    int count;
+    int i;
+
+    if (create_queue(&pipeline.freeFiles, PIPELINE_DEPTH)) {
+        if (create_queue(&pipeline.readFiles, PIPELINE_DEPTH)) {
+            if (create_queue(&pipeline.assembledFiles, PIPELINE_DEPTH)) {
+                started = True;
+            } else {
+                free_queue(&pipeline.readFiles);
+                free_queue(&pipeline.freeFiles);
+            }
+        } else {
+            free_queue(&pipeline.freeFiles);
+        }
+    }
+
+    if (!started) {
+        return False;
+    }
+
+    /* Every file keeps its workspace, so the tables are reused as in compileSequentially() */
+    for (i = 0; i < PIPELINE_DEPTH; i++) {
+        pipeline.files[i].unit.workspace = create_workspace(options);
+        pipeline.files[i].last = False;
+        queue_push(&pipeline.freeFiles, &pipeline.files[i]);
+    }
+
+    started = (pthread_create(&assemblingThread, NULL, assemblingStage, &pipeline) == 0);
+
+    if (started && pthread_create(&writingThread, NULL, writingStage, &pipeline) != 0) {
+
+        /* Stop the assembling stage, nothing was taken from next yet */
+        file = (StagedFile *)queue_pop(&pipeline.freeFiles);
+        file->last = True;
+        queue_push(&pipeline.readFiles, file);
+        queue_pop(&pipeline.assembledFiles);
+        pthread_join(assemblingThread, NULL);
+        started = False;
+    }
+
+    if (started) {
+        do {
+            count = readAhead(next, context, programs, messages);
+
+            for (i = 0; i < count; i++) {
+                file = (StagedFile *)queue_pop(&pipeline.freeFiles);
+
+                if (!open_console_capture(&file->capture)) {
+                    memory_allocation_failed();
+                }
+
+                /* A file that does not exist goes down the stages as well, its messages keep their place */
+                previousCapture = set_console_capture(&file->capture);
+                replay_console_capture(&messages[i]);
+                read_compilation_unit(programs[i], &file->unit);
+                set_console_capture(previousCapture);
+
+                queue_push(&pipeline.readFiles, file);
+                free(programs[i]);
+            }
+        } while (count == READ_AHEAD_FILES);
+
+        file = (StagedFile *)queue_pop(&pipeline.freeFiles);
+        file->last = True;
+        queue_push(&pipeline.readFiles, file);
+
+        pthread_join(assemblingThread, NULL);
+        pthread_join(writingThread, NULL);
+
+        /* What next printed after the last program, every file was printed by now */
+        replay_console_capture(&messages[count]);
+    }
+
+    for (i = 0; i < PIPELINE_DEPTH; i++) {
+        free_workspace(pipeline.files[i].unit.workspace);
+    }
+
+    free_queue(&pipeline.freeFiles);
+    free_queue(&pipeline.readFiles);
+    free_queue(&pipeline.assembledFiles);
+
+    return started;
+}
+
+void compile_programs(NextProgram next, void *context, const CompileOptions *options) {
+    Scheduler scheduler;
+    ConsoleCapture messages;        /* What next printed while taking the program */
+    struct pollfd events[2];
+    bool underMake;
+    bool useTokens;
+    bool canStart;
+    char token;
+    char *program;
+    int i;
+
+    useTokens = connectJobserver(&scheduler.jobserver, &underMake);
+
+    /* make without -j runs one job at a time, and so does the assembler */
+    scheduler.limit = (useTokens ? MAX_JOBS : (underMake ? 1 : fixedJobCount(options)));
+
+    /* The jobs besides the first one, and the chunk threads of every job, run on tokens */
+    if (useTokens) {
+        scheduler.tokens.acquire = acquireToken;
+        scheduler.tokens.release = releaseToken;
+        scheduler.tokens.source = &scheduler.jobserver;
+    } else {
+        scheduler.freeSlots = scheduler.limit - 1;
+        scheduler.tokens.acquire = acquireSlot;
+        scheduler.tokens.release = releaseSlot;
+        scheduler.tokens.source = &scheduler.freeSlots;
+    }
+
+    if (scheduler.limit <= 1 || pipe(scheduler.completionPipe) != 0) {
+        disconnectJobserver(&scheduler.jobserver);
+
+        if (!compilePipelined(next, context, options)) {
+            compileSequentially(next, context, options);
+        }
+        return;
+    }
+
+    scheduler.window = scheduler.limit * PENDING_FILES_PER_JOB;
+    scheduler.jobs = malloc(scheduler.window * sizeof(Job));
+    scheduler.workspaces = malloc(scheduler.limit * sizeof(Workspace *));
+    if (scheduler.jobs == NULL || scheduler.workspaces == NULL) {
+        memory_allocation_failed();
+    }
+
+    scheduler.firstSequence = 0;
+    scheduler.nextSequence = 0;
+    scheduler.running = 0;
+    scheduler.freeWorkspaces = 0;
+    scheduler.options = options;
+
+    program = takeProgram(next, context, &messages);
+
+    while (program != NULL || scheduler.running > 0) {
+
+        canStart = (program != NULL && scheduler.running < scheduler.limit &&
+                    scheduler.nextSequence - scheduler.firstSequence < scheduler.window);
+
+        /* The first job runs on the token make gave the assembler itself (or on the first slot of the limit) */
+        if (canStart && scheduler.running == 0) {
+            startJob(&scheduler, program, &messages, False, 0);
+            program = takeProgram(next, context, &messages);
+            continue;
+        }
+
+        if (canStart && scheduler.tokens.acquire(scheduler.tokens.source, &token)) {
+            startJob(&scheduler, program, &messages, True, token);
+            program = takeProgram(next, context, &messages);
+            continue;
+        }
+
+        /* Wait for a job to be done, or for a token when another job can start. Without a jobserver the slots
+         * are taken by the chunk threads of the running jobs, a job that is done gives back its slot and theirs */
+        events[0].fd = scheduler.completionPipe[0];
+        events[0].events = POLLIN;
+        events[0].revents = 0;
+        events[1].fd = scheduler.jobserver.readFd;
+        events[1].events = POLLIN;
+        events[1].revents = 0;
+
+        if (poll(events, (canStart && useTokens) ? 2 : 1, -1) < 0 && errno != EINTR) {
+            finishJob(&scheduler);
+            continue;
+        }
+
+        if (events[0].revents & POLLIN) {
+            finishJob(&scheduler);
+        }
+
+        /* make is gone, only the jobs already running finish */
+        if (canStart && useTokens && (events[1].revents & (POLLHUP | POLLERR | POLLNVAL)) && !(events[1].revents & POLLIN)) {
+            scheduler.limit = 1;
+        }
+    }
+
+    /* What next printed after the last program, every file was printed by now */
+    replay_console_capture(&messages);
+
+    for (i = 0; i < scheduler.freeWorkspaces; i++) {
+        free_workspace(scheduler.workspaces[i]);
+    }
+
+    free(scheduler.workspaces);
+    free(scheduler.jobs);
+    close(scheduler.completionPipe[0]);
+    close(scheduler.completionPipe[1]);
+    disconnectJobserver(&scheduler.jobserver);
+}
+
+void limit_thread_tokens(const CompileOptions *options, ThreadTokens *tokens, int *freeSlots) {
+
+    /* The calling thread is the first job */
+    *freeSlots = fixedJobCount(options) - 1;
+    tokens->acquire = acquireSlot;
+    tokens->release = releaseSlot;
+    tokens->source = freeSlots;
+}
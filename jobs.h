@@ -0,0 +1,67 @@
+#ifndef _JOBS_H
+#define _JOBS_H
+
+/* Expects global_definitions.h and compilation.h to be included first */
+
+/* Defined in parallel.h */
+struct ThreadTokens;
+
+/* ------------------------------------ Static Definitions ------------------------------------ */
+
+/* Upper bound on the number of files assembled at the same time */
+#ifndef MAX_JOBS
+#define MAX_JOBS 64
+#endif
+
+/* Files in flight per job, a file that is done waits here until the files before it printed their messages */
+#define PENDING_FILES_PER_JOB 4
+
+/* Files in flight in the pipeline of a single job, enough for one in every stage and one waiting between them */
+#define PIPELINE_DEPTH 5
+
+/* The number of jobs when not run by make, the number of processors when it is not set */
+#define JOBS_VARIABLE "ASSEMBLER_JOBS"
+
+/* Where GNU make passes its jobserver, "<read fd>,<write fd>" or "fifo:<path>" ("--jobserver-fds=" before make 4.2) */
+#define MAKE_FLAGS_VARIABLE "MAKEFLAGS"
+#define JOBSERVER_AUTH_OPTION "--jobserver-auth="
+#define JOBSERVER_FDS_OPTION "--jobserver-fds="
+#define JOBSERVER_FIFO_PREFIX "fifo:"
+
+#define JOBS_ERROR "Error while waiting for the assembler jobs."
+
+
+/* ------------------------------------ Data Types ------------------------------------ */
+
+/* Returns the next program to compile, NULL when there are no more. The program stays valid until the next call */
+typedef char *(*NextProgram)(void *context);
+
+
+/* ------------------------------------ Functions ------------------------------------ */
+
+/** compile_programs
+ *  @brief Compiles programs on parallel threads. Under make -j every thread but the first takes a token of the
+ *         make jobserver for each file, so the assembler and the other jobs of make never run more than -j jobs.
+ *         Under make without a jobserver the files go through a single job, whose stages (reading, assembling
+ *         and writing) overlap for consecutive files. Outside of make the files are compiled on JOBS_VARIABLE
+ *         (or the number of processors) jobs.
+ *         The threads a job starts to split a large file (see run_chunks) take tokens the same way, from the jobserver
+ *         or from the job limit, so a single job under make without a jobserver stays on a single thread.
+ *         The messages of the files are printed in the order the programs were given, as if compiled one after another.
+ *  @param next Returns the programs.
+ *  @param context Passed to next as is.
+ *  @param options The options of the files.
+ */
+void compile_programs(NextProgram next, void *context, const CompileOptions *options);
+
+/** limit_thread_tokens
+ *  @brief Sets up the tokens of a thread that compiles files one after another outside of make, as the daemon does
+ *         for a request: the threads that split a large file (see run_chunks) stay within JOBS_VARIABLE
+ *         (or the number of processors) threads, the calling thread included.
+ *  @param options The options of the files.
+ *  @param tokens Receives the tokens, to be set with set_thread_tokens.
+ *  @param freeSlots Holds the threads left, must outlive the tokens.
+ */
+void limit_thread_tokens(const CompileOptions *options, struct ThreadTokens *tokens, int *freeSlots);
+
+#endif
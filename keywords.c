@@ -0,0 +1,90 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "global_definitions.h"
+#include "utility_functions.h"
+#include "identification.h"
+#include "keywords.h"
+
+/**
+ * Match Keyword
+ *
+ * Compares a word against the only reserved word it can be.
+ *
+ * @param word - The word (not null terminated).
+ * @param length - The length of the word, the same as the length of the candidate.
+ * @param candidate - The reserved word.
+ * @param kind - The kind of the reserved word.
+ * @param value - The value of the reserved word.
+ * @return The keyword when the word is the candidate, a NOT_A_KEYWORD keyword otherwise.
+ */
+static Keyword matchKeyword(const char *word, int length, const char *candidate, KeywordKind kind, int value) {
+    Keyword keyword;
+
+    keyword.kind = NOT_A_KEYWORD;
+    keyword.value = 0;
+
+    if (memcmp(word, candidate, length) == 0) {
+        keyword.kind = kind;
+        keyword.value = value;
+    }
+
+    return keyword;
+}
+
+Keyword find_keyword(const char *word, int length) {
+    Keyword notAKeyword;
+
+    notAKeyword.kind = NOT_A_KEYWORD;
+    notAKeyword.value = 0;
+
+    /* The length and the first character leave at most two candidates, the second character picks one */
+    switch (length) {
+
+        case 2:
+            if (word[0] == 'r' && word[1] >= '0' && word[1] <= '7') {
+                return matchKeyword(word, length, word, REGISTER_KEYWORD, word[1] - '0');
+            }
+            break;
+
+        case 3:
+            switch (word[0]) {
+                case 'a': return matchKeyword(word, length, "add", INSTRUCTION_KEYWORD, ADD);
+                case 'b': return matchKeyword(word, length, "bne", INSTRUCTION_KEYWORD, BNE);
+                case 'c': return word[1] == 'm' ? matchKeyword(word, length, "cmp", INSTRUCTION_KEYWORD, CMP)
+                                                : matchKeyword(word, length, "clr", INSTRUCTION_KEYWORD, CLR);
+                case 'd': return matchKeyword(word, length, "dec", INSTRUCTION_KEYWORD, DEC);
+                case 'h': return matchKeyword(word, length, "hlt", INSTRUCTION_KEYWORD, HLT);
+                case 'i': return matchKeyword(word, length, "inc", INSTRUCTION_KEYWORD, INC);
+                case 'j': return word[1] == 'm' ? matchKeyword(word, length, "jmp", INSTRUCTION_KEYWORD, JMP)
+                                                : matchKeyword(word, length, "jsr", INSTRUCTION_KEYWORD, JSR);
+                case 'l': return matchKeyword(word, length, "lea", INSTRUCTION_KEYWORD, LEA);
+                case 'm': return matchKeyword(word, length, "mov", INSTRUCTION_KEYWORD, MOV);
+                case 'n': return matchKeyword(word, length, "not", INSTRUCTION_KEYWORD, NOT);
+                case 'p': return matchKeyword(word, length, "prn", INSTRUCTION_KEYWORD, PRN);
+                case 'r': return word[1] == 'e' ? matchKeyword(word, length, "red", INSTRUCTION_KEYWORD, RED)
+                                                : matchKeyword(word, length, "rts", INSTRUCTION_KEYWORD, RTS);
+                case 's': return matchKeyword(word, length, "sub", INSTRUCTION_KEYWORD, SUB);
+            }
+            break;
+
+        case 4:
+            return matchKeyword(word, length, "data", DIRECTIVE_KEYWORD, DATA_DIRECTIVE);
+
+        case 5:
+            return matchKeyword(word, length, "entry", DIRECTIVE_KEYWORD, ENTRY_DIRECTIVE);
+
+        case 7:
+            return matchKeyword(word, length, "include", DIRECTIVE_KEYWORD, INCLUDE_DIRECTIVE);
+
+        case 6:
+            switch (word[0]) {
+                case 's': return matchKeyword(word, length, "string", DIRECTIVE_KEYWORD, STRING_DIRECTIVE);
+                case 'e': return matchKeyword(word, length, "extern", DIRECTIVE_KEYWORD, EXTERN_DIRECTIVE);
+                case 'd': return matchKeyword(word, length, "define", DIRECTIVE_KEYWORD, CONSTANT);
+            }
+            break;
+    }
+
+    return notAKeyword;
+}
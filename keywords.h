@@ -0,0 +1,35 @@
+#ifndef _KEYWORDS_H
+#define _KEYWORDS_H
+
+/* ------------------------------------ Data Types ------------------------------------ */
+
+/* The kinds of reserved words */
+typedef enum KeywordKind {
+    NOT_A_KEYWORD,
+    INSTRUCTION_KEYWORD,        /* mov ... hlt */
+    DIRECTIVE_KEYWORD,          /* data, string, include, entry, extern and define (without their '.') */
+    REGISTER_KEYWORD            /* r0 ... r7 */
+
+} KeywordKind;
+
+/* A recognized word */
+typedef struct Keyword
+{
+    KeywordKind kind;
+    int value;                  /* The InstructionType of an instruction, the CommandType of a directive
+                                   (CONSTANT for define) or the number of a register */
+
+} Keyword;
+
+
+/* ------------------------------------ Functions ------------------------------------ */
+
+/** find_keyword
+ *  @brief Recognizes a reserved word by its length and first characters, with a single comparison against the only possible candidate.
+ *  @param word The word, does not need to be null terminated.
+ *  @param length The length of the word.
+ *  @return The keyword, its kind is NOT_A_KEYWORD when the word is not reserved.
+ */
+Keyword find_keyword(const char *word, int length);
+
+#endif
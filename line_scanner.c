@@ -0,0 +1,499 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include "global_definitions.h"
+#include "line_scanner.h"
+#include "diagnostics.h"
+
+/* The vector paths read whole aligned blocks, which may run past the end of the text (never past the
+ * page holding it). That is safe on real hardware but is reported by the address and thread sanitizers,
+ * so the scalar loops are used in sanitized builds. */
+#if defined(__SSE2__) && !defined(__SANITIZE_ADDRESS__) && !defined(__SANITIZE_THREAD__)
+#define LINE_SCANNER_SIMD
+#endif
+
+/* Initial capacity of the line starts array, it grows by doubling */
+#define INITIAL_LINE_STARTS 64
+
+#ifdef LINE_SCANNER_SIMD
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+#define SCAN_BLOCK_WIDTH 32
+#define SCAN_BLOCK_MASK 0xFFFFFFFFUL
+
+typedef __m256i ScanVector;
+
+#define vectorLoad(pointer) _mm256_load_si256((const __m256i *)(pointer))
+#define vectorSplat(character) _mm256_set1_epi8(character)
+#define vectorEquals(block, splat) ((unsigned long)(unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8((block), (splat))))
+#define vectorSubtract(block, splat) _mm256_sub_epi8((block), (splat))
+#define vectorSaturatedSubtract(block, splat) _mm256_subs_epu8((block), (splat))
+
+#else
+
+#include <emmintrin.h>
+
+#define SCAN_BLOCK_WIDTH 16
+#define SCAN_BLOCK_MASK 0xFFFFUL
+
+typedef __m128i ScanVector;
+
+#define vectorLoad(pointer) _mm_load_si128((const __m128i *)(pointer))
+#define vectorSplat(character) _mm_set1_epi8(character)
+#define vectorEquals(block, splat) ((unsigned long)(unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8((block), (splat))))
+#define vectorSubtract(block, splat) _mm_sub_epi8((block), (splat))
+#define vectorSaturatedSubtract(block, splat) _mm_subs_epu8((block), (splat))
+
+#endif
+
+/* Bit masks of one block of the line, bit i stands for the i-th byte of the block */
+typedef struct BlockMasks
+{
+    unsigned long valid;        /* Bytes that belong to the line */
+    unsigned long space;
+    unsigned long control;      /* '\t', '\n', '\v', '\f' and '\r' */
+    unsigned long colon;
+    unsigned long dot;
+    unsigned long quote;
+    unsigned long comment;
+
+} BlockMasks;
+
+/** Lowest Bit
+ *
+ * @param mask - A non zero mask.
+ * @return The index of the lowest set bit.
+ */
+static int lowestBit(unsigned long mask) {
+#if defined(__GNUC__)
+    return __builtin_ctzl(mask);
+#else
+    int bit = 0;
+    while (!(mask & 1UL)) {
+        mask >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+/** Highest Bit
+ *
+ * @param mask - A non zero mask.
+ * @return The index of the highest set bit.
+ */
+static int highestBit(unsigned long mask) {
+    int bit = 0;
+#if defined(__GNUC__)
+    bit = (int)(sizeof(unsigned long) * 8) - 1 - __builtin_clzl(mask);
+#else
+    while (mask >>= 1) {
+        bit++;
+    }
+#endif
+    return bit;
+}
+
+/** Block Offset
+ *
+ * @param text - The start of the text.
+ * @return The number of bytes between the aligned block holding the text and the text itself.
+ */
+static int blockOffset(const char *text) {
+    return (int)((size_t)text & (SCAN_BLOCK_WIDTH - 1));
+}
+
+/** Bytes From
+ *
+ * @param first - The index of the first byte in the block to keep.
+ * @return A mask of the bytes of the block from the given index on.
+ */
+static unsigned long bytesFrom(int first) {
+    return SCAN_BLOCK_MASK & ~((1UL << first) - 1UL);
+}
+
+/** Control Mask
+ *
+ * @param block - The block to test.
+ * @return The '\t' ... '\r' bytes of the block.
+ */
+static unsigned long controlMask(ScanVector block) {
+    /* block - '\t' lands in [0, '\r' - '\t'] only for the control whitespaces */
+    ScanVector distance = vectorSaturatedSubtract(vectorSubtract(block, vectorSplat('\t')), vectorSplat('\r' - '\t'));
+    return vectorEquals(distance, vectorSplat(0));
+}
+
+/** Digit Mask
+ *
+ * @param block - The block to test.
+ * @return The '0' ... '9' bytes of the block.
+ */
+static unsigned long digitMask(ScanVector block) {
+    /* block - '0' lands in [0, 9] only for the digits */
+    ScanVector distance = vectorSaturatedSubtract(vectorSubtract(block, vectorSplat('0')), vectorSplat(9));
+    return vectorEquals(distance, vectorSplat(0));
+}
+
+/** White Space Mask
+ *
+ * @param block - The block to test.
+ * @return The bytes of the block that isspace() accepts.
+ */
+static unsigned long whiteSpaceMask(ScanVector block) {
+    return vectorEquals(block, vectorSplat(' ')) | controlMask(block);
+}
+
+/** Record First
+ *
+ * Stores the position of the lowest bit of the mask unless the position was already found in an earlier block.
+ *
+ * @param position - The scan field to update.
+ * @param base - The offset of the block's first byte from the start of the line.
+ * @param mask - The matches in this block.
+ */
+static void recordFirst(int *position, long base, unsigned long mask) {
+    if (*position < 0 && mask) {
+        *position = (int)(base + lowestBit(mask));
+    }
+}
+
+/** Record Block
+ *
+ * Folds the masks of one block into the scan.
+ *
+ * @param scan - The scan being built.
+ * @param base - The offset of the block's first byte from the start of the line (negative for the first, aligned block).
+ * @param masks - The masks of the block.
+ * @param previousWhiteSpace - Whether the byte before the block was a whitespace of the line, updated for the next block.
+ */
+static void recordBlock(LineScan *scan, long base, BlockMasks *masks, unsigned long *previousWhiteSpace) {
+    unsigned long whiteSpace = (masks->space | masks->control) & masks->valid;
+    unsigned long nonSpace = masks->valid & ~whiteSpace;
+    unsigned long repeatedSpace = masks->space & ((whiteSpace << 1) | *previousWhiteSpace);
+
+    recordFirst(&scan->firstNonSpace, base, nonSpace);
+    recordFirst(&scan->firstSpace, base, whiteSpace);
+    recordFirst(&scan->firstIrregularSpace, base, (masks->control | repeatedSpace) & masks->valid);
+    recordFirst(&scan->colon, base, masks->colon & masks->valid);
+    recordFirst(&scan->dot, base, masks->dot & masks->valid);
+    recordFirst(&scan->quote, base, masks->quote & masks->valid);
+    recordFirst(&scan->comment, base, masks->comment & masks->valid);
+
+    if (nonSpace) {
+        scan->lastNonSpace = (int)(base + highestBit(nonSpace));
+    }
+
+    *previousWhiteSpace = (whiteSpace >> (SCAN_BLOCK_WIDTH - 1)) & 1UL;
+}
+
+#endif
+
+/** Reset Line Scan
+ *
+ * Marks every position of the scan as not found.
+ *
+ * @param scan - The scan to reset.
+ */
+static void resetLineScan(LineScan *scan) {
+    scan->length = 0;
+    scan->firstNonSpace = -1;
+    scan->lastNonSpace = -1;
+    scan->firstSpace = -1;
+    scan->firstIrregularSpace = -1;
+    scan->colon = -1;
+    scan->dot = -1;
+    scan->quote = -1;
+    scan->comment = -1;
+}
+
+/** Is White Space
+ *
+ * @param c - The character to test.
+ * @return 1 for the characters isspace() accepts in the "C" locale, 0 otherwise.
+ */
+static int isWhiteSpace(char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+void scanLine(const char *line, LineScan *scan) {
+#ifdef LINE_SCANNER_SIMD
+    int skipped = blockOffset(line);
+    const char *cursor = line - skipped;
+    unsigned long previousWhiteSpace = 0;
+    BlockMasks masks;
+    unsigned long zero;
+
+    resetLineScan(scan);
+
+    for (;;) {
+        ScanVector block = vectorLoad(cursor);
+
+        zero = vectorEquals(block, vectorSplat('\0')) & bytesFrom(skipped);
+        masks.valid = bytesFrom(skipped);
+        masks.space = vectorEquals(block, vectorSplat(' '));
+        masks.control = controlMask(block);
+        masks.colon = vectorEquals(block, vectorSplat(':'));
+        masks.dot = vectorEquals(block, vectorSplat('.'));
+        masks.quote = vectorEquals(block, vectorSplat('"'));
+        masks.comment = vectorEquals(block, vectorSplat(';'));
+
+        /* Drop the bytes from the terminating '\0' on */
+        if (zero) {
+            masks.valid &= (1UL << lowestBit(zero)) - 1UL;
+        }
+
+        recordBlock(scan, (long)(cursor - line), &masks, &previousWhiteSpace);
+
+        if (zero) {
+            scan->length = (int)((cursor - line) + lowestBit(zero));
+            return;
+        }
+
+        skipped = 0;
+        cursor += SCAN_BLOCK_WIDTH;
+    }
+#else
+    int i;
+    int previousWhiteSpace = 0;
+
+    resetLineScan(scan);
+
+    for (i = 0; line[i] != '\0'; i++) {
+        char c = line[i];
+
+        if (isWhiteSpace(c)) {
+            if (scan->firstSpace < 0) {
+                scan->firstSpace = i;
+            }
+            if (scan->firstIrregularSpace < 0 && (c != ' ' || previousWhiteSpace)) {
+                scan->firstIrregularSpace = i;
+            }
+            previousWhiteSpace = 1;
+            continue;
+        }
+
+        previousWhiteSpace = 0;
+        if (scan->firstNonSpace < 0) {
+            scan->firstNonSpace = i;
+        }
+        scan->lastNonSpace = i;
+
+        if (c == ':' && scan->colon < 0) {
+            scan->colon = i;
+        } else if (c == '.' && scan->dot < 0) {
+            scan->dot = i;
+        } else if (c == '"' && scan->quote < 0) {
+            scan->quote = i;
+        } else if (c == ';' && scan->comment < 0) {
+            scan->comment = i;
+        }
+    }
+
+    scan->length = i;
+#endif
+}
+
+const char *skipWhiteSpaces(const char *text) {
+#ifdef LINE_SCANNER_SIMD
+    int skipped = blockOffset(text);
+    const char *cursor = text - skipped;
+    unsigned long stop;
+
+    /* The terminating '\0' is not a whitespace, so it stops the loop as well */
+    for (;;) {
+        stop = ~whiteSpaceMask(vectorLoad(cursor)) & bytesFrom(skipped);
+        if (stop) {
+            return cursor + lowestBit(stop);
+        }
+        skipped = 0;
+        cursor += SCAN_BLOCK_WIDTH;
+    }
+#else
+    while (isWhiteSpace(*text)) {
+        text++;
+    }
+    return text;
+#endif
+}
+
+const char *skipWord(const char *text) {
+#ifdef LINE_SCANNER_SIMD
+    int skipped = blockOffset(text);
+    const char *cursor = text - skipped;
+    unsigned long stop;
+
+    for (;;) {
+        ScanVector block = vectorLoad(cursor);
+
+        stop = (whiteSpaceMask(block) | vectorEquals(block, vectorSplat('\0'))) & bytesFrom(skipped);
+        if (stop) {
+            return cursor + lowestBit(stop);
+        }
+        skipped = 0;
+        cursor += SCAN_BLOCK_WIDTH;
+    }
+#else
+    while (*text != '\0' && !isWhiteSpace(*text)) {
+        text++;
+    }
+    return text;
+#endif
+}
+
+const char *skipDigits(const char *text) {
+#ifdef LINE_SCANNER_SIMD
+    int skipped = blockOffset(text);
+    const char *cursor = text - skipped;
+    unsigned long stop;
+
+    /* The terminating '\0' is not a digit, so it stops the loop as well */
+    for (;;) {
+        stop = ~digitMask(vectorLoad(cursor)) & bytesFrom(skipped);
+        if (stop) {
+            return cursor + lowestBit(stop);
+        }
+        skipped = 0;
+        cursor += SCAN_BLOCK_WIDTH;
+    }
+#else
+    while (*text >= '0' && *text <= '9') {
+        text++;
+    }
+    return text;
+#endif
+}
+
+/** Add Line Start
+ *
+ * Appends an offset to the line starts array, growing it when needed.
+ *
+ * @param lineStarts - The array of line starts.
+ * @param count - The number of offsets in the array, incremented.
+ * @param capacity - The capacity of the array, updated when it grows.
+ * @param offset - The offset to append.
+ */
+static void addLineStart(int **lineStarts, int *count, int *capacity, int offset) {
+    if (*count == *capacity) {
+        *capacity *= 2;
+        *lineStarts = realloc(*lineStarts, *capacity * sizeof(int));
+        if (*lineStarts == NULL) {
+            memory_allocation_failed();
+        }
+    }
+    (*lineStarts)[(*count)++] = offset;
+}
+
+int *indexLines(const char *data, int length, int *lineCount) {
+    int capacity = INITIAL_LINE_STARTS;
+    int count = 0;
+    int *lineStarts = malloc(capacity * sizeof(int));
+#ifdef LINE_SCANNER_SIMD
+    int skipped = blockOffset(data);
+    const char *cursor = data - skipped;
+    unsigned long newLines;
+    int newLine;
+#else
+    int i;
+#endif
+
+    if (lineStarts == NULL) {
+        memory_allocation_failed();
+    }
+
+    if (length > 0) {
+        lineStarts[count++] = 0;
+    }
+
+#ifdef LINE_SCANNER_SIMD
+    while (cursor < data + length) {
+        newLines = vectorEquals(vectorLoad(cursor), vectorSplat('\n')) & bytesFrom(skipped);
+
+        while (newLines) {
+            newLine = (int)(cursor - data) + lowestBit(newLines);
+            newLines &= newLines - 1UL;
+
+            /* A '\n' past the end of the text belongs to whatever follows it in memory */
+            if (newLine >= length) {
+                break;
+            }
+            if (newLine + 1 < length) {
+                addLineStart(&lineStarts, &count, &capacity, newLine + 1);
+            }
+        }
+
+        skipped = 0;
+        cursor += SCAN_BLOCK_WIDTH;
+    }
+#else
+    for (i = 0; i + 1 < length; i++) {
+        if (data[i] == '\n') {
+            addLineStart(&lineStarts, &count, &capacity, i + 1);
+        }
+    }
+#endif
+
+    *lineCount = count;
+
+    /* The end of the text closes the last line */
+    addLineStart(&lineStarts, &count, &capacity, length);
+
+    return lineStarts;
+}
+
+void splitLine(const char *line, LineParts *parts) {
+    const char *cursor;
+    const char *end;
+
+    line = skipWhiteSpaces(line);
+
+    /* A label ends with a ':' that comes before the first whitespace (as hasLabel) */
+    for (cursor = line; *cursor != '\0' && *cursor != ':' && *cursor != ' ' && *cursor != '\t'; cursor++);
+
+    parts->label.start = line;
+    parts->label.length = 0;
+
+    if (*cursor == ':') {
+        parts->label.length = (int)(cursor - line);
+        line = skipWhiteSpaces(cursor + 1);
+    }
+
+    cursor = skipWord(line);
+    parts->keyword.start = line;
+    parts->keyword.length = (int)(cursor - line);
+
+    /* The operands run up to the last character that is not a whitespace */
+    line = skipWhiteSpaces(cursor);
+    for (end = line; *end != '\0'; end++);
+    while (end > line && isWhiteSpace(end[-1])) {
+        end--;
+    }
+
+    parts->operands.start = line;
+    parts->operands.length = (int)(end - line);
+}
+
+char *copySpan(Span span, char *buffer, int size) {
+    int length = (span.length < size - 1 ? span.length : size - 1);
+
+    memcpy(buffer, span.start, length);
+    buffer[length] = '\0';
+
+    return buffer;
+}
+
+char *compactSpan(Span span, char *buffer, int size) {
+    int i, j;
+
+    for (i = 0, j = 0; i < span.length && j < size - 1; i++) {
+        if (!isWhiteSpace(span.start[i])) {
+            buffer[j++] = span.start[i];
+        }
+    }
+    buffer[j] = '\0';
+
+    return buffer;
+}
@@ -0,0 +1,107 @@
+#ifndef _LINE_SCANNER_H
+#define _LINE_SCANNER_H
+
+/* ------------------------------------ Structures ------------------------------------ */
+
+/* Positions of the characters the classifier cares about in a single line.
+ * Every position is an offset from the start of the line, -1 when the character does not appear. */
+typedef struct LineScan
+{
+    int length;                 /* Length of the line (offset of the terminating '\0') */
+    int firstNonSpace;          /* First character that is not a whitespace */
+    int lastNonSpace;           /* Last character that is not a whitespace */
+    int firstSpace;             /* First whitespace (space, tab, newline, ...) */
+    int firstIrregularSpace;    /* First whitespace cleanCommand has to rewrite (not a space, or a repeated one) */
+    int colon;                  /* First ':' */
+    int dot;                    /* First '.' */
+    int quote;                  /* First '"' */
+    int comment;                /* First ';' */
+
+} LineScan;
+
+/* A part of a line, it is not null terminated */
+typedef struct Span
+{
+    const char *start;
+    int length;
+
+} Span;
+
+/* The parts of a line (see splitLine) */
+typedef struct LineParts
+{
+    Span label;                 /* The label without its ':', empty when the line has none */
+    Span keyword;               /* The directive (with its '.') or the instruction name */
+    Span operands;              /* Everything after the keyword, without the surrounding whitespaces */
+
+} LineParts;
+
+
+/* ------------------------------------ Functions ------------------------------------ */
+
+/** scanLine
+ *  @brief Finds all the LineScan positions of a line in a single pass.
+ *         Uses AVX2 or SSE2 when the compiler targets them, and a scalar loop otherwise (as do all the functions below).
+ *  @param line The null terminated line to be scanned.
+ *  @param scan The structure to be filled.
+ */
+void scanLine(const char *line, LineScan *scan);
+
+/** skipWhiteSpaces
+ *  @brief Skips the whitespaces (the characters isspace() accepts) at the start of a text.
+ *  @param text The null terminated text.
+ *  @return The first character that is not a whitespace, or the terminating '\0'.
+ */
+const char *skipWhiteSpaces(const char *text);
+
+/** skipWord
+ *  @brief Skips the characters up to the next whitespace.
+ *  @param text The null terminated text.
+ *  @return The first whitespace, or the terminating '\0'.
+ */
+const char *skipWord(const char *text);
+
+/** skipDigits
+ *  @brief Skips the decimal digits at the start of a text.
+ *  @param text The null terminated text.
+ *  @return The first character that is not a digit, or the terminating '\0'.
+ */
+const char *skipDigits(const char *text);
+
+/** indexLines
+ *  @brief Finds where every line of a text starts, in a single pass over the text.
+ *         A line ends after its '\n', the last line may end without one.
+ *  @param data The text, does not need to be null terminated.
+ *  @param length The length of the text.
+ *  @param lineCount Receives the number of lines.
+ *  @return An allocated array of lineCount + 1 offsets, the last one is the length of the text
+ *          so line i spans [lineStarts[i], lineStarts[i + 1]).
+ */
+int *indexLines(const char *data, int length, int *lineCount);
+
+/** splitLine
+ *  @brief Splits a line into its label, keyword and operands in a single pass, without modifying it.
+ *  @param line The null terminated line.
+ *  @param parts Receives the parts, they point into the line.
+ */
+void splitLine(const char *line, LineParts *parts);
+
+/** copySpan
+ *  @brief Copies a span into a null terminated buffer, a span that does not fit is cut.
+ *  @param span The span.
+ *  @param buffer The buffer.
+ *  @param size The size of the buffer.
+ *  @return The buffer.
+ */
+char *copySpan(Span span, char *buffer, int size);
+
+/** compactSpan
+ *  @brief Copies a span into a null terminated buffer without its whitespaces, a span that does not fit is cut.
+ *  @param span The span.
+ *  @param buffer The buffer.
+ *  @param size The size of the buffer.
+ *  @return The buffer.
+ */
+char *compactSpan(Span span, char *buffer, int size);
+
+#endif
@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "global_definitions.h"
+#include "diagnostics.h"
+#include "manifest.h"
+
+const char *manifest_argument(const char *argument) {
+
+    if (strncmp(argument, MANIFEST_PREFIX, strlen(MANIFEST_PREFIX)) == 0) {
+        return argument + strlen(MANIFEST_PREFIX);
+    }
+
+    if (strncmp(argument, MANIFEST_OPTION, strlen(MANIFEST_OPTION)) == 0) {
+        return argument + strlen(MANIFEST_OPTION);
+    }
+
+    return NULL;
+}
+
+FILE *open_manifest(const char *path) {
+    FILE *manifest;
+
+    if (strcmp(path, MANIFEST_STANDARD_INPUT) == 0) {
+        return stdin;
+    }
+
+    manifest = fopen(path, "r");
+    if (manifest == NULL) {
+        console_perror(FILE_OPEN_ERROR);
+    }
+
+    return manifest;
+}
+
+void close_manifest(FILE *manifest) {
+
+    if (manifest != stdin) {
+        fclose(manifest);
+    }
+}
+
+/**
+ * Skip the Rest of a Line
+ *
+ * @param manifest - The manifest stream.
+ */
+static void skipLine(FILE *manifest) {
+    int character;
+
+    while ((character = getc(manifest)) != EOF && character != '\n')
+        ;
+}
+
+bool next_manifest_program(FILE *manifest, char *program) {
+    char *start;
+    size_t length;
+
+    while (fgets(program, MAX_MANIFEST_LINE_LENGTH, manifest) != NULL) {
+
+        /* A full buffer without its '\n' is a line that does not fit, unless the manifest ends there */
+        length = strlen(program);
+        if (length == MAX_MANIFEST_LINE_LENGTH - 1 && program[length - 1] != '\n' && !feof(manifest)) {
+            skipLine(manifest);
+            console_printf(CONSOLE_ERROR, "%s\n", MANIFEST_LINE_LENGTH_ERROR);
+            continue;
+        }
+
+        /* Drop the spaces (and the '\n') around the program */
+        while (length > 0 && isspace((unsigned char)program[length - 1])) {
+            length--;
+        }
+        program[length] = '\0';
+
+        for (start = program; isspace((unsigned char)*start); start++, length--)
+            ;
+
+        if (length == 0 || *start == '#') {
+            continue;
+        }
+
+        /* The programs are given without their extension, as on the command line */
+        if (length > strlen(".as") && strcmp(start + length - strlen(".as"), ".as") == 0) {
+            length -= strlen(".as");
+            start[length] = '\0';
+        }
+
+        memmove(program, start, length + 1);
+        return True;
+    }
+
+    return False;
+}
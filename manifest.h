@@ -0,0 +1,53 @@
+#ifndef _MANIFEST_H
+#define _MANIFEST_H
+
+#include <stdio.h>
+
+/* Expects global_definitions.h to be included first */
+
+/* ------------------------------------ Static Definitions ------------------------------------ */
+
+/* "@<file>" and "--manifest=<file>" read the programs from <file> instead of the command line, "-" is the standard input.
+ * A manifest lists one program per line, as it would be given on the command line (a trailing ".as" is dropped).
+ * Spaces around a program, empty lines and lines starting with '#' are ignored. */
+#define MANIFEST_PREFIX "@"
+#define MANIFEST_OPTION "--manifest="
+#define MANIFEST_STANDARD_INPUT "-"
+
+/* The longest program name read from a manifest, longer lines are skipped */
+#define MAX_MANIFEST_LINE_LENGTH 4096
+
+#define MANIFEST_LINE_LENGTH_ERROR "Error: a line of the manifest is too long, skipped."
+
+
+/* ------------------------------------ Functions ------------------------------------ */
+
+/** manifest_argument
+ *  @brief Checks whether a command line argument names a manifest.
+ *  @param argument The argument.
+ *  @return The manifest path (MANIFEST_STANDARD_INPUT for the standard input), NULL if the argument is a program.
+ */
+const char *manifest_argument(const char *argument);
+
+/** open_manifest
+ *  @brief Opens a manifest for reading, prints the error when it cannot be opened.
+ *  @param path The manifest path, MANIFEST_STANDARD_INPUT for the standard input.
+ *  @return The manifest stream, NULL on failure.
+ */
+FILE *open_manifest(const char *path);
+
+/** close_manifest
+ *  @brief Closes a manifest opened by open_manifest(), the standard input is left open.
+ *  @param manifest The manifest stream.
+ */
+void close_manifest(FILE *manifest);
+
+/** next_manifest_program
+ *  @brief Reads the next program of a manifest, one line at a time so the list is never held in memory.
+ *  @param manifest The manifest stream.
+ *  @param program Receives the program, MAX_MANIFEST_LINE_LENGTH characters.
+ *  @return True if a program was read, False at the end of the manifest.
+ */
+bool next_manifest_program(FILE *manifest, char *program);
+
+#endif
@@ -0,0 +1,229 @@
+/* Needed for sysconf() and the semaphores when compiling with -ansi */
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdlib.h>
+#include <errno.h>
+#include <setjmp.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <unistd.h>
+#include "global_definitions.h"
+#include "diagnostics.h"
+#include "parallel.h"
+
+/* Defines a chunk of work handed to a thread */
+typedef struct Chunk
+{
+    ChunkWorker worker;
+    void *context;
+    int first;
+    int last;
+    bool guarded;       /* The caller jumps out when memory runs out, the chunk catches the failure instead of exiting */
+    bool failed;        /* Memory ran out in the middle of the chunk */
+} Chunk;
+
+/* The tokens of every thread, so the jobs running at the same time each limit their own chunks */
+static pthread_key_t tokensKey;
+static pthread_once_t tokensKeyOnce = PTHREAD_ONCE_INIT;
+
+/**
+ * Create the Tokens Key
+ */
+static void createTokensKey(void) {
+    pthread_key_create(&tokensKey, NULL);
+}
+
+ThreadTokens *set_thread_tokens(ThreadTokens *tokens) {
+    ThreadTokens *previous;
+
+    pthread_once(&tokensKeyOnce, createTokensKey);
+    previous = (ThreadTokens *)pthread_getspecific(tokensKey);
+    pthread_setspecific(tokensKey, tokens);
+
+    return previous;
+}
+
+int online_processors(void) {
+#ifdef _SC_NPROCESSORS_ONLN
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (processors > 0) {
+        return (int)processors;
+    }
+#endif
+    return 1;
+}
+
+/** Run Chunk
+ *
+ * The thread entry point, processes one chunk.
+ *
+ * @param argument - The chunk.
+ * @return NULL.
+ */
+static void *runChunk(void *argument) {
+    Chunk *chunk = (Chunk *)argument;
+    jmp_buf outOfMemory;
+    DiagnosticSink sink;
+    DiagnosticSink *previousSink;
+
+    if (chunk->guarded == False) {
+        chunk->worker(chunk->context, chunk->first, chunk->last);
+        return NULL;
+    }
+
+    /* The workers report no errors, the sink only catches a failed allocation (see memory_allocation_failed) */
+    sink.diagnostics = NULL;
+    sink.count = 0;
+    sink.capacity = 0;
+    sink.outOfMemory = &outOfMemory;
+    previousSink = set_diagnostic_sink(&sink);
+
+    if (setjmp(outOfMemory) == 0) {
+        chunk->worker(chunk->context, chunk->first, chunk->last);
+    } else {
+        chunk->failed = True;
+    }
+
+    set_diagnostic_sink(previousSink);
+
+    return NULL;
+}
+
+void run_chunks(int count, int minimumChunk, ChunkWorker worker, void *context) {
+    Chunk chunks[MAX_WORKER_THREADS];
+    pthread_t threads[MAX_WORKER_THREADS];
+    int started[MAX_WORKER_THREADS];
+    int threadCount = online_processors();
+    DiagnosticSink *callerSink = current_diagnostic_sink();
+    ThreadTokens *tokens;
+    char heldTokens[MAX_WORKER_THREADS];
+    int tokenCount = 0;
+    bool failed = False;
+    int i;
+
+    if (minimumChunk < 1) {
+        minimumChunk = 1;
+    }
+    if (threadCount > MAX_WORKER_THREADS) {
+        threadCount = MAX_WORKER_THREADS;
+    }
+    if (threadCount > count / minimumChunk) {
+        threadCount = count / minimumChunk;
+    }
+
+    /* Every thread besides the calling one runs on a token, the calling thread already holds one */
+    pthread_once(&tokensKeyOnce, createTokensKey);
+    tokens = (ThreadTokens *)pthread_getspecific(tokensKey);
+    if (tokens != NULL && threadCount > 1) {
+        while (tokenCount < threadCount - 1 && tokens->acquire(tokens->source, &heldTokens[tokenCount])) {
+            tokenCount++;
+        }
+        threadCount = 1 + tokenCount;
+    }
+
+    /* Not worth a thread */
+    if (threadCount <= 1) {
+        worker(context, 0, count);
+        return;
+    }
+
+    for (i = 0; i < threadCount; i++) {
+        chunks[i].worker = worker;
+        chunks[i].context = context;
+        chunks[i].first = (int)((long)count * i / threadCount);
+        chunks[i].last = (int)((long)count * (i + 1) / threadCount);
+        chunks[i].guarded = (callerSink != NULL && callerSink->outOfMemory != NULL);
+        chunks[i].failed = False;
+    }
+
+    /* The calling thread takes the first chunk, a chunk whose thread could not be started is run here as well */
+    for (i = 1; i < threadCount; i++) {
+        started[i] = (pthread_create(&threads[i], NULL, runChunk, &chunks[i]) == 0);
+    }
+
+    runChunk(&chunks[0]);
+
+    for (i = 1; i < threadCount; i++) {
+        if (started[i]) {
+            pthread_join(threads[i], NULL);
+        } else {
+            runChunk(&chunks[i]);
+        }
+    }
+
+    for (i = 0; i < tokenCount; i++) {
+        tokens->release(tokens->source, heldTokens[i]);
+    }
+
+    /* The caller jumps out only once no thread uses its context any more */
+    for (i = 0; i < threadCount; i++) {
+        failed = (failed || chunks[i].failed);
+    }
+    if (failed) {
+        memory_allocation_failed();
+    }
+}
+
+bool create_queue(BoundedQueue *queue, int capacity) {
+
+    queue->items = malloc(capacity * sizeof(void *));
+    if (queue->items == NULL) {
+        return False;
+    }
+
+    queue->capacity = capacity;
+    queue->head = 0;
+    queue->tail = 0;
+
+    if (sem_init(&queue->filledSlots, 0, 0) != 0) {
+        free(queue->items);
+        return False;
+    }
+
+    if (sem_init(&queue->freeSlots, 0, capacity) != 0) {
+        sem_destroy(&queue->filledSlots);
+        free(queue->items);
+        return False;
+    }
+
+    return True;
+}
+
+void queue_push(BoundedQueue *queue, void *item) {
+    unsigned long tail = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+
+    while (sem_wait(&queue->freeSlots) != 0 && errno == EINTR)
+        ;
+
+    /* The release store publishes the item before the consumer can see the new tail */
+    queue->items[tail % queue->capacity] = item;
+    __atomic_store_n(&queue->tail, tail + 1, __ATOMIC_RELEASE);
+
+    sem_post(&queue->filledSlots);
+}
+
+void *queue_pop(BoundedQueue *queue) {
+    unsigned long head = __atomic_load_n(&queue->head, __ATOMIC_RELAXED);
+    void *item;
+
+    while (sem_wait(&queue->filledSlots) != 0 && errno == EINTR)
+        ;
+
+    /* The acquire load pairs with the release store of queue_push(), the item is there once the tail passed it */
+    while (__atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE) == head)
+        ;
+
+    item = queue->items[head % queue->capacity];
+    __atomic_store_n(&queue->head, head + 1, __ATOMIC_RELEASE);
+
+    sem_post(&queue->freeSlots);
+
+    return item;
+}
+
+void free_queue(BoundedQueue *queue) {
+    sem_destroy(&queue->filledSlots);
+    sem_destroy(&queue->freeSlots);
+    free(queue->items);
+}
@@ -0,0 +1,113 @@
+#ifndef _PARALLEL_H
+#define _PARALLEL_H
+
+#include <semaphore.h>
+
+/* Expects global_definitions.h to be included first */
+
+/* ------------------------------------ Static Definitions ------------------------------------ */
+
+/* Upper bound on the number of threads a single run_chunks() call starts */
+#ifndef MAX_WORKER_THREADS
+#define MAX_WORKER_THREADS 16
+#endif
+
+/* Minimum number of lines handed to a thread, smaller files are processed on the calling thread
+ * because starting a thread costs more than classifying a few thousand lines */
+#ifndef MIN_LINES_PER_THREAD
+#define MIN_LINES_PER_THREAD 4096
+#endif
+
+/* Minimum number of lines encoded by a thread, once the addresses are known */
+#ifndef MIN_ENCODED_LINES_PER_THREAD
+#define MIN_ENCODED_LINES_PER_THREAD 4096
+#endif
+
+
+/* ------------------------------------ Data Types ------------------------------------ */
+
+/* Processes the items [first, last) of the work described by context */
+typedef void (*ChunkWorker)(void *context, int first, int last);
+
+/* Defines where run_chunks() takes a token for every thread it starts besides the calling one, so the threads of a job
+ * stay within a limit shared with other work (the other jobs of make, for one) */
+typedef struct ThreadTokens
+{
+    bool (*acquire)(void *source, char *token);     /* Takes a token without waiting, False when there is none */
+    void (*release)(void *source, char token);      /* Gives a token back */
+    void *source;
+
+} ThreadTokens;
+
+/* Defines a bounded queue between a single producer thread and a single consumer thread.
+ * Each side owns its index, so pushing and popping take no lock; a side only sleeps (on a semaphore)
+ * when the queue is full or empty. */
+typedef struct BoundedQueue
+{
+    void **items;
+    int capacity;
+    unsigned long head;         /* The next item to pop, written by the consumer only */
+    unsigned long tail;         /* The next slot to push to, written by the producer only */
+    sem_t filledSlots;
+    sem_t freeSlots;
+
+} BoundedQueue;
+
+
+/* ------------------------------------ Functions ------------------------------------ */
+
+/** run_chunks
+ *  @brief Splits the items [0, count) into contiguous chunks and processes them on parallel threads.
+ *         The chunks must be independent of each other. Returns once every chunk is done.
+ *         A thread that has tokens (see set_thread_tokens) starts a thread only for each token it takes.
+ *         When the calling thread jumps out on a failed allocation (see DiagnosticSink), a chunk whose memory ran out
+ *         stops, and the caller jumps out once every chunk is done.
+ *  @param count The number of items.
+ *  @param minimumChunk The minimum number of items worth a thread of its own.
+ *  @param worker The function that processes a chunk.
+ *  @param context Passed to the worker as is.
+ */
+void run_chunks(int count, int minimumChunk, ChunkWorker worker, void *context);
+
+/** set_thread_tokens
+ *  @brief Makes the run_chunks() calls of the calling thread start a thread only for a token they take.
+ *  @param tokens The tokens, NULL to start as many threads as there are processors.
+ *  @return The previous tokens of the thread, to be restored when done.
+ */
+ThreadTokens *set_thread_tokens(ThreadTokens *tokens);
+
+/** create_queue
+ *  @brief Prepares an empty queue.
+ *  @param queue The queue.
+ *  @param capacity The most items the queue holds.
+ *  @return True if the queue is ready, False otherwise.
+ */
+bool create_queue(BoundedQueue *queue, int capacity);
+
+/** queue_push
+ *  @brief Adds an item at the end of the queue, waits while the queue is full. Called by the producer only.
+ *  @param queue The queue.
+ *  @param item The item.
+ */
+void queue_push(BoundedQueue *queue, void *item);
+
+/** queue_pop
+ *  @brief Removes the item at the front of the queue, waits while the queue is empty. Called by the consumer only.
+ *  @param queue The queue.
+ *  @return The item.
+ */
+void *queue_pop(BoundedQueue *queue);
+
+/** free_queue
+ *  @brief Frees a queue, the items are left to the caller.
+ *  @param queue The queue.
+ */
+void free_queue(BoundedQueue *queue);
+
+/** online_processors
+ *  @brief Counts the processors available to the process.
+ *  @return The number of processors, at least 1.
+ */
+int online_processors(void);
+
+#endif
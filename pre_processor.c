@@ -1,9 +1,12 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include "pre_processor.h"
 #include "global_definitions.h"
 #include "utility_functions.h"
+#include "pre_processor.h"
+#include "line_scanner.h"
+#include "diagnostics.h"
+#include "file_io.h"
 
 
 int preProcessFile(char * fileName) {
@@ -12,155 +15,296 @@ int preProcessFile(char * fileName) {
 }
 
 /**
- * Process Macros in the Input Assembly File and Write to a New File
+ * View a Line
  *
- * This function reads an assembly file, identifies macro definitions, and replaces
- * macro calls with their content. It writes the processed output to a new file with
- * the same name but a ".am" extension.
+ * Terminates a line of the source buffer in place so it can be used as a string (with its '\n', like fgets).
+ * restoreLine() puts back the character it replaced.
  *
- * @param inputFileName - Name of the input assembly file.
+ * @param source - The source buffer.
+ * @param lineIndex - The index of the line.
+ * @param saved - Receives the replaced character.
+ * @return The line.
  */
+static char *viewLine(SourceBuffer *source, int lineIndex, char *saved) {
+    char *lineEnd = source->data + source->lineStarts[lineIndex + 1];
 
-void processMacros(char *inputFileName) {
+    *saved = *lineEnd;
+    *lineEnd = '\0';
+
+    return source->data + source->lineStarts[lineIndex];
+}
+
+/**
+ * Restore a Line
+ *
+ * @param source - The source buffer.
+ * @param lineIndex - The index of the line passed to viewLine().
+ * @param saved - The character viewLine() replaced.
+ */
+static void restoreLine(SourceBuffer *source, int lineIndex, char saved) {
+    source->data[source->lineStarts[lineIndex + 1]] = saved;
+}
+
+/**
+ * Next Word
+ *
+ * @param text - The text to search.
+ * @param length - Receives the length of the word, 0 if there are no more words.
+ * @return The start of the next whitespace separated word.
+ */
+static const char *nextWord(const char *text, int *length) {
+    const char *word = skipWhiteSpaces(text);
+
+    *length = (int)(skipWord(word) - word);
+    return word;
+}
+
+/**
+ * Is Keyword
+ *
+ * @param word - The start of the word.
+ * @param length - The length of the word.
+ * @param keyword - The keyword to compare against.
+ * @return True if the word is exactly the keyword, False otherwise.
+ */
+static bool isKeyword(const char *word, int length, const char *keyword) {
+    return (int)strlen(keyword) == length && strncmp(word, keyword, length) == 0;
+}
+
+/**
+ * Append Text
+ *
+ * @param text - The text to append to, grows by doubling.
+ * @param length - The length of the text.
+ * @param capacity - The capacity of the text.
+ * @param piece - The null terminated text to append.
+ */
+static void appendText(char **text, int *length, int *capacity, const char *piece) {
+    int pieceLength = (int)strlen(piece);
+
+    /* Keep room for the terminating '\0' */
+    if (*length + pieceLength + 1 > *capacity) {
+        while (*length + pieceLength + 1 > *capacity) {
+            *capacity *= 2;
+        }
+
+        *text = realloc(*text, *capacity);
+        if (*text == NULL) {
+            memory_allocation_failed();
+        }
+    }
+
+    memcpy(*text + *length, piece, pieceLength);
+    *length += pieceLength;
+}
+
+/**
+ * Expand the Macros of a Source
+ *
+ * This function identifies the macro definitions of a source and replaces the macro calls with their content.
+ * The definitions themselves are left out of the expanded source.
+ *
+ * @param source - The source, its lines are terminated in place while they are read and restored afterwards.
+ * @return The expanded source, as it is written to the ".am" file.
+ */
+
+SourceBuffer *expand_macros(SourceBuffer *source) {
 
-    char line[MAX_LINE_LENGTH];             /* Buffer to store each line from the file */
-    char outputFileName[MAX_LINE_LENGTH];   /* Buffer to store the output file name */
     int macroCount = 0;                     /* Count of detected macros */
     int i;                                  /* Loop counter */
-    size_t contentLen;                      /* Length of the macro content */
-    char ** splitedMacro;                   /* Array to store the splited macro */
-    char ** splitedLine;                    /* Array to store the splited line */
-    int numberOfElements = 0;               /* Number of elements in the splited line */
+    int lineIndex;                          /* Index of the current line in the source */
+    char *line;                             /* The current line, terminated in place */
+    char saved;                             /* The character the line terminator replaced */
+    const char *word;                       /* The first word of the line */
+    int wordLength;                         /* Length of the first word */
+    const char *name;                       /* The name of a macro being defined */
+    int nameLength;                         /* Length of the macro name */
+    int contentStart;                       /* Offset of the first line of the macro content */
+    int contentLength;                      /* Length of the macro content */
     bool holdWriting = False;               /* Flag to hold the writing of the line */
     bool isMacroCall = False;               /* Flag to check if the line contains a macro call */
+    bool isMacroLine = False;               /* Flag to check if the line is a macro definition or endmcr */
     Macro *macros = NULL;                   /* Array to store information about macros */
-    FILE *inputFile = NULL;                 /* File pointer for the input file */
-    FILE *outputFile = NULL;                /* File pointer for the output file */
-
+    char *expanded = NULL;                  /* The expanded source */
+    int expandedLength = 0;                 /* Length of the expanded source */
+    int expandedCapacity = source->length + 1;
 
-    /* Open the input file */
-    inputFile = openFile(inputFileName, "r");
 
     /* Allocate memory for the array of macros */
     macros = malloc(MAX_MACROS * sizeof(Macro));
+    expanded = malloc(expandedCapacity);
 
     /* Check for memory allocation errors */
-    if (macros == NULL) {
-        perror(MEMORY_ALLOCATION_ERROR);
-        exit(EXIT_FAILURE);
+    if (macros == NULL || expanded == NULL) {
+        memory_allocation_failed();
     }
 
-    /* Read lines from the input file to detect and store macro definitions */
-    while (fgets(line, sizeof(line), inputFile) != NULL) {
-        /* Check if the line contains a macro definition */
-        if (strstr(line, "mcr") != NULL) {
-            /* Extract the macro name */
-            splitedMacro = splitString(line, " ", &numberOfElements);
+    /* Detect and store macro definitions - a definition is a line whose first word is "mcr" */
+    for (lineIndex = 0; lineIndex < source->lineCount; lineIndex++) {
 
-            /* copy the macro name to the macros structure */
-            strcpy(macros[macroCount].name, splitedMacro[1]);
+        line = viewLine(source, lineIndex, &saved);
+        word = nextWord(line, &wordLength);
 
-            /* Free the memory allocated for the splitedMacro */
-            freeStringArray(splitedMacro, numberOfElements);
+        if (!isKeyword(word, wordLength, "mcr")) {
+            restoreLine(source, lineIndex, saved);
+            continue;
+        }
 
-            /* Initialize content with an empty string */
-            macros[macroCount].content = malloc(1);
+        /* Extract the macro name */
+        name = nextWord(word + wordLength, &nameLength);
 
-            /* Check for memory allocation errors */
-            if (macros[macroCount].content == NULL) {
-                perror(MEMORY_ALLOCATION_ERROR);
-                exit(EXIT_FAILURE);
+        if (nameLength > 0 && macroCount < MAX_MACROS) {
+            if (nameLength > MAX_LINE_LENGTH - 1) {
+                nameLength = MAX_LINE_LENGTH - 1;
             }
+            memcpy(macros[macroCount].name, name, nameLength);
+            macros[macroCount].name[nameLength] = '\0';
+        }
 
-            macros[macroCount].content[0] = '\0';
-
-            /* Read the macro content until "endmcr" is encountered */
-            macroCount++;
-            while (fgets(line, sizeof(line), inputFile) != NULL) {
-                /* Check for the end of the macro */
-                if (strstr(line, "endmcr") != NULL) {
-                    break;
-                }
-
-                /* Dynamically allocate memory and concatenate the macro content */
-                contentLen = strlen(macros[macroCount - 1].content);
-                macros[macroCount - 1].content = realloc(macros[macroCount - 1].content, contentLen + strlen(line) + 1);
+        restoreLine(source, lineIndex, saved);
 
-                /* Check for memory allocation errors */
-                if (macros[macroCount - 1].content == NULL) {
-                    perror(MEMORY_ALLOCATION_ERROR);
-                    exit(EXIT_FAILURE);
-                }
+        /* The content is every line up to "endmcr", it is a single span of the source */
+        contentStart = source->lineStarts[lineIndex + 1];
+        for (lineIndex++; lineIndex < source->lineCount; lineIndex++) {
+            line = viewLine(source, lineIndex, &saved);
+            word = nextWord(line, &wordLength);
+            restoreLine(source, lineIndex, saved);
 
-                strcat(macros[macroCount - 1].content, line);
+            /* Check for the end of the macro */
+            if (isKeyword(word, wordLength, "endmcr")) {
+                break;
             }
         }
-    }
+        contentLength = source->lineStarts[lineIndex] - contentStart;
 
-    /* Close the input file */
-    fclose(inputFile);
-
-    /* Open a new file with the same name but a ".am" extension for writing */
-    sprintf(outputFileName, "%s.am", removeFileExtension(inputFileName));
-    outputFile = openFile(outputFileName, "w");
+        if (nameLength == 0 || macroCount == MAX_MACROS) {
+            continue;
+        }
 
-    /* Open the input file again for processing */
-    inputFile = openFile(inputFileName, "r");
+        macros[macroCount].content = malloc(contentLength + 1);
 
-    /* Process the input file, replacing macro calls with macro content */
-    while (fgets(line, sizeof(line), inputFile) != NULL) {
+        /* Check for memory allocation errors */
+        if (macros[macroCount].content == NULL) {
+            memory_allocation_failed();
+        }
 
-        /* Reset the elemnts number - for the string spliter counter */
-        numberOfElements = 0;
+        memcpy(macros[macroCount].content, source->data + contentStart, contentLength);
+        macros[macroCount].content[contentLength] = '\0';
+        macroCount++;
+    }
 
-        /* Check if the line contains a macro call */
-        splitedLine = splitString(line, " ", &numberOfElements);
+    /* Process the input file, replacing macro calls with macro content */
+    for (lineIndex = 0; lineIndex < source->lineCount; lineIndex++) {
 
-        /* Remove the white spaces from the first element */
-        removeWhiteSpaces(splitedLine[0]);
+        line = viewLine(source, lineIndex, &saved);
+        word = nextWord(line, &wordLength);
 
         /* Check if the line contains a macro definition or endmcr */
-        if (strcmp(splitedLine[0], "mcr") == 0) {
+        if (isKeyword(word, wordLength, "mcr")) {
             holdWriting = True;
+            isMacroLine = True;
         }
 
         /* Check if the line contains a macro ending */
-        else if (strcmp(splitedLine[0], "endmcr") == 0) {
+        else if (isKeyword(word, wordLength, "endmcr")) {
             holdWriting = False;
+            isMacroLine = True;
         }
 
-        for (i = 0; i < macroCount; i++) {
+        for (i = 0; i < macroCount && !isMacroLine; i++) {
             /* Check if the line contains a macro call but is not a macro definition or endmcr */
-            if ((strstr(line, macros[i].name) != NULL) && (strcmp(splitedLine[0], "mcr") != 0) && (strcmp(splitedLine[0], "endmcr") != 0)){
+            if (strstr(line, macros[i].name) != NULL) {
                 /* Replace the macro call with the macro content */
-                fputs(macros[i].content, outputFile);
+                appendText(&expanded, &expandedLength, &expandedCapacity, macros[i].content);
                 isMacroCall = True;
                 break;  /* Skip the original macro call line */
             }
         }
 
         /* Print the line as it is if it doesn't contain a macro call or is within a macro definition or endmcr */
-        if (holdWriting == False && strcmp(splitedLine[0], "endmcr") != 0 && isMacroCall == False) {
-            fputs(line, outputFile);
+        if (holdWriting == False && isMacroLine == False && isMacroCall == False) {
+            appendText(&expanded, &expandedLength, &expandedCapacity, line);
         }
 
-        /* Reset the isMacroCall flag */
+        /* Reset the flags */
         isMacroCall = False;
+        isMacroLine = False;
 
-        /* Free the memory allocated for the splitedLine */
-        freeStringArray(splitedLine, numberOfElements);
+        restoreLine(source, lineIndex, saved);
     }
 
-    /* Close the input and output files */
-    fclose(inputFile);
-    fclose(outputFile);
-
     /* Free dynamically allocated memory for macros */
     for (i = 0; i < macroCount; i++) {
         free(macros[i].content);
     }
 
     free(macros);
+
+    return create_source_buffer(expanded, expandedLength);
+}
+
+/**
+ * Write the Expanded File
+ *
+ * This function reads an assembly file, expands its macros and writes the processed output
+ * to a new file with the same name but a ".am" extension.
+ *
+ * @param inputFileName - Name of the input assembly file.
+ * @return The expanded source, as written to the ".am" file, NULL if the input file cannot be read.
+ */
+
+SourceBuffer *write_expanded_file(char *inputFileName) {
+
+    char outputFileName[MAX_LINE_LENGTH];   /* Buffer to store the output file name */
+    SourceBuffer *source = NULL;            /* The input file and its line index */
+    SourceBuffer *expanded = NULL;          /* The source with its macros expanded */
+    FileBatch outputFile;                   /* The ".am" file */
+    char *outputData = NULL;                /* A copy of the expanded source, owned by the batch */
+    char *baseName = NULL;                  /* The input file name without the extension */
+
+
+    /* Read the input file and index its lines */
+    source = read_source_buffer(inputFileName);
+    if (source == NULL) {
+        return NULL;
+    }
+
+    expanded = expand_macros(source);
+    free_source_buffer(source);
+
+    /* Write a new file with the same name but a ".am" extension, renamed into place once complete */
+    baseName = removeFileExtension(inputFileName);
+    sprintf(outputFileName, "%s.am", baseName);
+    free(baseName);
+
+    outputData = (char *)malloc(expanded->length + 1);
+    if (outputData == NULL) {
+        memory_allocation_failed();
+    }
+    memcpy(outputData, expanded->data, expanded->length);
+
+    init_file_batch(&outputFile);
+    batch_write_file(&outputFile, outputFileName, outputData, expanded->length);
+    submit_file_batch(&outputFile);
+
+    return expanded;
+}
+
+/**
+ * Process Macros in the Input Assembly File and Write to a New File
+ *
+ * This function expands the macros of an assembly file into a ".am" file, see write_expanded_file().
+ *
+ * @param inputFileName - Name of the input assembly file.
+ */
+
+void processMacros(char *inputFileName) {
+
+    SourceBuffer *expanded = write_expanded_file(inputFileName);
+
+    if (expanded != NULL) {
+        free_source_buffer(expanded);
+    }
 }
 
 /**
@@ -1,5 +1,7 @@
 #include "global_definitions.h"
 
+/* Expects utility_functions.h (SourceBuffer) to be included first */
+
 /* ------------------------------------ Static Definitions ------------------------------------ */
 
 #define MAX_MACROS 20
@@ -24,6 +26,22 @@ typedef struct {
  */
 void processMacros(char *inputFileName);
 
+/** write_expanded_file
+ * @brief Expands the macros of the given file into its ".am" file.
+ * 
+ * @param inputFileName The name of the file to process.
+ * @return The expanded source, as written to the ".am" file, NULL if the file cannot be read.
+ */
+SourceBuffer *write_expanded_file(char *inputFileName);
+
+/** expand_macros
+ * @brief Expands the macros of a source in memory.
+ * 
+ * @param source The source, left unchanged.
+ * @return The expanded source, as it is written to the ".am" file.
+ */
+SourceBuffer *expand_macros(SourceBuffer *source);
+
 /** preProcessFile
  * @brief Pre-processes the given file.
  * 
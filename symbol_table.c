@@ -0,0 +1,116 @@
+#include <stdlib.h>
+#include <string.h>
+#include "global_definitions.h"
+#include "symbol_table.h"
+#include "diagnostics.h"
+
+/**
+ * Hash a Name
+ *
+ * FNV-1a, so names that differ in a single character (L1, L2, ...) still spread over the slots.
+ *
+ * @param name - The name.
+ * @param length - The length of the name.
+ * @return The hash.
+ */
+static unsigned long hashName(const char *name, int length) {
+    unsigned long hash = 2166136261UL;
+    int i;
+
+    for (i = 0; i < length; i++) {
+        hash ^= (unsigned char)name[i];
+        hash = (hash * 16777619UL) & 0xFFFFFFFFUL;
+    }
+
+    return hash;
+}
+
+/**
+ * Same Name
+ *
+ * @param table - The table.
+ * @param line - A line that defines a label.
+ * @param name - The name.
+ * @param length - The length of the name.
+ * @return True if the line defines the name.
+ */
+static bool sameName(SymbolTable *table, int line, const char *name, int length) {
+    return (table->nameLengths[line] == length && memcmp(table->names[line], name, length) == 0);
+}
+
+void init_symbol_table(SymbolTable *table, int lineCount) {
+    int slots = 16;
+
+    /* At least twice the labels there may be, so a probe always ends on an empty slot soon */
+    while (slots < 2 * lineCount) {
+        slots *= 2;
+    }
+
+    table->slots = calloc(slots, sizeof(int));
+    table->mask = slots - 1;
+    table->names = malloc((lineCount + 1) * sizeof(const char *));
+    table->nameLengths = malloc((lineCount + 1) * sizeof(int));
+
+    if (table->slots == NULL || table->names == NULL || table->nameLengths == NULL) {
+        memory_allocation_failed();
+    }
+}
+
+bool define_symbol(SymbolTable *table, const char *name, int length, int line) {
+    unsigned long index = hashName(name, length) & (unsigned long)table->mask;
+    int current;
+
+    /* Published by the release of the compare and swap below */
+    table->names[line] = name;
+    table->nameLengths[line] = length;
+
+    for (;;) {
+        current = __atomic_load_n(&table->slots[index], __ATOMIC_ACQUIRE);
+
+        if (current == 0) {
+            if (__atomic_compare_exchange_n(&table->slots[index], &current, line + 1, False, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+                return True;
+            }
+
+            /* Another thread took the slot first, look at what it put there */
+            continue;
+        }
+
+        if (sameName(table, current - 1, name, length)) {
+
+            /* The earliest line wins, so the outcome does not depend on the order of the threads */
+            if (current - 1 < line) {
+                return False;
+            }
+
+            if (__atomic_compare_exchange_n(&table->slots[index], &current, line + 1, False, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+                return True;
+            }
+
+            continue;
+        }
+
+        index = (index + 1) & (unsigned long)table->mask;
+    }
+}
+
+int find_symbol(SymbolTable *table, const char *name, int length) {
+    unsigned long index = hashName(name, length) & (unsigned long)table->mask;
+    int current;
+
+    while ((current = __atomic_load_n(&table->slots[index], __ATOMIC_ACQUIRE)) != 0) {
+        if (sameName(table, current - 1, name, length)) {
+            return current - 1;
+        }
+
+        index = (index + 1) & (unsigned long)table->mask;
+    }
+
+    return -1;
+}
+
+void free_symbol_table(SymbolTable *table) {
+    free(table->slots);
+    free(table->names);
+    free(table->nameLengths);
+}
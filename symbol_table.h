@@ -0,0 +1,59 @@
+#ifndef _SYMBOL_TABLE_H
+#define _SYMBOL_TABLE_H
+
+/* Expects global_definitions.h to be included first */
+
+/* ------------------------------------ Data Types ------------------------------------ */
+
+/* Defines a table of the labels of a file, which several threads may define at the same time.
+ * A label is defined by the line it is on. Defining takes no lock: a slot is claimed with a compare and swap,
+ * and when two lines define the same label the earlier one wins the slot, whatever the order the threads got there in.
+ * Once the labels are defined, looking one up is a plain probe of the slots.
+ * The table reports no duplicates: "Label is already defined" and the like come from the validation (error_handling.c),
+ * which walks the lines in order and tells a label apart from a constant, an entry or an extern. */
+typedef struct SymbolTable
+{
+    int *slots;                 /* 0 for an empty slot, 1 + the line of the definition otherwise */
+    int mask;                   /* The number of slots (a power of 2) - 1 */
+    const char **names;         /* The name each line defines, by line */
+    int *nameLengths;
+
+} SymbolTable;
+
+
+/* ------------------------------------ Functions ------------------------------------ */
+
+/** init_symbol_table
+ *  @brief Prepares an empty table.
+ *  @param table The table.
+ *  @param lineCount The number of lines of the file, each of them defines one label at most.
+ */
+void init_symbol_table(SymbolTable *table, int lineCount);
+
+/** define_symbol
+ *  @brief Defines a label, may be called by several threads at the same time.
+ *  @param table The table.
+ *  @param name The name of the label, it must stay valid as long as the table.
+ *  @param length The length of the name.
+ *  @param line The line that defines the label.
+ *  @return True if the line defines the label (so far), False if an earlier line defines it already.
+ *          A later line that got there first returns True as well, so the result is no duplicate report.
+ */
+bool define_symbol(SymbolTable *table, const char *name, int length, int line);
+
+/** find_symbol
+ *  @brief Looks up a label. Wait-free once no thread is defining labels any more.
+ *  @param table The table.
+ *  @param name The name of the label.
+ *  @param length The length of the name.
+ *  @return The earliest line that defines the label, -1 if no line does.
+ */
+int find_symbol(SymbolTable *table, const char *name, int length);
+
+/** free_symbol_table
+ *  @brief Frees the memory of a table.
+ *  @param table The table.
+ */
+void free_symbol_table(SymbolTable *table);
+
+#endif
@@ -0,0 +1,384 @@
+/* Needed for mmap() and the nanoseconds of the modification times when compiling with -ansi */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "global_definitions.h"
+#include "utility_functions.h"
+#include "identification.h"
+#include "instruction_set.h"
+#include "error_handling.h"
+#include "diagnostics.h"
+#include "file_io.h"
+#include "air.h"
+#include "token_file.h"
+
+/* The most records or operands a valid file has, so the lengths below never overflow */
+#define MAX_TOKEN_COUNT (1 << 28)
+
+/* The first room of the text of the lines, it doubles when it runs out */
+#define INITIAL_TOKEN_TEXT_CAPACITY 4096
+
+/* Defines the text of the lines being rendered, at the end of the text of a LineTable */
+typedef struct RenderedText
+{
+    LineTable *lines;
+    int length;
+    int capacity;
+
+} RenderedText;
+
+
+/**
+ * Append Text
+ *
+ * @param rendered - The text.
+ * @param text - The text appended, it does not need to be null terminated.
+ * @param length - The length of the text appended.
+ */
+static void appendText(RenderedText *rendered, const char *text, int length) {
+
+    /* The lines are found by their offsets, so the text can move as it grows */
+    while (rendered->length + length + 1 > rendered->capacity) {
+        rendered->capacity *= 2;
+        rendered->lines->text = realloc(rendered->lines->text, rendered->capacity);
+
+        if (rendered->lines->text == NULL) {
+            memory_allocation_failed();
+        }
+    }
+
+    memcpy(rendered->lines->text + rendered->length, text, length);
+    rendered->length += length;
+    rendered->lines->text[rendered->length] = '\0';
+}
+
+/**
+ * Append a String
+ *
+ * @param rendered - The text.
+ * @param text - The string appended.
+ */
+static void appendString(RenderedText *rendered, const char *text) {
+    appendText(rendered, text, (int)strlen(text));
+}
+
+/**
+ * Append a Value
+ *
+ * @param rendered - The text.
+ * @param names - The names of the program.
+ * @param isName - True if the value is the offset of a name.
+ * @param value - The value.
+ */
+static void appendValue(RenderedText *rendered, const char *names, bool isName, int value) {
+    char number[3 * sizeof(int) + 2];
+
+    if (isName) {
+        appendString(rendered, names + value);
+        return;
+    }
+
+    sprintf(number, "%d", value);
+    appendString(rendered, number);
+}
+
+/**
+ * Append an Operand
+ *
+ * @param rendered - The text.
+ * @param names - The names of the program.
+ * @param operand - The operand.
+ * @param isInstruction - True for an operand of an instruction, False for a value of a directive.
+ */
+static void appendOperand(RenderedText *rendered, const char *names, const TokenOperand *operand, bool isInstruction) {
+
+    switch (operand->mode) {
+        case TOKEN_IMMEDIATE:
+            if (isInstruction) {
+                appendString(rendered, "#");
+            }
+            appendValue(rendered, names, (operand->flags & TOKEN_VALUE_NAME) != 0, operand->value);
+            break;
+        case TOKEN_DIRECT:
+            appendString(rendered, names + operand->value);
+            break;
+        case TOKEN_INDEX:
+            appendString(rendered, names + operand->value);
+            appendString(rendered, "[");
+            appendValue(rendered, names, (operand->flags & TOKEN_INDEX_NAME) != 0, operand->index);
+            appendString(rendered, "]");
+            break;
+        default:
+            appendString(rendered, "r");
+            appendValue(rendered, names, False, operand->value);
+            break;
+    }
+}
+
+/**
+ * Render a Record
+ *
+ * Writes the line of text a record stands for, as cleanCommand() would leave it, for the error messages.
+ *
+ * @param rendered - Receives the line, with its terminator.
+ * @param record - The record.
+ * @param program - The program.
+ */
+static void renderRecord(RenderedText *rendered, const TokenRecord *record, const TokenProgram *program) {
+    const char *names = program->names;
+    int i;
+
+    if (record->label != TOKEN_NO_NAME) {
+        appendString(rendered, names + record->label);
+        appendString(rendered, ": ");
+    }
+
+    switch (record->kind) {
+        case TOKEN_INSTRUCTION:
+            appendString(rendered, instruction_definition((InstructionType)record->opcode)->name);
+            break;
+        case TOKEN_DATA:
+            appendString(rendered, ".data");
+            break;
+        case TOKEN_STRING:
+            appendString(rendered, ".string \"");
+            appendString(rendered, names + record->name);
+            appendString(rendered, "\"");
+            break;
+        case TOKEN_ENTRY:
+            appendString(rendered, ".entry ");
+            appendString(rendered, names + record->name);
+            break;
+        case TOKEN_EXTERN:
+            appendString(rendered, ".extern ");
+            appendString(rendered, names + record->name);
+            break;
+        case TOKEN_INCLUDE:
+            appendString(rendered, ".include \"");
+            appendString(rendered, names + record->name);
+            appendString(rendered, "\"");
+            break;
+        default:
+            appendString(rendered, ".define ");
+            appendString(rendered, names + record->name);
+            appendString(rendered, " =");
+            break;
+    }
+
+    for (i = 0; i < record->count; i++) {
+        appendString(rendered, (i == 0 ? " " : ", "));
+        appendOperand(rendered, names, &program->operands[record->first + i], record->kind == TOKEN_INSTRUCTION);
+    }
+
+    /* The terminator of the line */
+    rendered->length++;
+}
+
+/**
+ * Valid Name
+ *
+ * @param name - The offset of a name.
+ * @param namesLength - The length of the names.
+ * @return True if the offset is in the names.
+ */
+static bool validName(int name, int namesLength) {
+    return (name >= 0 && name < namesLength);
+}
+
+/**
+ * Valid Operand
+ *
+ * @param operand - An operand.
+ * @param namesLength - The length of the names.
+ * @return True if the operand only refers to names in the file.
+ */
+static bool validOperand(const TokenOperand *operand, int namesLength) {
+
+    switch (operand->mode) {
+        case TOKEN_IMMEDIATE:
+            return ((operand->flags & TOKEN_VALUE_NAME) == 0 || validName(operand->value, namesLength));
+        case TOKEN_DIRECT:
+            return validName(operand->value, namesLength);
+        case TOKEN_INDEX:
+            return (validName(operand->value, namesLength) && ((operand->flags & TOKEN_INDEX_NAME) == 0 || validName(operand->index, namesLength)));
+        case TOKEN_REGISTER:
+            return True;
+        default:
+            return False;
+    }
+}
+
+/**
+ * Valid Record
+ *
+ * @param record - A record.
+ * @param program - The program.
+ * @return True if the record only refers to operands and names in the program.
+ */
+static bool validRecord(const TokenRecord *record, const TokenProgram *program) {
+    int i;
+
+    if (record->kind < TOKEN_INSTRUCTION || record->kind > TOKEN_INCLUDE) {
+        return False;
+    }
+
+    if (record->label != TOKEN_NO_NAME && !validName(record->label, program->namesLength)) {
+        return False;
+    }
+
+    if (record->kind == TOKEN_INSTRUCTION ? (record->opcode < MOV || record->opcode > HLT) : (record->kind != TOKEN_DATA && !validName(record->name, program->namesLength))) {
+        return False;
+    }
+
+    /* Every line of the text path has at most one ".define" value and two operands */
+    if (record->first < 0 || record->count < 0 || record->count > program->operandCount - record->first ||
+        (record->kind == TOKEN_INSTRUCTION && record->count > 2) || (record->kind == TOKEN_CONSTANT && record->count != 1) ||
+        ((record->kind == TOKEN_STRING || record->kind == TOKEN_ENTRY || record->kind == TOKEN_EXTERN || record->kind == TOKEN_INCLUDE) && record->count != 0)) {
+        return False;
+    }
+
+    for (i = 0; i < record->count; i++) {
+        if (!validOperand(&program->operands[record->first + i], program->namesLength) ||
+            (record->kind != TOKEN_INSTRUCTION && program->operands[record->first + i].mode != TOKEN_IMMEDIATE)) {
+            return False;
+        }
+    }
+
+    return True;
+}
+
+/**
+ * Command Type of a Kind
+ *
+ * @param kind - The kind of a record.
+ * @return The type of the line the record stands for.
+ */
+static CommandType kindCommandType(int kind) {
+
+    switch (kind) {
+        case TOKEN_INSTRUCTION:
+            return INSTRUCTION;
+        case TOKEN_DATA:
+            return DATA_DIRECTIVE;
+        case TOKEN_STRING:
+            return STRING_DIRECTIVE;
+        case TOKEN_ENTRY:
+            return ENTRY_DIRECTIVE;
+        case TOKEN_EXTERN:
+            return EXTERN_DIRECTIVE;
+        case TOKEN_INCLUDE:
+            return INCLUDE_DIRECTIVE;
+        default:
+            return CONSTANT;
+    }
+}
+
+char *map_token_file(const char *fileName, const char *sourceFileName, size_t *length) {
+    struct stat status;
+    struct stat sourceStatus;
+    char *tokens;
+    int fd;
+
+    fd = open_file(fileName, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    /* A ".as" file edited after the ".asb" file was written is the program now */
+    if (fstat(fd, &status) != 0 || status.st_size == 0 || (stat_file(sourceFileName, &sourceStatus) == 0 && !not_older(&status, &sourceStatus))) {
+        close(fd);
+        return NULL;
+    }
+
+    *length = (size_t)status.st_size;
+    tokens = mmap(NULL, *length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    return (tokens == MAP_FAILED ? NULL : tokens);
+}
+
+void unmap_token_file(char *tokens, size_t length) {
+    munmap(tokens, length);
+}
+
+bool read_token_program(const char *tokens, size_t length, char *fileName, TokenProgram *program) {
+    const TokenHeader *header = (const TokenHeader *)tokens;
+
+    if (length < sizeof(TokenHeader) || header->magic != TOKEN_MAGIC ||
+        header->recordCount < 0 || header->recordCount > MAX_TOKEN_COUNT || header->operandCount < 0 || header->operandCount > MAX_TOKEN_COUNT ||
+        header->namesLength < 0 ||
+        sizeof(TokenHeader) + (size_t)header->recordCount * sizeof(TokenRecord) + (size_t)header->operandCount * sizeof(TokenOperand) + (size_t)header->namesLength != length ||
+        (header->namesLength > 0 && tokens[length - 1] != '\0')) {
+        print_error(TOKEN_FILE_ERROR, "", 0, fileName);
+        return False;
+    }
+
+    program->records = (const TokenRecord *)(header + 1);
+    program->recordCount = header->recordCount;
+    program->operands = (const TokenOperand *)(program->records + header->recordCount);
+    program->operandCount = header->operandCount;
+    program->names = (const char *)(program->operands + header->operandCount);
+    program->namesLength = header->namesLength;
+
+    return True;
+}
+
+LineTable *classify_token_lines(const TokenProgram *program, char *fileName) {
+    const TokenRecord *records = program->records;
+    LineTable *lines;
+    LineRecord *record;
+    RenderedText rendered;
+    int labelLength;
+    int i;
+
+    lines = create_line_table(program->recordCount, INITIAL_TOKEN_TEXT_CAPACITY);
+    rendered.lines = lines;
+    rendered.length = 0;
+    rendered.capacity = INITIAL_TOKEN_TEXT_CAPACITY;
+
+    for (i = 0; i < program->recordCount; i++) {
+        if (!validRecord(&records[i], program)) {
+            print_error(TOKEN_FILE_ERROR, "", i + 1, fileName);
+            free_line_table(lines);
+            return NULL;
+        }
+
+        lines->textOffsets[i] = rendered.length;
+        renderRecord(&rendered, &records[i], program);
+
+        lines->kinds[i] = (unsigned char)kindCommandType(records[i].kind);
+        lines->labelLengths[i] = 0;
+        lines->wordCounts[i] = 0;
+        lines->addresses[i] = 0;
+        lines->firstWords[i] = 0;
+
+        record = &lines->records[i];
+        record->dataOffset = 0;
+        record->instruction = UNDEFINED_INSTRUCTION;
+        record->operandCount = 0;
+        record->include = 0;
+    }
+
+    /* The labels point into the text, which no longer moves. A label too long for the table is an error of the validation anyway */
+    for (i = 0; i < program->recordCount; i++) {
+        if (records[i].label != TOKEN_NO_NAME &&
+            (records[i].kind == TOKEN_INSTRUCTION || records[i].kind == TOKEN_DATA || records[i].kind == TOKEN_STRING || records[i].kind == TOKEN_INCLUDE)) {
+            labelLength = (int)strlen(program->names + records[i].label);
+            lines->labelLengths[i] = (unsigned short)(labelLength > MAX_LINE_LENGTH ? MAX_LINE_LENGTH : labelLength);
+
+            /* An empty label is no label, as for the validation */
+            if (labelLength > 0) {
+                define_symbol(&lines->labels, LINE_TEXT(lines, i), lines->labelLengths[i], i);
+            }
+        }
+    }
+
+    return lines;
+}
@@ -0,0 +1,133 @@
+#ifndef _TOKEN_FILE_H
+#define _TOKEN_FILE_H
+
+#include <stddef.h>
+
+/* Expects global_definitions.h and identification.h to be included first */
+
+/* ------------------------------------ Static Definitions ------------------------------------ */
+
+/* A ".asb" file holds a program as tokens rather than text, for the programs that other programs write.
+ * A program with a ".asb" file is read from it instead of its ".as" file, unless the ".as" file is newer. Every record stands for
+ * a line of text, and is validated and assembled from its fields as that line would be, without any text being scanned. */
+#define TOKEN_EXTENSION ".asb"
+
+/* "ASB1", the layout below changes with the number */
+#define TOKEN_MAGIC 0x31425341
+
+/* The kinds of the records */
+#define TOKEN_INSTRUCTION 1         /* <label>: <opcode> <operands> */
+#define TOKEN_DATA 2                /* <label>: .data <operands> */
+#define TOKEN_STRING 3              /* <label>: .string "<name>" */
+#define TOKEN_ENTRY 4               /* .entry <name> */
+#define TOKEN_EXTERN 5              /* .extern <name> */
+#define TOKEN_CONSTANT 6            /* .define <name> = <operand> */
+#define TOKEN_INCLUDE 7             /* <label>: .include "<name>" */
+
+/* The addressing modes of the operands, the values of a .data or a .define are TOKEN_IMMEDIATE */
+#define TOKEN_IMMEDIATE 0
+#define TOKEN_DIRECT 1
+#define TOKEN_INDEX 2
+#define TOKEN_REGISTER 3
+
+/* The flags of an operand */
+#define TOKEN_VALUE_NAME 1          /* The value is the offset of a name (a constant or a label) instead of a number */
+#define TOKEN_INDEX_NAME 2          /* The index is the offset of a name (a constant) instead of a number */
+
+/* The label of a line without one */
+#define TOKEN_NO_NAME (-1)
+
+#define TOKEN_FILE_ERROR "Invalid tokenized record\n"
+
+
+/* ------------------------------------ Data Types ------------------------------------ */
+
+/* Defines the start of a ".asb" file, in the byte order of the machine that wrote it. It is followed by:
+ *   the records (TokenRecord)
+ *   the operands of the records, one record after the other (TokenOperand)
+ *   the names and the strings the records and the operands refer to (null terminated) */
+typedef struct TokenHeader
+{
+    int magic;
+    int recordCount;
+    int operandCount;
+    int namesLength;
+
+} TokenHeader;
+
+/* Defines a line of the program */
+typedef struct TokenRecord
+{
+    int kind;               /* TOKEN_INSTRUCTION, ... */
+    int label;              /* Offset of the label of the line in the names, TOKEN_NO_NAME when there is none */
+    int name;               /* TOKEN_STRING, TOKEN_ENTRY, TOKEN_EXTERN, TOKEN_CONSTANT, TOKEN_INCLUDE - offset of the string or the name in the names */
+    int opcode;             /* TOKEN_INSTRUCTION - the opcode of the instruction (0 for mov ... 15 for hlt) */
+    int first;              /* The first operand of the line in the operands */
+    int count;              /* The number of operands of the line (at most 2 for an instruction, 1 for a constant) */
+
+} TokenRecord;
+
+/* Defines an operand of an instruction or a value of a directive */
+typedef struct TokenOperand
+{
+    int mode;               /* TOKEN_IMMEDIATE, ... */
+    int flags;              /* TOKEN_VALUE_NAME, TOKEN_INDEX_NAME */
+    int value;              /* IMMEDIATE - a number or a name, DIRECT and INDEX - a name, REGISTER - the number of the register */
+    int index;              /* INDEX - a number or a name */
+
+} TokenOperand;
+
+
+/* Defines the parts of a tokenized program, laid out by a ".asb" file or kept apart by a builder (see assembler_api.h) */
+typedef struct TokenProgram
+{
+    const TokenRecord *records;
+    int recordCount;
+    const TokenOperand *operands;
+    int operandCount;
+    const char *names;
+    int namesLength;
+
+} TokenProgram;
+
+
+/* ------------------------------------ Functions ------------------------------------ */
+
+/** map_token_file
+ *  @brief Maps a ".asb" file into memory, if it is not older than the ".as" file of the program.
+ *  @param fileName The name of the file.
+ *  @param sourceFileName The ".as" file of the program, a ".asb" file without one is taken as is.
+ *  @param length Receives the length of the mapping.
+ *  @return The mapping, NULL if the file does not exist, cannot be read or is older than the ".as" file.
+ */
+char *map_token_file(const char *fileName, const char *sourceFileName, size_t *length);
+
+/** unmap_token_file
+ *  @brief Unmaps a file mapped by map_token_file.
+ *  @param tokens The mapping.
+ *  @param length The length of the mapping.
+ */
+void unmap_token_file(char *tokens, size_t length);
+
+/** read_token_program
+ *  @brief Finds the parts of the program in the contents of a ".asb" file.
+ *         A malformed header is reported with print_error().
+ *  @param tokens The contents of the file.
+ *  @param length The length of the file.
+ *  @param fileName The name of the file, for the error messages.
+ *  @param program Receives the parts, pointing into the contents.
+ *  @return True if the header is valid, False otherwise.
+ */
+bool read_token_program(const char *tokens, size_t length, char *fileName, TokenProgram *program);
+
+/** classify_token_lines
+ *  @brief Classifies the records of a tokenized program as classify_source_lines classifies the lines of a source.
+ *         Every record gets the line it stands for as its text, for the error messages only.
+ *         A malformed record is reported with print_error(), with the number of the record at fault.
+ *  @param program The program.
+ *  @param fileName The name of the program, for the error messages.
+ *  @return The table of the lines, NULL if a record is malformed.
+ */
+LineTable *classify_token_lines(const TokenProgram *program, char *fileName);
+
+#endif
@@ -1,15 +1,26 @@
+/* Needed for getpid() and the mutexes when compiling with -ansi */
+#define _POSIX_C_SOURCE 200112L
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <sys/types.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
 #include "global_definitions.h"
 #include "utility_functions.h"
+#include "line_scanner.h"
+#include "diagnostics.h"
+#include "file_io.h"
 
 
 /**
  * Open a File
  *
- * This function opens a file with the specified name and access mode.
+ * This function opens a file with the specified name and access mode ("r", "w" or "a"),
+ * relative to the directory of the calling thread (see set_file_directory()).
  *
  * @param fileName - The name of the file to open.
  * @param accessMode - The access mode for opening the file.
@@ -19,18 +30,107 @@
 FILE* openFile(const char * fileName, const char * accessMode) {
     
     FILE *file = NULL;
+    int flags = (accessMode[0] == 'r' ? O_RDONLY : O_WRONLY | O_CREAT | (accessMode[0] == 'a' ? O_APPEND : O_TRUNC));
+    int fd;
 
     /* Open the file for reading and check for errors */
 
-    file = fopen(fileName, accessMode);
+    fd = open_file(fileName, flags);
+    file = (fd < 0 ? NULL : fdopen(fd, accessMode));
     if (file == NULL) {
-        perror(FILE_OPEN_ERROR);
+        console_perror(FILE_OPEN_ERROR);
+        if (fd >= 0) {
+            close(fd);
+        }
         return NULL;
     }
 
     return file;
 }
 
+/**
+ * Name a Temporary File for an Output File
+ *
+ * This function names a temporary file in the same directory as the output file.
+ * The output is written there and renamed into place, so readers never observe a partially
+ * written file and parallel builds (or threads) never write to the same file.
+ *
+ * @param fileName - The name of the output file.
+ * @param temporaryFileName - Buffer of MAX_TEMP_FILE_NAME_LENGTH characters that receives the temporary file name.
+ */
+
+void temporaryFileNameFor(const char * fileName, char * temporaryFileName) {
+
+    static pthread_mutex_t counterLock = PTHREAD_MUTEX_INITIALIZER;
+    static unsigned long counter = 0;
+    unsigned long sequence;
+
+    /* The sequence tells apart the threads of this process that write the same output file */
+    pthread_mutex_lock(&counterLock);
+    sequence = counter++;
+    pthread_mutex_unlock(&counterLock);
+
+    sprintf(temporaryFileName, "%.*s.%ld.%lu.tmp", MAX_LINE_LENGTH - 1, fileName, (long)getpid(), sequence % 100000000UL);
+}
+
+/**
+ * Open a Temporary File for an Output File
+ *
+ * This function opens a temporary file for an output file, see temporaryFileNameFor().
+ * The output is renamed into place by commitTemporaryFile() once it was written.
+ *
+ * @param fileName - The name of the output file.
+ * @param temporaryFileName - Buffer of MAX_TEMP_FILE_NAME_LENGTH characters that receives the temporary file name.
+ * @return A file pointer or NULL if the file cannot be opened.
+ */
+
+FILE* openTemporaryFile(const char * fileName, char * temporaryFileName) {
+
+    temporaryFileNameFor(fileName, temporaryFileName);
+
+    return openFile(temporaryFileName, "w");
+}
+
+/**
+ * Commit a Temporary File
+ *
+ * This function renames a fully written temporary file over the output file.
+ * The rename replaces the output file atomically.
+ *
+ * @param temporaryFileName - The name of the temporary file.
+ * @param fileName - The name of the output file.
+ * @return True if the output file was replaced, False otherwise.
+ */
+
+bool commitTemporaryFile(const char * temporaryFileName, const char * fileName) {
+
+    if (rename_file(temporaryFileName, fileName) != 0) {
+        console_perror("Error renaming file");
+        remove_file(temporaryFileName);
+        return False;
+    }
+
+    return True;
+}
+
+/**
+ * Remove an Output File
+ *
+ * This function removes an output file left over from a previous run (if exists).
+ *
+ * @param fileName - The name of the output file.
+ */
+
+void removeOutputFile(const char * fileName) {
+
+    int fd = open_file(fileName, O_RDONLY);
+
+    if (fd >= 0) {
+        close(fd);
+        remove_file(fileName);
+    }
+}
+
 /**
  * Remove File Extension from the Input File Name
  *
@@ -58,8 +158,7 @@ char *removeFileExtension(const char *inputFileName) {
 
         /* Check for memory allocation errors */
         if (outputFileName == NULL) {
-            perror(MEMORY_ALLOCATION_ERROR);
-            exit(EXIT_FAILURE);
+            memory_allocation_failed();
         }
 
         /* Copy the file name without the extension */
@@ -78,8 +177,7 @@ char *removeFileExtension(const char *inputFileName) {
 
         /* Check for memory allocation errors */
         if (outputFileName == NULL) {
-            perror(MEMORY_ALLOCATION_ERROR);
-            exit(EXIT_FAILURE);
+            memory_allocation_failed();
         }
 
         /* Copy the entire input file name */
@@ -120,8 +218,7 @@ void removeWhiteSpaces(char *inputString) {
  */
 void removeLeadingSpaces(char *str) {
 
-    int i = 0;
-    int j = 0;
+    const char *start;
 
     if (str == NULL || str[0] == '\0') {
         /* Handle invalid or empty string */
@@ -129,17 +226,10 @@ void removeLeadingSpaces(char *str) {
     }
 
     /* Skip leading spaces or tabs */
-    while (isspace(str[i])) {
-        i++;
-    }
-
-    /* Move non-space characters to the beginning of the string */
-    while (str[i] != '\0') {
-        str[j++] = str[i++];
-    }
+    start = skipWhiteSpaces(str);
 
-    /* Null-terminate the modified string */
-    str[j] = '\0';
+    /* Move the rest of the string (with its '\0') to the beginning */
+    memmove(str, start, strlen(start) + 1);
 }
 
 
@@ -154,13 +244,11 @@ void removeLeadingSpaces(char *str) {
 char **splitString(const char *inputString, const char *separators, int *count) {
     
     int length = strlen(inputString);
-    char buffer[MAX_LINE_LENGTH + 2];
-    int i = 0, j, k;
+    int i = 0;
 
     /* Marks the starting index of a word */
     int startIndex; 
     int stringIndex = 0;
-    int toAllocate; 
 
     char *stringCopy;
     char **resultStrings;
@@ -170,8 +258,7 @@ char **splitString(const char *inputString, const char *separators, int *count)
     stringCopy = (char *)malloc((length + 1) * sizeof(char));
     if (stringCopy == NULL) {
         /* Failed to allocate memory for the copy */
-        perror(MEMORY_ALLOCATION_ERROR);
-        exit(EXIT_FAILURE);
+        memory_allocation_failed();
     }
 
     strncpy(stringCopy, inputString, length + 1);
@@ -201,11 +288,10 @@ char **splitString(const char *inputString, const char *separators, int *count)
     }
 
     /* Allocate memory for the array of strings */
-    resultStrings = (char **)malloc((*count) * sizeof(char *));
+    resultStrings = (char **)malloc((*count + 1) * sizeof(char *));
     if (resultStrings == NULL) {
         /* Failed to allocate memory for the array */
-        free(stringCopy);
-        return NULL;
+        memory_allocation_failed();
     }
 
     /* Split the input string into strings */
@@ -216,35 +302,23 @@ char **splitString(const char *inputString, const char *separators, int *count)
             i++;
         }
         /* Mark the starting index of a word */
-        j = 0;
+        startIndex = i;
         while (i < length && strchr(separators, stringCopy[i]) == NULL) {
-
-            /* Copy the word into the buffer */
-            buffer[j] = stringCopy[i];
             i++;
-            j++;
-
         }
-        /* If a word was found, copy it into the result array */
-        if (j > 0) {
-
-            buffer[j] = '\0';
+        /* If a word was found, copy it into the result array - the words are as long as the input allows */
+        if (i > startIndex) {
 
             /* Allocate memory for the string */
-            toAllocate = (strlen(buffer) + 1) * sizeof(char);
-            resultStrings[stringIndex] = (char *)malloc(toAllocate);
+            resultStrings[stringIndex] = (char *)malloc((i - startIndex + 1) * sizeof(char));
 
             if (resultStrings[stringIndex] == NULL) {
                 /* Failed to allocate memory for a string */
-                free(stringCopy);
-                for (k = 0; k < stringIndex; k++) {
-                    free(resultStrings[k]);
-                }
-                free(resultStrings);
-                return NULL;
+                memory_allocation_failed();
             }
             /* Copy the string into the result array */
-            strcpy(resultStrings[stringIndex], buffer);
+            memcpy(resultStrings[stringIndex], stringCopy + startIndex, i - startIndex);
+            resultStrings[stringIndex][i - startIndex] = '\0';
             
             stringIndex++;
         }
@@ -294,24 +368,31 @@ void printStringArray(char **strings, int count) {
 
 /**
  * removeSubstring - Remove a specified substring from a given string
+ * The string is copied over itself once, an occurrence is dropped as soon as its last character is copied,
+ * so an occurrence formed by a removal is removed as well.
  * @param str - The input string
  * @param subStr - The substring to be removed
  */
 void removeSubstring(char *str, const char *subStr) {
-    /* Find the first occurrence of the substring in the string */
-    char *found = strstr(str, subStr);
+    size_t subStrLen = strlen(subStr);
+    char *read;
+    char *write = str;
 
-    /* If the substring is found */
-    while (found != NULL) {
-        /* Calculate the length of the substring */
-        size_t subStrLen = strlen(subStr);
+    if (subStrLen == 0) {
+        return;
+    }
 
-        /* Move characters following the substring to overwrite it */
-        memmove(found, found + subStrLen, strlen(found + subStrLen) + 1);
+    for (read = str; *read != '\0'; read++) {
+        *write++ = *read;
 
-        /* Search for the next occurrence of the substring */
-        found = strstr(str, subStr);
+        /* Only compare when the last character matches */
+        if (*read == subStr[subStrLen - 1] && (size_t)(write - str) >= subStrLen &&
+            strncmp(write - subStrLen, subStr, subStrLen) == 0) {
+            write -= subStrLen;
+        }
     }
+
+    *write = '\0';
 }
 /**
  * removeLastCharacter - Remove the last character from a given string
@@ -374,8 +455,7 @@ char* intToString(int num) {
 
     if (str == NULL) {
         /* Handle memory allocation failure */
-        perror(MEMORY_ALLOCATION_ERROR);
-        exit(EXIT_FAILURE);
+        memory_allocation_failed();
     }
 
     /* Use sprintf to convert int to string */
@@ -410,8 +490,7 @@ void joinStrings(char** str1, const char* str2) {
     *str1 = realloc(*str1, new_size);
     if (*str1 == NULL) {
         /* Handle memory allocation failure */
-        perror("Memory reallocation failed");
-        exit(EXIT_FAILURE);
+        memory_allocation_failed();
     }
 
     /* Concatenate str2 to the end of str1 */
@@ -421,11 +500,12 @@ void joinStrings(char** str1, const char* str2) {
 
 unsigned long hash_function(char *str)
 {
-    unsigned long i = 0;
+    /* djb2, a plain sum of the characters sends names like L1, L2 and 1L to neighbouring or equal slots */
+    unsigned long i = 5381;
     int j;
 
     for (j = 0; str[j]; j++)
-        i += str[j];
+        i = i * 33 + (unsigned char)str[j];
 
     return i % HT_CAPACITY;
 }
@@ -435,6 +515,11 @@ LinkedList *allocate_list()
 {
     /* Allocates memory for a LinkedList pointer. */
     LinkedList *list = (LinkedList *)malloc(sizeof(LinkedList));
+
+    if (list == NULL) {
+        memory_allocation_failed();
+    }
+
     return list;
 }
 
@@ -464,7 +549,7 @@ LinkedList *linkedlist_insert(LinkedList *list, Ht_item *item)
 
     temp = list;
 
-    while (temp->next->next)
+    while (temp->next)
     {
         temp = temp->next;
     }
@@ -532,6 +617,10 @@ LinkedList **create_overflow_buckets(HashTable *table)
     LinkedList **buckets = (LinkedList **)calloc(table->size, sizeof(LinkedList *));
     int i;
 
+    if (buckets == NULL) {
+        memory_allocation_failed();
+    }
+
     for (i = 0; i < table->size; i++)
         buckets[i] = NULL;
 
@@ -554,12 +643,22 @@ Ht_item *create_item(char *key, char *value, char *type, char *address, char *me
 {
     /* Creates a pointer to a new HashTable item. */
     Ht_item *item = (Ht_item *)malloc(sizeof(Ht_item));
+
+    if (item == NULL) {
+        memory_allocation_failed();
+    }
+
     item->key = (char *)malloc(strlen(key) + 1);
     item->value = (char *)malloc(strlen(value) + 1);
     item->type = (char *)malloc(strlen(type) + 1);
     item->address = (char *)malloc(strlen(address) + 1);
     item->memorySize = (char *)malloc(strlen(memorySize) + 1);
     item->order = (char *)malloc(strlen(order) + 1);
+
+    if (item->key == NULL || item->value == NULL || item->type == NULL || item->address == NULL || item->memorySize == NULL || item->order == NULL) {
+        memory_allocation_failed();
+    }
+
     strcpy(item->key, key);
     strcpy(item->value, value);
     strcpy(item->type, type);
@@ -575,10 +674,19 @@ HashTable *create_table(int size)
 
     /* Creates a new HashTable. */
     HashTable *table = (HashTable *)malloc(sizeof(HashTable));
+
+    if (table == NULL) {
+        memory_allocation_failed();
+    }
+
     table->size = size;
     table->count = 0;
     table->items = (Ht_item **)calloc(table->size, sizeof(Ht_item *));
 
+    if (table->items == NULL) {
+        memory_allocation_failed();
+    }
+
     for (i = 0; i < table->size; i++)
         table->items[i] = NULL;
 
@@ -599,6 +707,28 @@ void free_item(Ht_item *item)
     free(item);
 }
 
+void clear_table(HashTable *table)
+{
+    int i;
+    /* Frees the items but keeps the slots, so the table can be filled again without allocating them. */
+    for (i = 0; i < table->size; i++)
+    {
+        if (table->items[i] != NULL)
+        {
+            free_item(table->items[i]);
+            table->items[i] = NULL;
+        }
+
+        if (table->overflow_buckets[i] != NULL)
+        {
+            free_linkedlist(table->overflow_buckets[i]);
+            table->overflow_buckets[i] = NULL;
+        }
+    }
+
+    table->count = 0;
+}
+
 void free_table(HashTable *table)
 {
     int i;
@@ -626,6 +756,7 @@ void handle_collision(HashTable *table, unsigned long index, Ht_item *item)
         /* Creates the list. */
         head = allocate_list();
         head->item = item;
+        head->next = NULL;
         table->overflow_buckets[index] = head;
         return;
     }
@@ -637,6 +768,28 @@ void handle_collision(HashTable *table, unsigned long index, Ht_item *item)
     }
 }
 
+/* Finds the item of a key, in its slot or in the collision chain of the slot. Returns NULL if it doesn't exist. */
+static Ht_item *find_item(HashTable *table, char *key)
+{
+    int index = hash_function(key);
+    Ht_item *item = table->items[index];
+    LinkedList *head = table->overflow_buckets[index];
+
+    if (item == NULL)
+        return NULL;
+
+    if (strcmp(item->key, key) == 0)
+        return item;
+
+    for (; head != NULL; head = head->next)
+    {
+        if (strcmp(head->item->key, key) == 0)
+            return head->item;
+    }
+
+    return NULL;
+}
+
 void ht_insert(HashTable *table, char *key, char *value, char *type, char *address, char *memorySize, char *order)
 {
     /* Creates the item. */
@@ -653,7 +806,7 @@ void ht_insert(HashTable *table, char *key, char *value, char *type, char *addre
         if (table->count == table->size)
         {
             /* HashTable is full. */
-            printf("Insert Error: Hash Table is full\n");
+            console_printf(CONSOLE_OUTPUT, "Insert Error: Hash Table is full\n");
             free_item(item);
             return;
         }
@@ -667,16 +820,27 @@ void ht_insert(HashTable *table, char *key, char *value, char *type, char *addre
         /* Scenario 1: Update the value. */
         if (strcmp(current_item->key, key) == 0)
         {
-            strcpy(table->items[index]->value, value);
-            strcpy(table->items[index]->type, type);
-            strcpy(table->items[index]->address, address);
-            strcpy(table->items[index]->memorySize, memorySize);
-            strcpy(table->items[index]->order, order);
+            /* The new item replaces the old one, its fields may be longer than the old ones */
+            table->items[index] = item;
+            free_item(current_item);
             return;
         }
         else
         {
-            /* Scenario 2: Handle the collision. */
+            /* Scenario 2: The key may be in the collision chain already. */
+            LinkedList *node;
+
+            for (node = table->overflow_buckets[index]; node != NULL; node = node->next)
+            {
+                if (strcmp(node->item->key, key) == 0)
+                {
+                    free_item(node->item);
+                    node->item = item;
+                    return;
+                }
+            }
+
+            /* Scenario 3: Handle the collision. */
             handle_collision(table, index, item);
             return;
         }
@@ -687,96 +851,36 @@ char *ht_search(HashTable *table, char *key)
 {
     /* Searches for the key in the HashTable.
        Returns NULL if it doesn't exist. */
-    int index = hash_function(key);
-    Ht_item *item = table->items[index];
-    LinkedList *head = table->overflow_buckets[index];
-
-    /* Provide only non-NULL values. */
-    if (item != NULL)
-    {
-        if (strcmp(item->key, key) == 0)
-            return item->value;
+    Ht_item *item = find_item(table, key);
 
-        if (head == NULL)
-            return NULL;
-
-        item = head->item;
-        head = head->next;
-    }
-
-    return NULL;
+    return (item == NULL ? NULL : item->value);
 }
 
 char *ht_get_type(HashTable *table, char *key)
 {
     /* Searches for the key in the HashTable.
        Returns NULL if it doesn't exist. */
-    int index = hash_function(key);
-    Ht_item *item = table->items[index];
-    LinkedList *head = table->overflow_buckets[index];
+    Ht_item *item = find_item(table, key);
 
-    /* Provide only non-NULL types. */
-    if (item != NULL)
-    {
-        if (strcmp(item->key, key) == 0)
-            return item->type;
-
-        if (head == NULL)
-            return NULL;
-
-        item = head->item;
-        head = head->next;
-    }
-
-    return NULL;
+    return (item == NULL ? NULL : item->type);
 }
 
 char *ht_get_memory_address(HashTable *table, char *key)
 {
     /* Searches for the key in the HashTable.
        Returns NULL if it doesn't exist. */
-    int index = hash_function(key);
-    Ht_item *item = table->items[index];
-    LinkedList *head = table->overflow_buckets[index];
+    Ht_item *item = find_item(table, key);
 
-    /* Provide only non-NULL types. */
-    if (item != NULL)
-    {
-        if (strcmp(item->key, key) == 0)
-            return item->address;
-
-        if (head == NULL)
-            return NULL;
-
-        item = head->item;
-        head = head->next;
-    }
-
-    return NULL;
+    return (item == NULL ? NULL : item->address);
 }
 
 char *ht_get_memory_size(HashTable *table, char *key)
 {
     /* Searches for the key in the HashTable.
        Returns NULL if it doesn't exist. */
-    int index = hash_function(key);
-    Ht_item *item = table->items[index];
-    LinkedList *head = table->overflow_buckets[index];
-
-    /* Provide only non-NULL types. */
-    if (item != NULL)
-    {
-        if (strcmp(item->key, key) == 0)
-            return item->memorySize;
-
-        if (head == NULL)
-            return NULL;
-
-        item = head->item;
-        head = head->next;
-    }
+    Ht_item *item = find_item(table, key);
 
-    return NULL;
+    return (item == NULL ? NULL : item->memorySize);
 }
 
 
@@ -787,7 +891,6 @@ void ht_delete(HashTable *table, char *key)
     Ht_item *item = table->items[index];
     LinkedList *head = table->overflow_buckets[index];
 
-    LinkedList *node;
     LinkedList *curr;
     LinkedList *prev;
 
@@ -796,64 +899,41 @@ void ht_delete(HashTable *table, char *key)
         /* Does not exist. */
         return;
     }
-    else
+
+    if (strcmp(item->key, key) == 0)
     {
-        if (head == NULL && strcmp(item->key, key) == 0)
+        /* Remove the item.
+           The head of the collision chain, if there is one, takes its place. */
+        free_item(item);
+
+        if (head == NULL)
         {
-            /* Collision chain does not exist.
-               Remove the item.
-               Set table index to NULL. */
             table->items[index] = NULL;
-            free_item(item);
             table->count--;
-            return;
         }
-        else if (head != NULL)
+        else
         {
-            /* Collision chain exists. */
-            if (strcmp(item->key, key) == 0)
-            {
-                /* Remove this item.
-                   Set the head of the list as the new item. */
-                free_item(item);
-                node = head;
-                head = head->next;
-                node->next = NULL;
-                table->items[index] = create_item(node->item->key, node->item->value, node->item->type, node->item->address, node->item->memorySize, node->item->order);
-                free_linkedlist(node);
-                table->overflow_buckets[index] = head;
-                return;
-            }
-
-            curr = head;
-            prev = NULL;
+            table->items[index] = head->item;
+            table->overflow_buckets[index] = head->next;
+            free(head);
+        }
 
-            while (curr)
-            {
-                if (strcmp(curr->item->key, key) == 0)
-                {
-                    if (prev == NULL)
-                    {
-                        /* First element of the chain.
-                           Remove the chain. */
-                        free_linkedlist(head);
-                        table->overflow_buckets[index] = NULL;
-                        return;
-                    }
-                    else
-                    {
-                        /* This is somewhere in the chain. */
-                        prev->next = curr->next;
-                        curr->next = NULL;
-                        free_linkedlist(curr);
-                        table->overflow_buckets[index] = head;
-                        return;
-                    }
-                }
+        return;
+    }
 
-                curr = curr->next;
-                prev = curr;
-            }
+    for (prev = NULL, curr = head; curr != NULL; prev = curr, curr = curr->next)
+    {
+        if (strcmp(curr->item->key, key) == 0)
+        {
+            /* Unlink the node from the chain. */
+            if (prev == NULL)
+                table->overflow_buckets[index] = curr->next;
+            else
+                prev->next = curr->next;
+
+            curr->next = NULL;
+            free_linkedlist(curr);
+            return;
         }
     }
 }
@@ -960,8 +1040,219 @@ void print_table(HashTable *table)
     printf("-------------------\n\n");
 }
 
+/**
+ * Create an Output Buffer
+ *
+ * This function creates an empty in-memory buffer for output records.
+ * The records are kept in memory so the output file is only created when there is something to write.
+ *
+ * @return A pointer to the new buffer.
+ */
+OutputBuffer *create_output_buffer()
+{
+    OutputBuffer *buffer = (OutputBuffer *)malloc(sizeof(OutputBuffer));
 
+    if (buffer == NULL) {
+        memory_allocation_failed();
+    }
 
+    buffer->names = NULL;
+    buffer->namesLength = 0;
+    buffer->namesCapacity = 0;
+    buffer->nameOffsets = NULL;
+    buffer->addresses = NULL;
+    buffer->records = 0;
+    buffer->capacity = 0;
 
+    return buffer;
+}
 
+/**
+ * Append a Symbol Record to an Output Buffer
+ *
+ * This function appends a record of a symbol and its address (a "<name> <address>" line of the .ent / .ext format) to the buffer.
+ *
+ * @param buffer - The buffer to append to.
+ * @param name - The name of the symbol.
+ * @param address - The memory address of the symbol.
+ */
+void append_symbol_record(OutputBuffer *buffer, const char *name, int address)
+{
+    size_t nameLength = strlen(name);
+
+    /* Grow the buffer geometrically so appending stays linear */
+    if (buffer->namesLength + nameLength + 1 > buffer->namesCapacity) {
+        buffer->namesCapacity = (buffer->namesCapacity == 0) ? 256 : buffer->namesCapacity * 2;
+
+        while (buffer->namesLength + nameLength + 1 > buffer->namesCapacity) {
+            buffer->namesCapacity *= 2;
+        }
+
+        buffer->names = (char *)realloc(buffer->names, buffer->namesCapacity);
+
+        if (buffer->names == NULL) {
+            memory_allocation_failed();
+        }
+    }
 
+    if (buffer->records == buffer->capacity) {
+        buffer->capacity = (buffer->capacity == 0) ? 16 : buffer->capacity * 2;
+        buffer->nameOffsets = (int *)realloc(buffer->nameOffsets, buffer->capacity * sizeof(int));
+        buffer->addresses = (int *)realloc(buffer->addresses, buffer->capacity * sizeof(int));
+
+        if (buffer->nameOffsets == NULL || buffer->addresses == NULL) {
+            memory_allocation_failed();
+        }
+    }
+
+    memcpy(buffer->names + buffer->namesLength, name, nameLength + 1);
+    buffer->nameOffsets[buffer->records] = (int)buffer->namesLength;
+    buffer->addresses[buffer->records] = address;
+    buffer->namesLength += nameLength + 1;
+    buffer->records++;
+}
+
+/**
+ * Format an Output Buffer
+ *
+ * This function formats the buffered records as the lines of their output file.
+ * An empty buffer has no file at all.
+ *
+ * @param buffer - The buffer to format.
+ * @param length - Receives the length of the text.
+ * @return The text, allocated with malloc(), NULL if the buffer is empty.
+ */
+char *format_output_buffer(OutputBuffer *buffer, size_t *length)
+{
+    char *text = NULL;
+    int i;
+
+    if (buffer->records == 0) {
+        return NULL;
+    }
+
+    /* Every line is the name, a space, a 4 digit address (or more, for an address that does not fit) and a '\n' */
+    text = (char *)malloc(buffer->namesLength + (size_t)buffer->records * (1 + 11 + 1) + 1);
+    if (text == NULL) {
+        memory_allocation_failed();
+    }
+
+    /* Labels are limited to MAX_LABEL_LENGTH, the precision only guards the line length */
+    *length = 0;
+    for (i = 0; i < buffer->records; i++) {
+        *length += sprintf(text + *length, "%.*s %04d\n", MAX_LINE_LENGTH - 1, buffer->names + buffer->nameOffsets[i], buffer->addresses[i]);
+    }
+
+    return text;
+}
+
+/**
+ * Reset an Output Buffer
+ *
+ * This function drops the records of the buffer but keeps its memory for the records of the next file.
+ *
+ * @param buffer - The buffer to reset.
+ */
+void reset_output_buffer(OutputBuffer *buffer)
+{
+    buffer->namesLength = 0;
+    buffer->records = 0;
+}
+
+/**
+ * Free an Output Buffer
+ *
+ * @param buffer - The buffer to free.
+ */
+void free_output_buffer(OutputBuffer *buffer)
+{
+    free(buffer->names);
+    free(buffer->nameOffsets);
+    free(buffer->addresses);
+    free(buffer);
+}
+
+/**
+ * Create a Source Buffer
+ *
+ * This function indexes the lines of a text already in memory.
+ *
+ * @param data - The text, allocated with malloc() and owned by the buffer from now on.
+ *               It must have room for a terminating '\0' after its length.
+ * @param length - The length of the text.
+ * @return A pointer to the new buffer.
+ */
+SourceBuffer *create_source_buffer(char *data, int length)
+{
+    SourceBuffer *source = (SourceBuffer *)malloc(sizeof(SourceBuffer));
+
+    if (source == NULL) {
+        memory_allocation_failed();
+    }
+
+    data[length] = '\0';
+    source->data = data;
+    source->length = length;
+    source->lineStarts = indexLines(source->data, source->length, &source->lineCount);
+
+    return source;
+}
+
+/**
+ * Read a Source Buffer
+ *
+ * This function reads a whole input file into memory and indexes its lines in one pass,
+ * so the compilation passes walk the lines in memory instead of re-reading the file.
+ *
+ * @param fileName - The name of the file to read.
+ * @return A pointer to the new buffer or NULL if the file cannot be opened.
+ */
+SourceBuffer *read_source_buffer(const char *fileName)
+{
+    size_t length;
+    char *data = read_file(fileName, &length);
+
+    if (data == NULL) {
+        return NULL;
+    }
+
+    return create_source_buffer(data, (int)length);
+}
+
+/**
+ * Copy a Source Line
+ *
+ * This function copies a line of a source buffer (with its '\n', like fgets) into a null terminated buffer
+ * that the caller may modify. Lines longer than the buffer are truncated.
+ *
+ * @param source - The source buffer.
+ * @param lineIndex - The index of the line (0 based).
+ * @param line - The buffer that receives the line.
+ * @param lineSize - The size of the buffer.
+ * @return The number of characters copied.
+ */
+int copy_source_line(SourceBuffer *source, int lineIndex, char *line, int lineSize)
+{
+    int length = source->lineStarts[lineIndex + 1] - source->lineStarts[lineIndex];
+
+    if (length > lineSize - 1) {
+        length = lineSize - 1;
+    }
+
+    memcpy(line, source->data + source->lineStarts[lineIndex], length);
+    line[length] = '\0';
+
+    return length;
+}
+
+/**
+ * Free a Source Buffer
+ *
+ * @param source - The buffer to free.
+ */
+void free_source_buffer(SourceBuffer *source)
+{
+    free(source->data);
+    free(source->lineStarts);
+    free(source);
+}
@@ -29,10 +29,35 @@ typedef struct HashTable
     int count;
 } HashTable;
 
+/* Defines an in-memory buffer of output records (e.g. the .ent / .ext lines), formatted only when written. */
+typedef struct OutputBuffer
+{
+    char *names;            /* The null terminated names of the records, one after the other */
+    size_t namesLength;
+    size_t namesCapacity;
+    int *nameOffsets;       /* Offset of the name of every record in names */
+    int *addresses;         /* The address of every record */
+    int records;
+    int capacity;
+} OutputBuffer;
+
+/* Defines an input file loaded in memory together with the offsets of its lines. */
+typedef struct SourceBuffer
+{
+    char *data;         /* The file contents, null terminated */
+    int length;
+    int *lineStarts;    /* lineCount + 1 offsets, line i spans [lineStarts[i], lineStarts[i + 1]) */
+    int lineCount;
+} SourceBuffer;
+
 
 /* ------------------------------------ Functions ------------------------------------ */
 
 FILE* openFile(const char * fileName, const char * accessMode);
+void temporaryFileNameFor(const char * fileName, char * temporaryFileName);
+FILE* openTemporaryFile(const char * fileName, char * temporaryFileName);
+bool commitTemporaryFile(const char * temporaryFileName, const char * fileName);
+void removeOutputFile(const char * fileName);
 char *removeFileExtension(const char *inputFileName);
 void removeWhiteSpaces(char *inputString);
 void removeLeadingSpaces(char *str);
@@ -55,6 +80,7 @@ void free_overflow_buckets(HashTable *table);
 Ht_item *create_item(char *key, char *value, char *type, char *address, char *memorySize, char *order);
 HashTable *create_table(int size);
 void free_item(Ht_item *item);
+void clear_table(HashTable *table);
 void free_table(HashTable *table);
 void handle_collision(HashTable *table, unsigned long index, Ht_item *item);
 void ht_insert(HashTable *table, char *key, char *value, char *type, char *address, char *memorySize, char *order);
@@ -70,4 +96,13 @@ void print_memory_size(HashTable *table, char *key);
 char * return_search(HashTable *table, char *key);
 void print_table(HashTable *table);
 bool existsInHash(HashTable *table, char *key);
+OutputBuffer *create_output_buffer();
+void append_symbol_record(OutputBuffer *buffer, const char *name, int address);
+char *format_output_buffer(OutputBuffer *buffer, size_t *length);
+void reset_output_buffer(OutputBuffer *buffer);
+void free_output_buffer(OutputBuffer *buffer);
+SourceBuffer *create_source_buffer(char *data, int length);
+SourceBuffer *read_source_buffer(const char *fileName);
+int copy_source_line(SourceBuffer *source, int lineIndex, char *line, int lineSize);
+void free_source_buffer(SourceBuffer *source);
 